@@ -500,6 +500,62 @@ declare global {
         getEntity(id: number): Entity;
         getAllEntities(type: EntityType): Entity[];
         getAllEntities(type: "peep"): Peep[];
+
+        /**
+         * Reads the given fields of all entities of the given type into one typed array per field, the
+         * entities are in the same order as getAllEntities returns them. Much faster than reading the
+         * properties of every entity when only a few fields are needed.
+         * @param type The type of entities to read.
+         * @param fields The fields to read, "id", "x", "y" and "z" can be read for all entities. Peeps also
+         * have "energy", "happiness", "nausea", "hunger", "thirst", "toilet", "cash" and "currentRide"
+         * (the ride the peep is queuing for, entering, on or leaving, 255 otherwise). Cars also have "ride"
+         * and "velocity".
+         */
+        getEntityData(type: EntityType, fields: string[]): EntityData;
+
+        /**
+         * Reads the given fields of all tile elements in a range of tiles into one typed array per field.
+         * @param x The x coordinate of the first tile, in tiles.
+         * @param y The y coordinate of the first tile, in tiles.
+         * @param width The number of tiles to read along x.
+         * @param height The number of tiles to read along y.
+         * @param fields The fields to read: "type" (the TILE_ELEMENT_TYPE index, 0 for surface up to 7 for
+         * banner), "baseHeight", "clearanceHeight" and "direction".
+         */
+        getTileElementData(x: number, y: number, width: number, height: number, fields: string[]): TileElementData;
+    }
+
+    interface EntityData {
+        /** The number of entities read. */
+        readonly length: number;
+        readonly id?: Uint16Array;
+        readonly x?: Int32Array;
+        readonly y?: Int32Array;
+        readonly z?: Int32Array;
+        readonly energy?: Uint8Array;
+        readonly happiness?: Uint8Array;
+        readonly nausea?: Uint8Array;
+        readonly hunger?: Uint8Array;
+        readonly thirst?: Uint8Array;
+        readonly toilet?: Uint8Array;
+        readonly cash?: Int32Array;
+        readonly currentRide?: Uint16Array;
+        readonly ride?: Uint16Array;
+        readonly velocity?: Int32Array;
+    }
+
+    interface TileElementData {
+        /** The number of tile elements read. */
+        readonly length: number;
+        /**
+         * The elements of tile (x + i, y + j) are those from offsets[j * width + i] up to
+         * offsets[j * width + i + 1].
+         */
+        readonly offsets: Uint32Array;
+        readonly type?: Uint8Array;
+        readonly baseHeight?: Uint8Array;
+        readonly clearanceHeight?: Uint8Array;
+        readonly direction?: Uint8Array;
     }
 
     type TileElementType =
@@ -54,6 +54,7 @@
 #include "platform/Platform2.h"
 #include "platform/platform.h"
 #include "ride/TrackDesignRepository.h"
+#include "ride/Vehicle.h"
 #include "scenario/Scenario.h"
 #include "scenario/ScenarioRepository.h"
 #include "scripting/HookEngine.h"
@@ -160,6 +161,9 @@ namespace OpenRCT2
             // NOTE: We must shutdown all systems here before Instance is set back to null.
             //       If objects use GetContext() in their destructor things won't go well.
 
+            // Background saves still hold on to their file.
+            scenario_save_wait();
+
             GameActions::ClearQueue();
             network_close();
             window_close_all();
@@ -549,6 +553,9 @@ namespace OpenRCT2
         bool LoadParkFromFile(const std::string& path, bool loadTitleScreenOnFail) final override
         {
             log_verbose("Context::LoadParkFromFile(%s)", path.c_str());
+
+            // The park may still be being written by a background save.
+            scenario_save_wait();
             try
             {
                 if (String::Equals(Path::GetExtension(path), ".sea", true))
@@ -750,6 +757,11 @@ namespace OpenRCT2
 
         bool LoadBaseGraphics()
         {
+            if (gOpenRCT2Headless)
+            {
+                // Headless instances may never draw a sprite.
+                return gfx_defer_load_base_graphics(*_env);
+            }
             if (!gfx_load_g1(*_env))
             {
                 return false;
@@ -980,7 +992,12 @@ namespace OpenRCT2
 
             if (_accumulator < GAME_UPDATE_TIME_MS)
             {
-                platform_sleep(GAME_UPDATE_TIME_MS - _accumulator - 1);
+                // A server waits on its sockets instead, incoming packets are handled without waiting for the next tick.
+                uint32_t timeout = GAME_UPDATE_TIME_MS - _accumulator - 1;
+                if (!network_wait(timeout))
+                {
+                    platform_sleep(timeout);
+                }
                 return;
             }
 
@@ -1390,6 +1407,8 @@ rct_window* context_open_intent(Intent* intent)
 
 void context_broadcast_intent(Intent* intent)
 {
+    vehicle_motion_require_serial();
+
     auto windowManager = GetContext()->GetUiContext()->GetWindowManager();
     windowManager->BroadcastIntent(*intent);
 }
@@ -497,9 +497,9 @@ void game_fix_save_vars()
 
     // Fixes broken saves where a surface element could be null
     // and broken saves with incorrect invisible map border tiles
-    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    for (int32_t y = 0; y < gMapSizeTechnical; y++)
     {
-        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        for (int32_t x = 0; x < gMapSizeTechnical; x++)
         {
             auto* surfaceElement = map_get_surface_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
 
@@ -654,7 +654,24 @@ void save_game_cmd(const utf8* name /* = nullptr */)
 void save_game_with_name(const utf8* name)
 {
     log_verbose("Saving to %s", name);
-    if (scenario_save(name, 0x80000000 | (gConfigGeneral.save_plugin_data ? 1 : 0)))
+    uint32_t saveFlags = 0x80000000 | (gConfigGeneral.save_plugin_data ? 1 : 0);
+    if (gConfigGeneral.background_saving)
+    {
+        // Loading a park waits for the background saves, so the park is still the saved one when this is called.
+        scenario_save_async(name, saveFlags, [path = std::string(name)](bool result) {
+            if (result)
+            {
+                log_verbose("Saved to %s", path.c_str());
+                gCurrentLoadedPath = path;
+                gScreenAge = 0;
+            }
+            else
+            {
+                News::AddItemToQueue(News::ItemType::Blank, STR_GAME_SAVE_FAILED, 0, {});
+            }
+        });
+    }
+    else if (scenario_save(name, saveFlags))
     {
         log_verbose("Saved to %s", name);
         gCurrentLoadedPath = name;
@@ -787,8 +804,24 @@ void game_autosave()
         platform_file_copy(path, backupPath, true);
     }
 
-    if (!scenario_save(path, saveFlags))
+    if (gConfigGeneral.background_saving)
+    {
+        scenario_save_async(path, saveFlags, [path = std::string(path)](bool result) {
+            if (result)
+            {
+                log_verbose("Autosaved to %s", path.c_str());
+            }
+            else
+            {
+                std::fprintf(stderr, "Could not autosave the scenario. Is the save folder writeable?\n");
+                News::AddItemToQueue(News::ItemType::Blank, STR_GAME_SAVE_FAILED, 0, {});
+            }
+        });
+    }
+    else if (!scenario_save(path, saveFlags))
+    {
         std::fprintf(stderr, "Could not autosave the scenario. Is the save folder writeable?\n");
+    }
 }
 
 static void game_load_or_quit_no_save_prompt_callback(int32_t result, const utf8* path)
@@ -207,6 +207,8 @@ void GameState::Update()
         context_handle_input();
     }
 
+    scenario_save_update();
+
     // Always perform autosave check, even when paused
     if (!(gScreenFlags & SCREEN_FLAGS_TITLE_DEMO) && !(gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER)
         && !(gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER))
@@ -225,8 +227,18 @@ void GameState::Update()
     gInUpdateCode = false;
 }
 
-void GameState::UpdateLogic()
+void GameState::UpdateLogic(LogicTimings* timings)
 {
+    auto lastTime = std::chrono::high_resolution_clock::now();
+    auto report_time = [timings, &lastTime](LogicTimePart part) {
+        if (timings != nullptr)
+        {
+            auto now = std::chrono::high_resolution_clock::now();
+            timings->TimingInfo[static_cast<size_t>(part)] += now - lastTime;
+            lastTime = now;
+        }
+    };
+
     gScreenAge++;
     if (gScreenAge == 0)
         gScreenAge--;
@@ -268,6 +280,7 @@ void GameState::UpdateLogic()
             }
         }
     }
+    report_time(LogicTimePart::NetworkUpdate);
 
 #ifdef ENABLE_SCRIPTING
     // Stash the current day number before updating the date so that we
@@ -277,33 +290,51 @@ void GameState::UpdateLogic()
 
     date_update();
     _date = Date(static_cast<uint32_t>(gDateMonthsElapsed), gDateMonthTicks);
+    report_time(LogicTimePart::Date);
 
     scenario_update();
+    report_time(LogicTimePart::Scenario);
     climate_update();
+    report_time(LogicTimePart::Climate);
     map_update_tiles();
+    report_time(LogicTimePart::MapTiles);
     // Temporarily remove provisional paths to prevent peep from interacting with them
     map_remove_provisional_elements();
+    report_time(LogicTimePart::MapStashProvisionalElements);
     map_update_path_wide_flags();
+    report_time(LogicTimePart::MapPathWideFlags);
     peep_update_all();
+    report_time(LogicTimePart::Peep);
     map_restore_provisional_elements();
+    report_time(LogicTimePart::MapRestoreProvisionalElements);
     vehicle_update_all();
+    report_time(LogicTimePart::Vehicle);
     sprite_misc_update_all();
+    report_time(LogicTimePart::Misc);
     Ride::UpdateAll();
+    report_time(LogicTimePart::Ride);
 
     if (!(gScreenFlags & SCREEN_FLAGS_EDITOR))
     {
         _park->Update(_date);
     }
+    report_time(LogicTimePart::Park);
 
     research_update();
+    report_time(LogicTimePart::Research);
     ride_ratings_update_all();
+    report_time(LogicTimePart::RideRatings);
     ride_measurements_update();
+    report_time(LogicTimePart::RideMeasurements);
     News::UpdateCurrentItem();
+    report_time(LogicTimePart::News);
 
     map_animation_invalidate_all();
+    report_time(LogicTimePart::MapAnimation);
     vehicle_sounds_update();
     peep_update_crowd_noise();
     climate_update_sound();
+    report_time(LogicTimePart::Sounds);
     editor_open_windows_for_current_step();
 
     // Update windows
@@ -316,23 +347,34 @@ void GameState::UpdateLogic()
     }
 
     GameActions::ProcessQueue();
+    report_time(LogicTimePart::GameActions);
 
     network_process_pending();
     network_flush();
+    report_time(LogicTimePart::NetworkFlush);
 
     gCurrentTicks++;
     gScenarioTicks++;
     gSavedAge++;
 
 #ifdef ENABLE_SCRIPTING
-    auto& hookEngine = GetContext()->GetScriptEngine().GetHookEngine();
+    auto& scriptEngine = GetContext()->GetScriptEngine();
+    scriptEngine.UpdatePluginTickBudgets();
+
+    auto& hookEngine = scriptEngine.GetHookEngine();
     hookEngine.Call(HOOK_TYPE::INTERVAL_TICK, true);
 
     if (day != _date.GetDay())
     {
         hookEngine.Call(HOOK_TYPE::INTERVAL_DAY, true);
     }
+    report_time(LogicTimePart::Scripts);
 #endif
+
+    if (timings != nullptr)
+    {
+        timings->Ticks++;
+    }
 }
 
 void GameState::CreateStateSnapshot()
@@ -11,12 +11,50 @@
 
 #include "Date.h"
 
+#include <array>
+#include <chrono>
 #include <memory>
 
 namespace OpenRCT2
 {
     class Park;
 
+    enum class LogicTimePart
+    {
+        NetworkUpdate,
+        Date,
+        Scenario,
+        Climate,
+        MapTiles,
+        MapStashProvisionalElements,
+        MapPathWideFlags,
+        Peep,
+        MapRestoreProvisionalElements,
+        Vehicle,
+        Misc,
+        Ride,
+        Park,
+        Research,
+        RideRatings,
+        RideMeasurements,
+        News,
+        MapAnimation,
+        Sounds,
+        GameActions,
+        NetworkFlush,
+        Scripts,
+        Count
+    };
+
+    /**
+     * Time spent in each stage of GameState::UpdateLogic, accumulated over all ticks it was passed to.
+     */
+    struct LogicTimings
+    {
+        std::array<std::chrono::duration<double>, static_cast<size_t>(LogicTimePart::Count)> TimingInfo{};
+        uint32_t Ticks{};
+    };
+
     /**
      * Class to update the state of the map and park.
      */
@@ -41,7 +79,7 @@ namespace OpenRCT2
 
         void InitAll(int32_t mapSize);
         void Update();
-        void UpdateLogic();
+        void UpdateLogic(LogicTimings* timings = nullptr);
 
     private:
         void CreateStateSnapshot();
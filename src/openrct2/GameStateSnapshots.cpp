@@ -10,27 +10,150 @@
 #include "GameStateSnapshots.h"
 
 #include "core/CircularBuffer.h"
+#include "core/MemoryStream.h"
 #include "peep/Peep.h"
 #include "world/Sprite.h"
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 static constexpr size_t MaximumGameStateSnapshots = 32;
 static constexpr uint32_t InvalidTick = 0xFFFFFFFF;
 
+// Every n-th captured snapshot stores the full sprite data, the ones in between only store a delta against the previous
+// captured snapshot.
+static constexpr uint32_t GameStateSnapshotKeyframeInterval = 16;
+
+// Shortest run of unchanged bytes that ends a literal block in a delta, shorter runs are cheaper to keep inline.
+static constexpr size_t SnapshotDeltaMinZeroRun = 4;
+
+static void WriteDeltaVarInt(OpenRCT2::MemoryStream& stream, uint64_t value)
+{
+    do
+    {
+        uint8_t byte = value & 0x7F;
+        value >>= 7;
+        if (value != 0)
+            byte |= 0x80;
+        stream.WriteValue(byte);
+    } while (value != 0);
+}
+
+static uint64_t ReadDeltaVarInt(OpenRCT2::MemoryStream& stream)
+{
+    uint64_t value = 0;
+    for (int32_t shift = 0; shift < 64; shift += 7)
+    {
+        auto byte = stream.ReadValue<uint8_t>();
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            break;
+    }
+    return value;
+}
+
+/**
+ * Encodes data as the XOR against base, the result is stored as a sequence of (zero run, literal length, literal bytes)
+ * blocks. Bytes beyond the end of base are treated as zero.
+ */
+static void EncodeSnapshotDelta(const OpenRCT2::MemoryStream& base, const OpenRCT2::MemoryStream& data, OpenRCT2::MemoryStream& out)
+{
+    const auto* baseBytes = static_cast<const uint8_t*>(base.GetData());
+    const auto* dataBytes = static_cast<const uint8_t*>(data.GetData());
+    const size_t baseLength = static_cast<size_t>(base.GetLength());
+    const size_t length = static_cast<size_t>(data.GetLength());
+    auto xorAt = [&](size_t i) -> uint8_t { return dataBytes[i] ^ (i < baseLength ? baseBytes[i] : 0); };
+
+    WriteDeltaVarInt(out, length);
+
+    size_t pos = 0;
+    while (pos < length)
+    {
+        size_t zeroRun = 0;
+        while (pos + zeroRun < length && xorAt(pos + zeroRun) == 0)
+        {
+            zeroRun++;
+        }
+        pos += zeroRun;
+
+        size_t literalEnd = pos;
+        size_t zeros = 0;
+        while (literalEnd < length && zeros < SnapshotDeltaMinZeroRun)
+        {
+            zeros = xorAt(literalEnd) == 0 ? zeros + 1 : 0;
+            literalEnd++;
+        }
+        if (zeros >= SnapshotDeltaMinZeroRun || literalEnd == length)
+        {
+            literalEnd -= zeros;
+        }
+
+        WriteDeltaVarInt(out, zeroRun);
+        WriteDeltaVarInt(out, literalEnd - pos);
+        for (; pos < literalEnd; pos++)
+        {
+            out.WriteValue(xorAt(pos));
+        }
+    }
+}
+
+static void DecodeSnapshotDelta(const OpenRCT2::MemoryStream& base, OpenRCT2::MemoryStream& delta, OpenRCT2::MemoryStream& out)
+{
+    const auto* baseBytes = static_cast<const uint8_t*>(base.GetData());
+    const size_t baseLength = static_cast<size_t>(base.GetLength());
+
+    delta.SetPosition(0);
+    const auto length = static_cast<size_t>(ReadDeltaVarInt(delta));
+
+    std::vector<uint8_t> result(length);
+    std::memcpy(result.data(), baseBytes, std::min(length, baseLength));
+
+    size_t pos = 0;
+    while (pos < length)
+    {
+        pos += static_cast<size_t>(ReadDeltaVarInt(delta));
+        auto literalLength = static_cast<size_t>(ReadDeltaVarInt(delta));
+        if (pos + literalLength > length)
+        {
+            throw IOException("Game state snapshot delta is corrupted.");
+        }
+        for (size_t i = 0; i < literalLength; i++)
+        {
+            result[pos++] ^= delta.ReadValue<uint8_t>();
+        }
+    }
+
+    out = OpenRCT2::MemoryStream();
+    out.Write(result.data(), result.size());
+}
+
 struct GameStateSnapshot_t
 {
     GameStateSnapshot_t& operator=(GameStateSnapshot_t&& mv) noexcept
     {
         tick = mv.tick;
         storedSprites = std::move(mv.storedSprites);
+        spriteDelta = std::move(mv.spriteDelta);
+        deltaBase = mv.deltaBase;
         return *this;
     }
 
     uint32_t tick = InvalidTick;
     uint32_t srand0 = 0;
 
+    // Empty while the snapshot is only stored as a delta against deltaBase, see GameStateSnapshots::Materialise.
     OpenRCT2::MemoryStream storedSprites;
     OpenRCT2::MemoryStream parkParameters;
 
+    GameStateSnapshot_t* deltaBase = nullptr;
+    OpenRCT2::MemoryStream spriteDelta;
+
+    bool IsMaterialised() const
+    {
+        return deltaBase == nullptr || storedSprites.GetLength() != 0;
+    }
+
     // Must pass a function that can access the sprite.
     void SerialiseSprites(std::function<rct_sprite*(const size_t)> getEntity, const size_t numSprites, bool saving)
     {
@@ -124,16 +247,29 @@ struct GameStateSnapshots final : public IGameStateSnapshots
     virtual void Reset() override final
     {
         _snapshots.clear();
+        _lastCaptured = nullptr;
+        _lastCapturedSprites = OpenRCT2::MemoryStream();
+        _capturesSinceKeyframe = 0;
     }
 
     virtual GameStateSnapshot_t& CreateSnapshot() override final
     {
+        if (_snapshots.size() == _snapshots.capacity())
+        {
+            Evict(*_snapshots.front());
+        }
+
         auto snapshot = std::make_unique<GameStateSnapshot_t>();
         _snapshots.push_back(std::move(snapshot));
 
         return *_snapshots.back();
     }
 
+    virtual std::shared_ptr<GameStateSnapshot_t> CreateDetachedSnapshot() const override final
+    {
+        return std::make_shared<GameStateSnapshot_t>();
+    }
+
     virtual void LinkSnapshot(GameStateSnapshot_t& snapshot, uint32_t tick, uint32_t srand0) override final
     {
         snapshot.tick = tick;
@@ -145,6 +281,27 @@ struct GameStateSnapshots final : public IGameStateSnapshots
         snapshot.SerialiseSprites(
             [](const size_t index) { return reinterpret_cast<rct_sprite*>(GetEntity(index)); }, MAX_SPRITES, true);
 
+        // Detached snapshots can be destroyed at any time, they are always stored in full.
+        if (_snapshots.empty() || _snapshots.back().get() != &snapshot)
+            return;
+
+        if (_lastCaptured != nullptr && _capturesSinceKeyframe < GameStateSnapshotKeyframeInterval)
+        {
+            // Only keep the changes to the previous tick, the full data is rebuilt when it is requested.
+            snapshot.spriteDelta = OpenRCT2::MemoryStream();
+            EncodeSnapshotDelta(_lastCapturedSprites, snapshot.storedSprites, snapshot.spriteDelta);
+            snapshot.deltaBase = _lastCaptured;
+            _lastCapturedSprites = std::move(snapshot.storedSprites);
+            snapshot.storedSprites = OpenRCT2::MemoryStream();
+            _capturesSinceKeyframe++;
+        }
+        else
+        {
+            _lastCapturedSprites = OpenRCT2::MemoryStream(snapshot.storedSprites);
+            _capturesSinceKeyframe = 1;
+        }
+        _lastCaptured = &snapshot;
+
         // log_info("Snapshot size: %u bytes", static_cast<uint32_t>(snapshot.storedSprites.GetLength()));
     }
 
@@ -153,21 +310,88 @@ struct GameStateSnapshots final : public IGameStateSnapshots
         for (size_t i = 0; i < _snapshots.size(); i++)
         {
             if (_snapshots[i]->tick == tick)
+            {
+                Materialise(*_snapshots[i]);
                 return _snapshots[i].get();
+            }
         }
         return nullptr;
     }
 
     virtual void SerialiseSnapshot(GameStateSnapshot_t& snapshot, DataSerialiser& ds) const override final
     {
+        if (ds.IsSaving())
+        {
+            Materialise(snapshot);
+        }
         ds << snapshot.tick;
         ds << snapshot.srand0;
         ds << snapshot.storedSprites;
         ds << snapshot.parkParameters;
     }
 
+    virtual void SerialiseSnapshotDelta(
+        GameStateSnapshot_t& base, GameStateSnapshot_t& snapshot, DataSerialiser& ds) const override final
+    {
+        Materialise(base);
+
+        OpenRCT2::MemoryStream delta;
+        if (ds.IsSaving())
+        {
+            Materialise(snapshot);
+            EncodeSnapshotDelta(base.storedSprites, snapshot.storedSprites, delta);
+        }
+
+        ds << snapshot.tick;
+        ds << snapshot.srand0;
+        ds << delta;
+        ds << snapshot.parkParameters;
+
+        if (ds.IsLoading())
+        {
+            DecodeSnapshotDelta(base.storedSprites, delta, snapshot.storedSprites);
+            snapshot.deltaBase = nullptr;
+        }
+    }
+
+    /*
+     * Rebuilds the full sprite data of a snapshot that is only stored as a delta.
+     */
+    void Materialise(GameStateSnapshot_t& snapshot) const
+    {
+        if (snapshot.IsMaterialised())
+            return;
+
+        Materialise(*snapshot.deltaBase);
+        DecodeSnapshotDelta(snapshot.deltaBase->storedSprites, snapshot.spriteDelta, snapshot.storedSprites);
+    }
+
+    /*
+     * Called before the snapshot is dropped from the history, any snapshot that is stored as a delta against it
+     * becomes a keyframe.
+     */
+    void Evict(GameStateSnapshot_t& snapshot)
+    {
+        for (size_t i = 0; i < _snapshots.size(); i++)
+        {
+            auto& other = *_snapshots[i];
+            if (other.deltaBase == &snapshot)
+            {
+                Materialise(other);
+                other.deltaBase = nullptr;
+                other.spriteDelta = OpenRCT2::MemoryStream();
+            }
+        }
+        if (_lastCaptured == &snapshot)
+        {
+            _lastCaptured = nullptr;
+        }
+    }
+
     std::vector<rct_sprite> BuildSpriteList(GameStateSnapshot_t& snapshot) const
     {
+        Materialise(snapshot);
+
         std::vector<rct_sprite> spriteList;
         spriteList.resize(MAX_SPRITES);
 
@@ -296,10 +520,16 @@ struct GameStateSnapshots final : public IGameStateSnapshots
         COMPARE_FIELD(Peep, StaffOrders);
         COMPARE_FIELD(Peep, Photo1RideRef);
         COMPARE_FIELD(Peep, PeepFlags);
-        COMPARE_FIELD(Peep, PathfindGoal);
+        COMPARE_FIELD(Peep, PathfindGoal.x);
+        COMPARE_FIELD(Peep, PathfindGoal.y);
+        COMPARE_FIELD(Peep, PathfindGoal.z);
+        COMPARE_FIELD(Peep, PathfindGoal.direction);
         for (int i = 0; i < 4; i++)
         {
-            COMPARE_FIELD(Peep, PathfindHistory[i]);
+            COMPARE_FIELD(Peep, PathfindHistory[i].x);
+            COMPARE_FIELD(Peep, PathfindHistory[i].y);
+            COMPARE_FIELD(Peep, PathfindHistory[i].z);
+            COMPARE_FIELD(Peep, PathfindHistory[i].direction);
         }
         COMPARE_FIELD(Peep, WalkingFrameNum);
         COMPARE_FIELD(Peep, LitterCount);
@@ -690,6 +920,11 @@ struct GameStateSnapshots final : public IGameStateSnapshots
 
 private:
     CircularBuffer<std::unique_ptr<GameStateSnapshot_t>, MaximumGameStateSnapshots> _snapshots;
+
+    // Full sprite data of the last captured snapshot, the next capture is encoded against it.
+    GameStateSnapshot_t* _lastCaptured = nullptr;
+    OpenRCT2::MemoryStream _lastCapturedSprites;
+    uint32_t _capturesSinceKeyframe = 0;
 };
 
 std::unique_ptr<IGameStateSnapshots> CreateGameStateSnapshots()
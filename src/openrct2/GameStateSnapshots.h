@@ -74,6 +74,11 @@ struct IGameStateSnapshots
      */
     virtual GameStateSnapshot_t& CreateSnapshot() = 0;
 
+    /*
+     * Creates a new empty snapshot that is not part of the history and therefore never removed.
+     */
+    virtual std::shared_ptr<GameStateSnapshot_t> CreateDetachedSnapshot() const = 0;
+
     /*
      * Links the snapshot to a specific game tick.
      */
@@ -94,6 +99,12 @@ struct IGameStateSnapshots
      */
     virtual void SerialiseSnapshot(GameStateSnapshot_t& snapshot, DataSerialiser& serialiser) const = 0;
 
+    /*
+     * Serialisation of GameStateSnapshot_t as a delta against base, the same base is required to load it again.
+     */
+    virtual void SerialiseSnapshotDelta(
+        GameStateSnapshot_t& base, GameStateSnapshot_t& snapshot, DataSerialiser& serialiser) const = 0;
+
     /*
      * Compares two states resulting GameStateCompareData_t with all mismatches stored.
      */
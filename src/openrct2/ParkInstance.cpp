@@ -0,0 +1,93 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ParkInstance.h"
+
+#include "Cheats.h"
+#include "Context.h"
+#include "Game.h"
+#include "GameState.h"
+#include "ParkImporter.h"
+#include "core/DataSerialiser.h"
+#include "object/ObjectManager.h"
+#include "object/ObjectRepository.h"
+#include "rct2/S6Exporter.h"
+#include "ride/Ride.h"
+#include "world/Park.h"
+#include "world/Sprite.h"
+
+#include <memory>
+
+using namespace OpenRCT2;
+
+static void SerialiseParkParameters(DataSerialiser& serialiser)
+{
+    serialiser << _guestGenerationProbability;
+    serialiser << _suggestedGuestMaximum;
+    serialiser << gGamePaused;
+}
+
+ParkInstance::ParkInstance(IContext& context)
+    : _context(context)
+{
+}
+
+void ParkInstance::Capture()
+{
+    // The objects stay in the repository of the process, so they are not packed into the saved game.
+    _parkData = MemoryStream();
+    auto s6exporter = std::make_unique<S6Exporter>();
+    s6exporter->Export();
+    s6exporter->SaveGame(&_parkData);
+
+    _parkParams = MemoryStream();
+    DataSerialiser parkParamsDs(true, _parkParams);
+    SerialiseParkParameters(parkParamsDs);
+
+    _cheatData = MemoryStream();
+    DataSerialiser cheatDataDs(true, _cheatData);
+    CheatsSerialise(cheatDataDs);
+}
+
+void ParkInstance::Restore()
+{
+    _parkData.SetPosition(0);
+    _parkParams.SetPosition(0);
+    _cheatData.SetPosition(0);
+
+    auto& objManager = _context.GetObjectManager();
+    auto importer = ParkImporter::CreateS6(_context.GetObjectRepository());
+    auto loadResult = importer->LoadFromStream(&_parkData, false);
+    objManager.LoadObjects(loadResult.RequiredObjects.data(), loadResult.RequiredObjects.size());
+    importer->Import();
+
+    sprite_position_tween_reset();
+
+    DataSerialiser parkParamsDs(false, _parkParams);
+    SerialiseParkParameters(parkParamsDs);
+
+    // Cheats the data does not hold keep their defaults instead of the values of the park that was current.
+    CheatsReset();
+    DataSerialiser cheatDataDs(false, _cheatData);
+    CheatsSerialise(cheatDataDs);
+
+    game_load_init();
+    fix_invalid_vehicle_sprite_sizes();
+}
+
+void ParkInstance::Update(uint32_t ticks)
+{
+    Restore();
+    auto* gameState = _context.GetGameState();
+    for (uint32_t i = 0; i < ticks; i++)
+    {
+        gameState->UpdateLogic();
+    }
+    Capture();
+}
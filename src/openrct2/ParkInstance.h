@@ -0,0 +1,60 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "common.h"
+#include "core/MemoryStream.h"
+
+namespace OpenRCT2
+{
+    struct IContext;
+
+    /**
+     * One of several parks simulated in the same process. The simulation state lives in globals, so only the current
+     * park is held there while the others are kept in memory the way replay keyframes keep a park: as a saved game
+     * followed by the park parameters and cheats that saved games do not hold. The parks take turns, they can not be
+     * updated on several threads at once.
+     */
+    class ParkInstance final
+    {
+    private:
+        IContext& _context;
+        MemoryStream _parkData;
+        MemoryStream _parkParams;
+        MemoryStream _cheatData;
+
+    public:
+        explicit ParkInstance(IContext& context);
+        ParkInstance(const ParkInstance&) = delete;
+
+        /**
+         * Keeps the current park as the state of this park.
+         */
+        void Capture();
+
+        /**
+         * Makes this park the current one, replacing the park that was current before.
+         */
+        void Restore();
+
+        /**
+         * Makes this park the current one, updates it for the given number of ticks and keeps the result.
+         */
+        void Update(uint32_t ticks);
+
+        /**
+         * The saved game this park is kept as.
+         */
+        const MemoryStream& GetParkData() const
+        {
+            return _parkData;
+        }
+    };
+} // namespace OpenRCT2
@@ -11,6 +11,7 @@
 
 #include "Context.h"
 #include "Game.h"
+#include "GameState.h"
 #include "GameStateSnapshots.h"
 #include "OpenRCT2.h"
 #include "ParkImporter.h"
@@ -32,6 +33,7 @@
 #include "world/Park.h"
 #include "zlib.h"
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <vector>
@@ -75,6 +77,14 @@ namespace OpenRCT2
         OpenRCT2::MemoryStream data;
     };
 
+    struct ReplayKeyframe
+    {
+        uint32_t tick;
+        uint32_t commandIndex; // Commands before this one were executed before the keyframe was taken.
+        uint64_t uncompressedSize;
+        OpenRCT2::MemoryStream data; // Compressed park data, park parameters and cheats at the start of the tick.
+    };
+
     struct ReplayRecordData
     {
         uint32_t magic;
@@ -92,15 +102,20 @@ namespace OpenRCT2
         std::vector<std::pair<uint32_t, rct_sprite_checksum>> checksums;
         uint32_t checksumIndex;
         OpenRCT2::MemoryStream gameStateSnapshots;
+        std::vector<ReplayKeyframe> keyframes;
     };
 
     class ReplayManager final : public IReplayManager
     {
-        static constexpr uint16_t ReplayVersion = 4;
+        static constexpr uint16_t ReplayVersion = 5;
+        static constexpr uint16_t ReplayKeyframesVersion = 5;
+        static constexpr uint16_t ReplayMinimumVersion = 4;
         static constexpr uint32_t ReplayMagic = 0x5243524F; // ORCR.
         static constexpr int ReplayCompressionLevel = 9;
         static constexpr int NormalRecordingChecksumTicks = 1;
         static constexpr int SilentRecordingChecksumTicks = 40; // Same as network server
+        static constexpr int KeyframeTicks = 1000;
+        static constexpr int KeyframeCompressionLevel = 1; // The park data is already chunk encoded.
 
         enum class ReplayMode
         {
@@ -164,6 +179,15 @@ namespace OpenRCT2
                 _nextChecksumTick = gCurrentTicks + ChecksumTicksDelta();
             }
 
+            // Silent recordings are only kept around for desyncs, they don't need to be seekable.
+            if ((_mode == ReplayMode::RECORDING || _mode == ReplayMode::NORMALISATION) && _recordType == RecordType::NORMAL
+                && gCurrentTicks == _nextKeyframeTick)
+            {
+                TakeKeyframe();
+
+                _nextKeyframeTick = gCurrentTicks + KeyframeTicks;
+            }
+
             if (_mode == ReplayMode::RECORDING)
             {
                 if (gCurrentTicks >= _currentRecording->tickEnd)
@@ -216,6 +240,43 @@ namespace OpenRCT2
             snapshots->SerialiseSnapshot(snapshot, snapShotDs);
         }
 
+        void ExportPark(MemoryStream& parkData)
+        {
+            auto context = GetContext();
+            auto& objManager = context->GetObjectManager();
+            auto objects = objManager.GetPackableObjects();
+
+            auto s6exporter = std::make_unique<S6Exporter>();
+            s6exporter->ExportObjectsList = objects;
+            s6exporter->Export();
+            s6exporter->SaveGame(&parkData);
+        }
+
+        // Keyframes hold the same state as the start of the recording so playback can start from any of them.
+        void TakeKeyframe()
+        {
+            MemoryStream parkData;
+            ExportPark(parkData);
+
+            MemoryStream parkParams;
+            DataSerialiser parkParamsDs(true, parkParams);
+            SerialiseParkParameters(parkParamsDs);
+
+            MemoryStream cheatData;
+            DataSerialiser cheatDataDs(true, cheatData);
+            SerialiseCheats(cheatDataDs);
+
+            DataSerialiser keyframeDs(true);
+            keyframeDs << parkData;
+            keyframeDs << parkParams;
+            keyframeDs << cheatData;
+
+            const auto& stream = keyframeDs.GetStream();
+            ReplayKeyframe keyframe{ gCurrentTicks, _commandId, stream.GetLength(), {} };
+            Compress(stream, keyframe.data, KeyframeCompressionLevel);
+            _currentRecording->keyframes.push_back(std::move(keyframe));
+        }
+
         virtual bool StartRecording(
             const std::string& name, uint32_t maxTicks /*= k_MaxReplayTicks*/, RecordType rt /*= RecordType::NORMAL*/) override
         {
@@ -240,14 +301,7 @@ namespace OpenRCT2
 
             replayData->filePath = name;
 
-            auto context = GetContext();
-            auto& objManager = context->GetObjectManager();
-            auto objects = objManager.GetPackableObjects();
-
-            auto s6exporter = std::make_unique<S6Exporter>();
-            s6exporter->ExportObjectsList = objects;
-            s6exporter->Export();
-            s6exporter->SaveGame(&replayData->parkData);
+            ExportPark(replayData->parkData);
 
             replayData->timeRecorded = std::chrono::seconds(std::time(nullptr)).count();
 
@@ -265,6 +319,7 @@ namespace OpenRCT2
             _currentRecording = std::move(replayData);
             _recordType = rt;
             _nextChecksumTick = gCurrentTicks + 1;
+            _nextKeyframeTick = gCurrentTicks + KeyframeTicks;
 
             return true;
         }
@@ -295,24 +350,15 @@ namespace OpenRCT2
             Serialise(recSerialiser, *_currentRecording);
 
             const auto& stream = recSerialiser.GetStream();
-            unsigned long streamLength = static_cast<unsigned long>(stream.GetLength());
-            unsigned long compressLength = compressBound(streamLength);
-
-            MemoryStream data(compressLength);
-
-            ReplayRecordFile file{ _currentRecording->magic, _currentRecording->version, streamLength, data };
-
-            auto compressBuf = std::make_unique<unsigned char[]>(compressLength);
-            compress2(
-                compressBuf.get(), &compressLength, static_cast<const unsigned char*>(stream.GetData()), stream.GetLength(),
-                ReplayCompressionLevel);
-            file.data.Write(compressBuf.get(), compressLength);
+            ReplayRecordFile file{ _currentRecording->magic, _currentRecording->version, stream.GetLength(), {} };
+            Compress(stream, file.data, ReplayCompressionLevel);
 
             DataSerialiser fileSerialiser(true);
             fileSerialiser << file.magic;
             fileSerialiser << file.version;
             fileSerialiser << file.uncompressedSize;
             fileSerialiser << file.data;
+            SerialiseKeyframes(fileSerialiser, _currentRecording->keyframes);
 
             bool result = false;
 
@@ -412,7 +458,18 @@ namespace OpenRCT2
             }
         }
 
-        virtual bool StartPlayback(const std::string& file) override
+        void SkipSnapshot(MemoryStream& snapshotStream)
+        {
+            DataSerialiser ds(false, snapshotStream);
+
+            IGameStateSnapshots* snapshots = GetContext()->GetGameStateSnapshots();
+
+            GameStateSnapshot_t& replaySnapshot = snapshots->CreateSnapshot();
+            snapshots->SerialiseSnapshot(replaySnapshot, ds);
+        }
+
+        virtual bool StartPlayback(
+            const std::string& file, uint32_t startTick /*= 0*/, uint32_t endTick /*= k_MaxReplayTicks*/) override
         {
             if (_mode != ReplayMode::NONE && _mode != ReplayMode::NORMALISATION)
                 return false;
@@ -425,26 +482,73 @@ namespace OpenRCT2
                 return false;
             }
 
-            if (!LoadReplayDataMap(*replayData))
+            auto keyframe = std::find_if(
+                replayData->keyframes.rbegin(), replayData->keyframes.rend(),
+                [startTick](const ReplayKeyframe& k) { return k.tick <= startTick; });
+            if (keyframe == replayData->keyframes.rend())
             {
-                log_error("Unable to load map.");
-                return false;
+                if (!LoadReplayDataMap(replayData->parkData, replayData->parkParams, replayData->cheatData))
+                {
+                    log_error("Unable to load map.");
+                    return false;
+                }
+
+                gCurrentTicks = replayData->tickStart;
+
+                LoadAndCompareSnapshot(replayData->gameStateSnapshots);
             }
+            else
+            {
+                if (!LoadKeyframe(*keyframe))
+                {
+                    log_error("Unable to load keyframe at tick %u.", keyframe->tick);
+                    return false;
+                }
 
-            gCurrentTicks = replayData->tickStart;
+                gCurrentTicks = keyframe->tick;
 
-            LoadAndCompareSnapshot(replayData->gameStateSnapshots);
+                // The snapshot is of the start of the replay, the one after it is still compared at the end.
+                SkipSnapshot(replayData->gameStateSnapshots);
+
+                auto& commands = replayData->commands;
+                auto commandIndex = keyframe->commandIndex;
+                for (auto it = commands.begin(); it != commands.end();)
+                {
+                    if (it->commandIndex < commandIndex)
+                        it = commands.erase(it);
+                    else
+                        it++;
+                }
+            }
+
+            const auto& checksums = replayData->checksums;
+            auto firstChecksum = std::find_if(checksums.begin(), checksums.end(), [](const auto& checksum) {
+                return checksum.first >= gCurrentTicks;
+            });
+
+            // The snapshot at the end of the replay can only be compared if playback gets there.
+            _compareEndSnapshot = endTick >= replayData->tickEnd;
+            replayData->tickEnd = std::min(replayData->tickEnd, endTick);
 
             _currentReplay = std::move(replayData);
-            _currentReplay->checksumIndex = 0;
+            _currentReplay->checksumIndex = static_cast<uint32_t>(firstChecksum - checksums.begin());
             _faultyChecksumIndex = -1;
 
             // Make sure game is not paused.
             gGamePaused = 0;
 
             if (_mode != ReplayMode::NORMALISATION)
+            {
                 _mode = ReplayMode::PLAYING;
 
+                // Play from the keyframe up to the requested tick, the checksums on the way are still checked.
+                auto gameState = GetContext()->GetGameState();
+                while (IsReplaying() && gCurrentTicks < startTick && !IsPlaybackStateMismatching())
+                {
+                    gameState->UpdateLogic();
+                }
+            }
+
             return true;
         }
 
@@ -462,7 +566,8 @@ namespace OpenRCT2
             if (_mode != ReplayMode::PLAYING && _mode != ReplayMode::NORMALISATION)
                 return false;
 
-            LoadAndCompareSnapshot(_currentReplay->gameStateSnapshots);
+            if (_compareEndSnapshot)
+                LoadAndCompareSnapshot(_currentReplay->gameStateSnapshots);
 
             // During normal playback we pause the game if stopped.
             if (_mode == ReplayMode::PLAYING)
@@ -482,11 +587,52 @@ namespace OpenRCT2
             return true;
         }
 
+        virtual bool GetKeyframeTicks(const std::string& file, std::vector<uint32_t>& ticks) override
+        {
+            MemoryStream stream;
+            if (!ReadReplayFromFile(file, stream))
+                return false;
+
+            try
+            {
+                ReplayRecordFile recFile;
+                stream.SetPosition(0);
+                DataSerialiser fileSerializer(false, stream);
+                fileSerializer << recFile.magic;
+                fileSerializer << recFile.version;
+                if (recFile.magic != ReplayMagic)
+                    return false;
+
+                ticks.clear();
+                if (recFile.version < ReplayKeyframesVersion)
+                    return true;
+
+                // Skip over the replay to the keyframe index.
+                uint32_t dataLength = 0;
+                fileSerializer << recFile.uncompressedSize;
+                fileSerializer << dataLength;
+                stream.SetPosition(stream.GetPosition() + dataLength);
+
+                std::vector<ReplayKeyframe> keyframes;
+                SerialiseKeyframeIndex(fileSerializer, keyframes);
+                for (const auto& keyframe : keyframes)
+                {
+                    ticks.push_back(keyframe.tick);
+                }
+            }
+            catch (const std::exception& ex)
+            {
+                log_error("Unable to read keyframes: %s", ex.what());
+                return false;
+            }
+            return true;
+        }
+
         virtual bool NormaliseReplay(const std::string& file, const std::string& outFile) override
         {
             _mode = ReplayMode::NORMALISATION;
 
-            if (!StartPlayback(file))
+            if (!StartPlayback(file, 0, k_MaxReplayTicks))
             {
                 return false;
             }
@@ -515,17 +661,19 @@ namespace OpenRCT2
             }
         }
 
-        bool LoadReplayDataMap(ReplayRecordData& data)
+        bool LoadReplayDataMap(MemoryStream& parkData, MemoryStream& parkParams, MemoryStream& cheatData)
         {
             try
             {
-                data.parkData.SetPosition(0);
+                parkData.SetPosition(0);
+                parkParams.SetPosition(0);
+                cheatData.SetPosition(0);
 
                 auto context = GetContext();
                 auto& objManager = context->GetObjectManager();
                 auto importer = ParkImporter::CreateS6(context->GetObjectRepository());
 
-                auto loadResult = importer->LoadFromStream(&data.parkData, false);
+                auto loadResult = importer->LoadFromStream(&parkData, false);
                 objManager.LoadObjects(loadResult.RequiredObjects.data(), loadResult.RequiredObjects.size());
 
                 importer->Import();
@@ -533,13 +681,13 @@ namespace OpenRCT2
                 sprite_position_tween_reset();
 
                 // Load all map global variables.
-                DataSerialiser parkParamsDs(false, data.parkParams);
+                DataSerialiser parkParamsDs(false, parkParams);
                 SerialiseParkParameters(parkParamsDs);
 
                 // New cheats might not be serialised, make sure they are using their defaults.
                 CheatsReset();
 
-                DataSerialiser cheatDataDs(false, data.cheatData);
+                DataSerialiser cheatDataDs(false, cheatData);
                 SerialiseCheats(cheatDataDs);
 
                 game_load_init();
@@ -553,6 +701,31 @@ namespace OpenRCT2
             return true;
         }
 
+        bool LoadKeyframe(const ReplayKeyframe& keyframe)
+        {
+            MemoryStream parkData;
+            MemoryStream parkParams;
+            MemoryStream cheatData;
+            try
+            {
+                MemoryStream stream;
+                if (!Decompress(keyframe.data, keyframe.uncompressedSize, stream))
+                    return false;
+
+                stream.SetPosition(0);
+                DataSerialiser keyframeDs(false, stream);
+                keyframeDs << parkData;
+                keyframeDs << parkParams;
+                keyframeDs << cheatData;
+            }
+            catch (const std::exception& ex)
+            {
+                log_error("Exception: %s", ex.what());
+                return false;
+            }
+            return LoadReplayDataMap(parkData, parkParams, cheatData);
+        }
+
         bool ReadReplayFromFile(const std::string& file, MemoryStream& stream)
         {
             FILE* fp = fopen(file.c_str(), "rb");
@@ -577,7 +750,7 @@ namespace OpenRCT2
          * @param stream
          * @return
          */
-        bool TryDecompress(MemoryStream& stream)
+        bool TryDecompress(MemoryStream& stream, std::vector<ReplayKeyframe>& keyframes)
         {
             ReplayRecordFile recFile;
             stream.SetPosition(0);
@@ -590,22 +763,46 @@ namespace OpenRCT2
                 fileSerializer << recFile.uncompressedSize;
                 fileSerializer << recFile.data;
 
-                auto buff = std::make_unique<unsigned char[]>(recFile.uncompressedSize);
-                unsigned long outSize = recFile.uncompressedSize;
-                uncompress(
-                    static_cast<unsigned char*>(buff.get()), &outSize,
-                    static_cast<const unsigned char*>(recFile.data.GetData()), recFile.data.GetLength());
-                if (outSize != recFile.uncompressedSize)
+                if (recFile.version >= ReplayKeyframesVersion)
                 {
-                    return false;
+                    SerialiseKeyframes(fileSerializer, keyframes);
                 }
+
                 stream.SetPosition(0);
-                stream.Write(buff.get(), outSize);
+                if (!Decompress(recFile.data, recFile.uncompressedSize, stream))
+                {
+                    return false;
+                }
             }
 
             return true;
         }
 
+        static void Compress(const IStream& input, MemoryStream& output, int level)
+        {
+            unsigned long compressLength = compressBound(static_cast<unsigned long>(input.GetLength()));
+            auto compressBuf = std::make_unique<unsigned char[]>(compressLength);
+            compress2(
+                compressBuf.get(), &compressLength, static_cast<const unsigned char*>(input.GetData()), input.GetLength(),
+                level);
+            output.Write(compressBuf.get(), compressLength);
+        }
+
+        static bool Decompress(const MemoryStream& input, uint64_t uncompressedSize, MemoryStream& output)
+        {
+            auto buff = std::make_unique<unsigned char[]>(uncompressedSize);
+            unsigned long outSize = static_cast<unsigned long>(uncompressedSize);
+            uncompress(
+                static_cast<unsigned char*>(buff.get()), &outSize, static_cast<const unsigned char*>(input.GetData()),
+                input.GetLength());
+            if (outSize != uncompressedSize)
+            {
+                return false;
+            }
+            output.Write(buff.get(), outSize);
+            return true;
+        }
+
         bool ReadReplayData(const std::string& file, ReplayRecordData& data)
         {
             MemoryStream stream;
@@ -633,7 +830,7 @@ namespace OpenRCT2
             if (!loaded)
                 return false;
 
-            if (!TryDecompress(stream))
+            if (!TryDecompress(stream, data.keyframes))
                 return false;
 
             stream.SetPosition(0);
@@ -712,7 +909,36 @@ namespace OpenRCT2
 
         bool Compatible(ReplayRecordData& data)
         {
-            return data.version == ReplayVersion;
+            // Replays without keyframes only differ in the file, the data is the same.
+            return data.version >= ReplayMinimumVersion && data.version <= ReplayVersion;
+        }
+
+        // The index of every keyframe comes first so it can be read without going through the park data.
+        void SerialiseKeyframeIndex(DataSerialiser& serialiser, std::vector<ReplayKeyframe>& keyframes)
+        {
+            uint32_t countKeyframes = static_cast<uint32_t>(keyframes.size());
+            serialiser << countKeyframes;
+
+            if (serialiser.IsLoading())
+            {
+                keyframes.resize(countKeyframes);
+            }
+
+            for (auto& keyframe : keyframes)
+            {
+                serialiser << keyframe.tick;
+                serialiser << keyframe.commandIndex;
+                serialiser << keyframe.uncompressedSize;
+            }
+        }
+
+        void SerialiseKeyframes(DataSerialiser& serialiser, std::vector<ReplayKeyframe>& keyframes)
+        {
+            SerialiseKeyframeIndex(serialiser, keyframes);
+            for (auto& keyframe : keyframes)
+            {
+                serialiser << keyframe.data;
+            }
         }
 
         bool Serialise(DataSerialiser& serialiser, ReplayRecordData& data)
@@ -877,6 +1103,8 @@ namespace OpenRCT2
         uint32_t _commandId = 0;
         uint32_t _nextChecksumTick = 0;
         uint32_t _nextReplayTick = 0;
+        uint32_t _nextKeyframeTick = 0;
+        bool _compareEndSnapshot = true;
         RecordType _recordType = RecordType::NORMAL;
     };
 
@@ -14,6 +14,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 struct GameAction;
 
@@ -58,10 +59,19 @@ namespace OpenRCT2
         virtual bool StopRecording(bool discard = false) = 0;
         virtual bool GetCurrentReplayInfo(ReplayRecordInfo& info) const = 0;
 
-        virtual bool StartPlayback(const std::string& file) = 0;
+        /**
+         * Starts playing the replay, when startTick is past the start of the replay the game is loaded from the last
+         * keyframe before it and played up to startTick. Playback stops at endTick or at the end of the replay.
+         */
+        virtual bool StartPlayback(const std::string& file, uint32_t startTick = 0, uint32_t endTick = k_MaxReplayTicks) = 0;
         virtual bool IsPlaybackStateMismatching() const = 0;
         virtual bool StopPlayback() = 0;
 
+        /**
+         * Reads the ticks of the keyframes in the replay at the path file, without loading the replay itself.
+         */
+        virtual bool GetKeyframeTicks(const std::string& file, std::vector<uint32_t>& ticks) = 0;
+
         virtual bool NormaliseReplay(const std::string& inputFile, const std::string& outputFile) = 0;
     };
 
@@ -11,6 +11,7 @@
 
 #include "../Context.h"
 #include "../OpenRCT2.h"
+#include "../world/ParkAggregates.h"
 
 GuestSetFlagsAction::GuestSetFlagsAction(uint16_t peepId, uint32_t flags)
     : _peepId(peepId)
@@ -57,6 +58,7 @@ GameActions::Result::Ptr GuestSetFlagsAction::Execute() const
     }
 
     peep->PeepFlags = _newFlags;
+    park_aggregates_update_guest(peep);
 
     return std::make_unique<GameActions::Result>();
 }
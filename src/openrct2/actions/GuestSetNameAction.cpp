@@ -18,6 +18,7 @@
 #include "../localisation/StringIds.h"
 #include "../windows/Intent.h"
 #include "../world/Park.h"
+#include "../world/ParkAggregates.h"
 #include "../world/Sprite.h"
 
 GuestSetNameAction::GuestSetNameAction(uint16_t spriteIndex, const std::string& name)
@@ -93,6 +94,7 @@ GameActions::Result::Ptr GuestSetNameAction::Execute() const
 
     // Easter egg functions are for guests only
     guest->HandleEasterEggName();
+    park_aggregates_update_guest(guest);
 
     gfx_invalidate_screen();
 
@@ -327,8 +327,8 @@ GameActions::Result::Ptr LandSmoothAction::SmoothLand(bool isExecuting) const
     // Cap bounds to map
     auto l = std::max(normRange.GetLeft(), 32);
     auto t = std::max(normRange.GetTop(), 32);
-    auto r = std::clamp(normRange.GetRight(), 0, MAXIMUM_TILE_START_XY);
-    auto b = std::clamp(normRange.GetBottom(), 0, MAXIMUM_TILE_START_XY);
+    auto r = std::clamp(normRange.GetRight(), 0, map_get_size_big() - COORDS_XY_STEP);
+    auto b = std::clamp(normRange.GetBottom(), 0, map_get_size_big() - COORDS_XY_STEP);
     auto validRange = MapRange{ l, t, r, b };
 
     int32_t centreZ = tile_element_height(_coords);
@@ -29,6 +29,7 @@
 #include "../world/Location.hpp"
 #include "../world/Map.h"
 #include "../world/Park.h"
+#include "../world/ParkAggregates.h"
 #include "../world/Scenery.h"
 #include "../world/Sprite.h"
 #include "../world/Surface.h"
@@ -354,9 +355,9 @@ ParametersRange SetCheatAction::GetParameterRange(CheatType cheatType) const
 
 void SetCheatAction::SetGrassLength(int32_t length) const
 {
-    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    for (int32_t y = 0; y < gMapSizeTechnical; y++)
     {
-        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        for (int32_t x = 0; x < gMapSizeTechnical; x++)
         {
             auto surfaceElement = map_get_surface_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
             if (surfaceElement == nullptr)
@@ -566,6 +567,7 @@ void SetCheatAction::SetGuestParameter(int32_t parameter, int32_t value) const
                     peep->PeepFlags &= ~PEEP_FLAGS_ANGRY;
                     peep->Angriness = 0;
                 }
+                park_aggregates_update_guest(peep);
                 break;
             case GUEST_PARAMETER_ENERGY:
                 peep->Energy = value;
@@ -9,6 +9,7 @@
 
 #include "TileModifyAction.h"
 
+#include "../world/FootpathGraph.h"
 #include "../world/TileInspector.h"
 
 TileModifyAction::TileModifyAction(
@@ -219,6 +220,10 @@ GameActions::Result::Ptr TileModifyAction::QueryExecute(bool isExecuting) const
             return MakeResult(GameActions::Status::InvalidParameters, STR_NONE);
     }
 
+    // The inspector can change heights and element order directly.
+    if (isExecuting)
+        footpath_graph_invalidate_tile(_loc);
+
     res->Position.x = _loc.x;
     res->Position.y = _loc.y;
     res->Position.z = tile_element_height(_loc);
@@ -22,6 +22,7 @@
 #include "../localisation/StringIds.h"
 #include "../peep/Peep.h"
 #include "../ride/Ride.h"
+#include "../ride/Vehicle.h"
 #include "../ui/UiContext.h"
 #include "../util/Util.h"
 #include "AudioContext.h"
@@ -187,6 +188,10 @@ namespace OpenRCT2::Audio
         if (!IsAvailable())
             return;
 
+        // Trains updated ahead on worker threads play their sounds once they are committed in order.
+        if (vehicle_motion_defer_sound(soundId, loc))
+            return;
+
         AudioParams params = GetParametersFromLocation(soundId, loc);
         if (params.in_range)
         {
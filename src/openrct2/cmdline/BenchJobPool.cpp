@@ -0,0 +1,251 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../OpenRCT2.h"
+#    include "../core/JobPool.h"
+
+#    include <algorithm>
+#    include <atomic>
+#    include <benchmark/benchmark.h>
+#    include <condition_variable>
+#    include <deque>
+#    include <functional>
+#    include <mutex>
+#    include <thread>
+#    include <vector>
+
+/**
+ * The previous pool, a single queue behind one mutex where Join blocks instead of running tasks. Kept here only to
+ * compare against.
+ */
+class LegacyJobPool
+{
+private:
+    struct TaskData
+    {
+        std::function<void()> WorkFn;
+    };
+
+    std::atomic_bool _shouldStop = { false };
+    std::atomic<size_t> _processing = { 0 };
+    std::vector<std::thread> _threads;
+    std::deque<TaskData> _pending;
+    std::deque<TaskData> _completed;
+    std::condition_variable _condPending;
+    std::condition_variable _condComplete;
+    std::mutex _mutex;
+
+public:
+    LegacyJobPool()
+    {
+        for (size_t n = 0; n < std::thread::hardware_concurrency(); n++)
+        {
+            _threads.emplace_back(&LegacyJobPool::ProcessQueue, this);
+        }
+    }
+
+    ~LegacyJobPool()
+    {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _shouldStop = true;
+            _condPending.notify_all();
+        }
+        for (auto& th : _threads)
+        {
+            th.join();
+        }
+    }
+
+    void AddTask(std::function<void()> workFn)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _pending.push_back({ workFn });
+        _condPending.notify_one();
+    }
+
+    void Join()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true)
+        {
+            _condComplete.wait(lock, [this]() { return (_pending.empty() && _processing == 0) || !_completed.empty(); });
+            _completed.clear();
+            if (_pending.empty() && _processing == 0)
+            {
+                break;
+            }
+        }
+    }
+
+private:
+    void ProcessQueue()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        do
+        {
+            _condPending.wait(lock, [this]() { return _shouldStop || !_pending.empty(); });
+            if (!_pending.empty())
+            {
+                _processing++;
+                auto taskData = _pending.front();
+                _pending.pop_front();
+                lock.unlock();
+
+                taskData.WorkFn();
+
+                lock.lock();
+                _completed.push_back(taskData);
+                _processing--;
+                _condComplete.notify_one();
+            }
+        } while (!_shouldStop);
+    }
+};
+
+// Roughly the cost of filling a small paint column or reading a small object.
+static void bench_work(size_t item, size_t workSize, std::atomic<size_t>& sink)
+{
+    size_t value = item;
+    for (size_t i = 0; i < workSize; i++)
+    {
+        value = value * 2654435761u + i;
+    }
+    sink += value & 1;
+}
+
+// One task per item, the way viewport_paint used to add one task per column.
+template<typename TPool> static void BM_add_task_join(benchmark::State& state)
+{
+    TPool pool;
+    auto tasks = static_cast<size_t>(state.range(0));
+    auto workSize = static_cast<size_t>(state.range(1));
+    std::atomic<size_t> sink = { 0 };
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < tasks; i++)
+        {
+            pool.AddTask([i, workSize, &sink]() { bench_work(i, workSize, sink); });
+        }
+        pool.Join();
+    }
+    state.SetItemsProcessed(state.iterations() * tasks);
+}
+
+static void BM_parallel_for(benchmark::State& state)
+{
+    JobPool pool;
+    auto tasks = static_cast<size_t>(state.range(0));
+    auto workSize = static_cast<size_t>(state.range(1));
+    std::atomic<size_t> sink = { 0 };
+    for (auto _ : state)
+    {
+        pool.ParallelFor(tasks, [workSize, &sink](size_t i) { bench_work(i, workSize, sink); });
+    }
+    state.SetItemsProcessed(state.iterations() * tasks);
+}
+
+// What ObjectManager::ParallelFor used to do, new threads on every call.
+static void BM_parallel_for_threads(benchmark::State& state)
+{
+    auto tasks = static_cast<size_t>(state.range(0));
+    auto workSize = static_cast<size_t>(state.range(1));
+    std::atomic<size_t> sink = { 0 };
+    for (auto _ : state)
+    {
+        auto partitions = std::max<size_t>(1, std::thread::hardware_concurrency());
+        auto partitionSize = (tasks + (partitions - 1)) / partitions;
+        std::vector<std::thread> threads;
+        for (size_t n = 0; n < partitions; n++)
+        {
+            auto begin = n * partitionSize;
+            auto end = std::min(tasks, begin + partitionSize);
+            threads.emplace_back([begin, end, workSize, &sink]() {
+                for (size_t i = begin; i < end; i++)
+                {
+                    bench_work(i, workSize, sink);
+                }
+            });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * tasks);
+}
+
+static int cmdline_for_bench_job_pool(int argc, const char** argv)
+{
+    gOpenRCT2Headless = true;
+
+    // Arguments are the number of tasks and the amount of work per task.
+    auto addArgs = [](benchmark::internal::Benchmark* b) -> void {
+        b->Args({ 64, 64 })->Args({ 64, 2048 })->Args({ 100, 10000 });
+    };
+    benchmark::RegisterBenchmark("add_task_join_legacy", BM_add_task_join<LegacyJobPool>)->Apply(addArgs);
+    benchmark::RegisterBenchmark("add_task_join", BM_add_task_join<JobPool>)->Apply(addArgs);
+    benchmark::RegisterBenchmark("parallel_for", BM_parallel_for)->Apply(addArgs);
+    benchmark::RegisterBenchmark("parallel_for_threads", BM_parallel_for_threads)->Apply(addArgs);
+
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+    for (int i = 0; i < argc; i++)
+    {
+        argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+    }
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchJobPool(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = cmdline_for_bench_job_pool(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchJobPool(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchJobPoolCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "[--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_format=<console|json|csv>] "
+        "[--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>]",
+        nullptr, HandleBenchJobPool),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchJobPool), CommandTableEnd
+#endif // USE_BENCHMARK
+};
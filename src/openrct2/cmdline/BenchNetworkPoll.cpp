@@ -0,0 +1,273 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#if defined(USE_BENCHMARK) && !defined(DISABLE_NETWORK)
+
+#    include "../Context.h"
+#    include "../OpenRCT2.h"
+#    include "../network/Socket.h"
+
+#    include <atomic>
+#    include <benchmark/benchmark.h>
+#    include <chrono>
+#    include <cstring>
+#    include <random>
+#    include <thread>
+#    include <vector>
+
+static constexpr uint16_t BenchPort = 11790;
+
+using BenchClock = std::chrono::steady_clock;
+
+struct LoopbackClients
+{
+    std::unique_ptr<ITcpSocket> Listener;
+    // Client ends, used to send the data.
+    std::vector<std::unique_ptr<ITcpSocket>> Clients;
+    // Server ends, as returned by Accept.
+    std::vector<std::unique_ptr<ITcpSocket>> Connections;
+};
+
+static LoopbackClients connect_clients(size_t count)
+{
+    LoopbackClients result;
+    result.Listener = CreateTcpSocket();
+    result.Listener->Listen("127.0.0.1", BenchPort);
+    while (result.Connections.size() < count)
+    {
+        auto client = CreateTcpSocket();
+        client->Connect("127.0.0.1", BenchPort);
+        result.Clients.push_back(std::move(client));
+
+        std::unique_ptr<ITcpSocket> connection;
+        while ((connection = result.Listener->Accept()) == nullptr)
+        {
+            std::this_thread::yield();
+        }
+        result.Connections.push_back(std::move(connection));
+    }
+    return result;
+}
+
+static void send_timestamp(ITcpSocket& socket)
+{
+    int64_t timestamp = BenchClock::now().time_since_epoch().count();
+    socket.SendData(&timestamp, sizeof(timestamp));
+}
+
+/**
+ * Reads all pending timestamps, returns the number of messages and adds their latency. Loopback does not split
+ * the 8 byte messages so partial reads are not handled.
+ */
+static size_t receive_timestamps(ITcpSocket& socket, double& latencySum)
+{
+    int64_t buffer[64];
+    size_t received = 0;
+    size_t messages = 0;
+    while (socket.ReceiveData(buffer, sizeof(buffer), &received) == NetworkReadPacket::Success)
+    {
+        auto now = BenchClock::now().time_since_epoch().count();
+        for (size_t i = 0; i < received / sizeof(int64_t); i++)
+        {
+            latencySum += std::chrono::duration<double, std::micro>(BenchClock::duration(now - buffer[i])).count();
+            messages++;
+        }
+    }
+    return messages;
+}
+
+// The current loop, every connection is read from on every update.
+static size_t update_polling(LoopbackClients& clients, double& latencySum)
+{
+    size_t messages = 0;
+    for (auto& connection : clients.Connections)
+    {
+        messages += receive_timestamps(*connection, latencySum);
+    }
+    return messages;
+}
+
+static size_t update_event_driven(LoopbackClients& clients, ITcpSocketPoller& poller, uint32_t timeoutMs, double& latencySum)
+{
+    size_t messages = 0;
+    if (poller.Wait(timeoutMs))
+    {
+        for (auto& connection : clients.Connections)
+        {
+            if (poller.IsReadable(*connection))
+            {
+                messages += receive_timestamps(*connection, latencySum);
+            }
+        }
+    }
+    return messages;
+}
+
+// Cost of one server update with a single active client, the others are idle.
+static void BM_update_polling(benchmark::State& state)
+{
+    auto clients = connect_clients(static_cast<size_t>(state.range(0)));
+    size_t next = 0;
+    double latencySum = 0;
+    for (auto _ : state)
+    {
+        send_timestamp(*clients.Clients[next++ % clients.Clients.size()]);
+        while (update_polling(clients, latencySum) == 0)
+        {
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_update_event_driven(benchmark::State& state)
+{
+    auto clients = connect_clients(static_cast<size_t>(state.range(0)));
+    auto poller = CreateTcpSocketPoller();
+    for (auto& connection : clients.Connections)
+    {
+        poller->Add(*connection);
+    }
+
+    size_t next = 0;
+    double latencySum = 0;
+    for (auto _ : state)
+    {
+        send_timestamp(*clients.Clients[next++ % clients.Clients.size()]);
+        while (update_event_driven(clients, *poller, 0, latencySum) == 0)
+        {
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Every iteration is one game tick. A second thread plays the clients and sends a message roughly every millisecond,
+ * the latency is measured from sending until the server has read it.
+ */
+template<bool EventDriven> static void BM_tick_latency(benchmark::State& state)
+{
+    auto clients = connect_clients(static_cast<size_t>(state.range(0)));
+    auto poller = CreateTcpSocketPoller();
+    for (auto& connection : clients.Connections)
+    {
+        poller->Add(*connection);
+    }
+
+    std::atomic_bool stop{ false };
+    std::thread sender([&clients, &stop]() {
+        std::mt19937 rng(0x5EED);
+        std::uniform_int_distribution<size_t> pick(0, clients.Clients.size() - 1);
+        std::uniform_int_distribution<int32_t> delay(500, 1500);
+        while (!stop)
+        {
+            send_timestamp(*clients.Clients[pick(rng)]);
+            std::this_thread::sleep_for(std::chrono::microseconds(delay(rng)));
+        }
+    });
+
+    size_t messages = 0;
+    double latencySum = 0;
+    for (auto _ : state)
+    {
+        auto tickEnd = BenchClock::now() + std::chrono::milliseconds(GAME_UPDATE_TIME_MS);
+        if (EventDriven)
+        {
+            auto now = BenchClock::now();
+            while (now < tickEnd)
+            {
+                auto timeout = std::chrono::duration_cast<std::chrono::milliseconds>(tickEnd - now).count();
+                messages += update_event_driven(clients, *poller, static_cast<uint32_t>(timeout), latencySum);
+                now = BenchClock::now();
+            }
+        }
+        else
+        {
+            std::this_thread::sleep_until(tickEnd);
+            messages += update_polling(clients, latencySum);
+        }
+    }
+
+    stop = true;
+    sender.join();
+    update_polling(clients, latencySum);
+
+    state.counters["messages"] = static_cast<double>(messages);
+    state.counters["latency_us"] = messages == 0 ? 0 : latencySum / messages;
+}
+
+static int cmdline_for_bench_network_poll(int argc, const char** argv)
+{
+    gOpenRCT2Headless = true;
+
+    benchmark::RegisterBenchmark("update_polling", BM_update_polling)->Arg(100)->Arg(400);
+    benchmark::RegisterBenchmark("update_event_driven", BM_update_event_driven)->Arg(100)->Arg(400);
+    benchmark::RegisterBenchmark("tick_latency_polling", BM_tick_latency<false>)
+        ->Arg(100)
+        ->Arg(400)
+        ->Iterations(80)
+        ->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark("tick_latency_event_driven", BM_tick_latency<true>)
+        ->Arg(100)
+        ->Arg(400)
+        ->Iterations(80)
+        ->Unit(benchmark::kMillisecond);
+
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+    for (int i = 0; i < argc; i++)
+    {
+        argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+    }
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchNetworkPoll(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = cmdline_for_bench_network_poll(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchNetworkPoll(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK && !DISABLE_NETWORK
+
+const CommandLineCommand CommandLine::BenchNetworkPollCommands[]{
+#if defined(USE_BENCHMARK) && !defined(DISABLE_NETWORK)
+    DefineCommand(
+        "",
+        "[--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_format=<console|json|csv>] "
+        "[--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>]",
+        nullptr, HandleBenchNetworkPoll),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchNetworkPoll), CommandTableEnd
+#endif // USE_BENCHMARK && !DISABLE_NETWORK
+};
@@ -0,0 +1,179 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../OpenRCT2.h"
+#    include "../core/MemoryStream.h"
+#    include "../rct12/SawyerChunkReader.h"
+#    include "../util/SawyerCoding.h"
+#    include "../util/Util.h"
+
+#    include <benchmark/benchmark.h>
+#    include <random>
+#    include <string>
+#    include <vector>
+
+// Roughly what a map chunk looks like: long runs of the same element data between noisy stretches.
+static std::vector<uint8_t> bench_generate_data(size_t length)
+{
+    std::mt19937 random(5);
+    std::vector<uint8_t> data;
+    while (data.size() < length)
+    {
+        size_t span = 1 + random() % 256;
+        switch (random() % 3)
+        {
+            case 0:
+                data.insert(data.end(), span, static_cast<uint8_t>(random()));
+                break;
+            case 1:
+                for (size_t i = 0; i < span; i++)
+                    data.push_back(static_cast<uint8_t>(random()));
+                break;
+            default:
+                for (size_t i = 0; i < span && data.size() >= 16; i++)
+                    data.push_back(data[data.size() - 16]);
+                data.push_back(static_cast<uint8_t>(random()));
+                break;
+        }
+    }
+    data.resize(length);
+    return data;
+}
+
+static std::vector<uint8_t> bench_encode(const std::vector<uint8_t>& data, uint8_t encoding)
+{
+    sawyercoding_chunk_header header{ encoding, static_cast<uint32_t>(data.size()) };
+    std::vector<uint8_t> encodedData(data.size() * 3 + 64);
+    encodedData.resize(sawyercoding_write_chunk_buffer(encodedData.data(), data.data(), header));
+    return encodedData;
+}
+
+static void BM_encode(benchmark::State& state, const SawyerCodingFunctions* fns, uint8_t encoding)
+{
+    gSawyerCoding = fns;
+    auto data = bench_generate_data(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(bench_encode(data, encoding));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+    gSawyerCoding = &SawyerCodingScalar;
+}
+
+static void BM_decode(benchmark::State& state, const SawyerCodingFunctions* fns, uint8_t encoding)
+{
+    gSawyerCoding = fns;
+    auto data = bench_generate_data(static_cast<size_t>(state.range(0)));
+    auto encodedData = bench_encode(data, encoding);
+    std::vector<uint8_t> buffer(data.size());
+    for (auto _ : state)
+    {
+        OpenRCT2::MemoryStream ms(encodedData.data(), encodedData.size());
+        SawyerChunkReader reader(&ms);
+        reader.ReadChunk(buffer.data(), buffer.size());
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+    gSawyerCoding = &SawyerCodingScalar;
+}
+
+static void BM_checksum(benchmark::State& state, const SawyerCodingFunctions* fns)
+{
+    auto data = bench_generate_data(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(fns->CalculateChecksum(data.data(), data.size()));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+static int cmdline_for_bench_sawyer_coding(int argc, const char** argv)
+{
+    gOpenRCT2Headless = true;
+
+    std::vector<std::pair<std::string, const SawyerCodingFunctions*>> functionSets = { { "scalar", &SawyerCodingScalar } };
+    if (sse41_available())
+        functionSets.emplace_back("sse4_1", &SawyerCodingSSE41);
+    if (avx2_available())
+        functionSets.emplace_back("avx2", &SawyerCodingAVX2);
+
+    // The argument is the chunk size, the second one is about the size of the tile element chunk of a large park.
+    auto addArgs = [](benchmark::internal::Benchmark* b) -> void { b->Arg(64 * 1024)->Arg(4 * 1024 * 1024); };
+    for (const auto& [name, fns] : functionSets)
+    {
+        benchmark::RegisterBenchmark(("encode_rle/" + name).c_str(), BM_encode, fns, CHUNK_ENCODING_RLE)->Apply(addArgs);
+        benchmark::RegisterBenchmark(
+            ("encode_rle_compressed/" + name).c_str(), BM_encode, fns, CHUNK_ENCODING_RLECOMPRESSED)
+            ->Apply(addArgs);
+        benchmark::RegisterBenchmark(("encode_rotate/" + name).c_str(), BM_encode, fns, CHUNK_ENCODING_ROTATE)
+            ->Apply(addArgs);
+        benchmark::RegisterBenchmark(("decode_rle/" + name).c_str(), BM_decode, fns, CHUNK_ENCODING_RLE)->Apply(addArgs);
+        benchmark::RegisterBenchmark(
+            ("decode_rle_compressed/" + name).c_str(), BM_decode, fns, CHUNK_ENCODING_RLECOMPRESSED)
+            ->Apply(addArgs);
+        benchmark::RegisterBenchmark(("decode_rotate/" + name).c_str(), BM_decode, fns, CHUNK_ENCODING_ROTATE)
+            ->Apply(addArgs);
+        benchmark::RegisterBenchmark(("checksum/" + name).c_str(), BM_checksum, fns)->Apply(addArgs);
+    }
+
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+    for (int i = 0; i < argc; i++)
+    {
+        argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+    }
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchSawyerCoding(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = cmdline_for_bench_sawyer_coding(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchSawyerCoding(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchSawyerCodingCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "[--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_format=<console|json|csv>] "
+        "[--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>]",
+        nullptr, HandleBenchSawyerCoding),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchSawyerCoding), CommandTableEnd
+#endif // USE_BENCHMARK
+};
@@ -0,0 +1,162 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../GameState.h"
+#    include "../OpenRCT2.h"
+#    include "../core/Console.hpp"
+#    include "../platform/platform.h"
+#    include "../world/Sprite.h"
+
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <memory>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+static std::unique_ptr<IContext> _context;
+
+static size_t count_checksummed_sprites()
+{
+    size_t count = 0;
+    for (uint16_t i = 0; i < MAX_SPRITES; i++)
+    {
+        auto sprite = GetEntity(i);
+        if (sprite != nullptr && sprite->sprite_identifier != SpriteIdentifier::Null
+            && sprite->sprite_identifier != SpriteIdentifier::Misc)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+static void BM_sprite_checksum_sha1(benchmark::State& state)
+{
+    auto gameState = _context->GetGameState();
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        gameState->UpdateLogic();
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(sprite_checksum());
+    }
+    state.SetItemsProcessed(state.iterations() * count_checksummed_sprites());
+}
+
+static void BM_sprite_checksum_incremental_full(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        sprite_checksum_invalidate_all();
+        benchmark::DoNotOptimize(sprite_checksum_incremental());
+    }
+    state.SetItemsProcessed(state.iterations() * count_checksummed_sprites());
+}
+
+// Only the entities the tick moved or changed the state of are rehashed, like the server does every tick.
+static void BM_sprite_checksum_incremental_tick(benchmark::State& state)
+{
+    auto gameState = _context->GetGameState();
+    sprite_checksum_incremental();
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        gameState->UpdateLogic();
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(sprite_checksum_incremental());
+    }
+    state.SetItemsProcessed(state.iterations() * count_checksummed_sprites());
+}
+
+static int cmdline_for_bench_sprite_checksum(int argc, const char** argv)
+{
+    if (argc < 1)
+    {
+        Console::Error::WriteLine("Missing argument <sv6-file>.");
+        return -1;
+    }
+
+    core_init();
+    gOpenRCT2Headless = true;
+    _context = CreateContext();
+    if (!_context->Initialise() || !_context->LoadParkFromFile(argv[0]))
+    {
+        Console::Error::WriteLine("Unable to load park %s.", argv[0]);
+        _context = nullptr;
+        return -1;
+    }
+    argc--;
+    argv++;
+
+    // The ticks are simulated outside of the timing, the checksums are taken of the park as it is being played.
+    benchmark::RegisterBenchmark("sha1", BM_sprite_checksum_sha1);
+    benchmark::RegisterBenchmark("incremental_full", BM_sprite_checksum_incremental_full);
+    benchmark::RegisterBenchmark("incremental_tick", BM_sprite_checksum_incremental_tick);
+
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+    for (int i = 0; i < argc; i++)
+    {
+        argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+    }
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+    {
+        _context = nullptr;
+        return -1;
+    }
+    ::benchmark::RunSpecifiedBenchmarks();
+    _context = nullptr;
+    return 0;
+}
+
+static exitcode_t HandleBenchSpriteChecksum(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = cmdline_for_bench_sprite_checksum(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchSpriteChecksum(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchSpriteChecksumCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "<sv6-file> [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_format=<console|json|csv>] "
+        "[--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>]",
+        nullptr, HandleBenchSpriteChecksum),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchSpriteChecksum), CommandTableEnd
+#endif // USE_BENCHMARK
+};
@@ -118,6 +118,10 @@ namespace CommandLine
     extern const CommandLineCommand SpriteCommands[];
     extern const CommandLineCommand BenchGfxCommands[];
     extern const CommandLineCommand BenchSpriteSortCommands[];
+    extern const CommandLineCommand BenchSpriteChecksumCommands[];
+    extern const CommandLineCommand BenchNetworkPollCommands[];
+    extern const CommandLineCommand BenchJobPoolCommands[];
+    extern const CommandLineCommand BenchSawyerCodingCommands[];
     extern const CommandLineCommand SimulateCommands[];
 
     extern const CommandLineExample RootExamples[];
@@ -126,5 +130,6 @@ namespace CommandLine
     exitcode_t HandleCommandDefault();
 
     exitcode_t HandleCommandConvert(CommandLineArgEnumerator* enumerator);
+    exitcode_t HandleCommandRateDesigns(CommandLineArgEnumerator* enumerator);
     exitcode_t HandleCommandUri(CommandLineArgEnumerator* enumerator);
 } // namespace CommandLine
@@ -0,0 +1,139 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../OpenRCT2.h"
+#include "../core/Console.hpp"
+#include "../core/FileScanner.h"
+#include "../core/Json.hpp"
+#include "../core/Path.hpp"
+#include "../object/ObjectManager.h"
+#include "../platform/platform.h"
+#include "../ride/RideRatingService.h"
+#include "../ride/TrackDesign.h"
+#include "CommandLine.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+
+// Designs rated together, their vehicle objects are loaded at the same time so this stays below the ride object limit.
+static constexpr size_t RateDesignsChunkSize = 64;
+
+static json_t rate_designs_rating_to_json(ride_rating rating)
+{
+    if (rating == RIDE_RATING_UNDEFINED)
+        return nullptr;
+    return rating / 100.0;
+}
+
+static json_t rate_designs_result(const std::string& path, const TrackDesign& td, const RideRatingRequest& request)
+{
+    json_t result = { { "path", path }, { "name", td.name } };
+    result["stored"] = { { "excitement", td.excitement / 10.0 },
+                         { "intensity", td.intensity / 10.0 },
+                         { "nausea", td.nausea / 10.0 } };
+    if (!request.Rated)
+    {
+        result["error"] = "Unable to rate design";
+        return result;
+    }
+    result["computed"] = { { "excitement", rate_designs_rating_to_json(request.Ratings.Excitement) },
+                           { "intensity", rate_designs_rating_to_json(request.Ratings.Intensity) },
+                           { "nausea", rate_designs_rating_to_json(request.Ratings.Nausea) } };
+    return result;
+}
+
+/**
+ * Rates every track design in the directory and its sub directories on worker threads and prints the ratings stored in
+ * each design next to the ones calculated for it as JSON. The designs are not built in a park, the statistics the
+ * vehicles would measure are the ones stored in the design.
+ */
+exitcode_t CommandLine::HandleCommandRateDesigns(CommandLineArgEnumerator* enumerator)
+{
+    exitcode_t result = CommandLine::HandleCommandDefault();
+    if (result != EXITCODE_CONTINUE)
+    {
+        return result;
+    }
+
+    const utf8* rawDirectory;
+    if (!enumerator->TryPopString(&rawDirectory))
+    {
+        Console::Error::WriteLine("Expected a directory with track designs.");
+        return EXITCODE_FAIL;
+    }
+
+    utf8 directory[MAX_PATH];
+    Path::GetAbsolute(directory, sizeof(directory), rawDirectory);
+
+    core_init();
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    std::vector<std::string> paths;
+    auto scanner = std::unique_ptr<IFileScanner>(Path::ScanDirectory(Path::Combine(directory, "*.td6"), true));
+    while (scanner->Next())
+    {
+        paths.emplace_back(scanner->GetPath());
+    }
+
+    result = EXITCODE_OK;
+    json_t designs = json_t::array();
+    for (size_t chunkStart = 0; chunkStart < paths.size(); chunkStart += RateDesignsChunkSize)
+    {
+        auto chunkEnd = std::min(paths.size(), chunkStart + RateDesignsChunkSize);
+
+        // Designs are read and their rides built on this thread, only the ratings are calculated in parallel.
+        std::vector<std::string> chunkPaths;
+        std::vector<std::unique_ptr<TrackDesign>> chunkDesigns;
+        std::vector<RideRatingRequest> requests;
+        for (size_t i = chunkStart; i < chunkEnd; i++)
+        {
+            auto td = track_design_open(paths[i].c_str());
+            if (td == nullptr)
+            {
+                designs.push_back({ { "path", paths[i] }, { "error", "Unable to load design" } });
+                result = EXITCODE_FAIL;
+                continue;
+            }
+
+            object_manager_load_object(&td->vehicle_object);
+            requests.push_back(ride_rating_request_create(*td));
+            chunkPaths.push_back(paths[i]);
+            chunkDesigns.push_back(std::move(td));
+        }
+
+        ride_ratings_rate_batch(requests);
+
+        for (size_t i = 0; i < requests.size(); i++)
+        {
+            auto design = rate_designs_result(chunkPaths[i], *chunkDesigns[i], requests[i]);
+            if (design.contains("error"))
+            {
+                result = EXITCODE_FAIL;
+            }
+            designs.push_back(std::move(design));
+        }
+        object_manager_unload_all_objects();
+    }
+
+    json_t output = { { "directory", directory }, { "designs", designs } };
+    Console::WriteLine("%s", output.dump(4).c_str());
+    return result;
+}
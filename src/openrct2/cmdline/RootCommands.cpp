@@ -128,6 +128,7 @@ const CommandLineCommand CommandLine::RootCommands[]
 #endif
     DefineCommand("set-rct2", "<path>",                 StandardOptions, HandleCommandSetRCT2),
     DefineCommand("convert",  "<source> <destination>", StandardOptions, CommandLine::HandleCommandConvert),
+    DefineCommand("rate-designs", "<directory>",        StandardOptions, CommandLine::HandleCommandRateDesigns),
     DefineCommand("scan-objects", "<path>",             StandardOptions, HandleCommandScanObjects),
     DefineCommand("handle-uri", "openrct2://.../",      StandardOptions, CommandLine::HandleCommandUri),
 
@@ -140,6 +141,10 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("sprite",          CommandLine::SpriteCommands           ),
     DefineSubCommand("benchgfx",        CommandLine::BenchGfxCommands         ),
     DefineSubCommand("benchspritesort", CommandLine::BenchSpriteSortCommands  ),
+    DefineSubCommand("benchspritechecksum", CommandLine::BenchSpriteChecksumCommands),
+    DefineSubCommand("benchnetworkpoll", CommandLine::BenchNetworkPollCommands),
+    DefineSubCommand("benchjobpool", CommandLine::BenchJobPoolCommands),
+    DefineSubCommand("benchsawyercoding", CommandLine::BenchSawyerCodingCommands),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
     CommandTableEnd
 };
@@ -11,21 +11,58 @@
 #include "../Game.h"
 #include "../GameState.h"
 #include "../OpenRCT2.h"
+#include "../config/Config.h"
 #include "../core/Console.hpp"
+#include "../core/Json.hpp"
 #include "../network/network.h"
+#include "../peep/GuestPathfinding.h"
 #include "../platform/platform.h"
+#include "../ride/Vehicle.h"
 #include "../world/Sprite.h"
 #include "CommandLine.hpp"
 
+#include <array>
+#include <chrono>
 #include <cstdlib>
 #include <memory>
 
 using namespace OpenRCT2;
 
 static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleSimulateBenchmark(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleSimulateRides(CommandLineArgEnumerator* argEnumerator);
 
-const CommandLineCommand CommandLine::SimulateCommands[]{ // Main commands
-                                                          DefineCommand("", "<ticks>", nullptr, HandleSimulate), CommandTableEnd
+const CommandLineCommand CommandLine::SimulateCommands[]{
+    // Main commands
+    DefineCommand("benchmark", "<ticks> <sv6-file> [<sv6-file> ...]", nullptr, HandleSimulateBenchmark),
+    DefineCommand("rides", "<ticks> <sv6-file> [<sv6-file> ...]", nullptr, HandleSimulateRides),
+    DefineCommand("", "<ticks>", nullptr, HandleSimulate),
+    CommandTableEnd
+};
+
+static constexpr const std::array<const char*, static_cast<size_t>(LogicTimePart::Count)> LogicTimePartNames = {
+    "network_update",
+    "date_update",
+    "scenario_update",
+    "climate_update",
+    "map_update_tiles",
+    "map_remove_provisional_elements",
+    "map_update_path_wide_flags",
+    "peep_update_all",
+    "map_restore_provisional_elements",
+    "vehicle_update_all",
+    "sprite_misc_update_all",
+    "ride_update_all",
+    "park_update",
+    "research_update",
+    "ride_ratings_update_all",
+    "ride_measurements_update",
+    "news_update",
+    "map_animation_invalidate_all",
+    "sounds_update",
+    "game_actions_process_queue",
+    "network_flush",
+    "scripting_hooks",
 };
 
 static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
@@ -73,3 +110,183 @@ static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
 
     return EXITCODE_OK;
 }
+
+static json_t simulate_benchmark_park(IContext& context, const char* path, uint32_t ticks)
+{
+    json_t result = { { "park", path }, { "ticks", ticks } };
+    if (!context.LoadParkFromFile(path))
+    {
+        result["error"] = "Unable to load park";
+        return result;
+    }
+
+    LogicTimings timings;
+    auto gameState = context.GetGameState();
+    gPeepPathfindStats = {};
+    auto startTime = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < ticks; i++)
+    {
+        gameState->UpdateLogic(&timings);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - startTime;
+
+    result["seconds"] = elapsed.count();
+    result["ticks_per_second"] = elapsed.count() > 0 ? ticks / elapsed.count() : 0.0;
+    result["checksum"] = sprite_checksum().ToString();
+
+    json_t stages = json_t::object();
+    for (size_t i = 0; i < LogicTimePartNames.size(); i++)
+    {
+        auto seconds = timings.TimingInfo[i].count();
+        stages[LogicTimePartNames[i]] = { { "seconds", seconds },
+                                          { "share", elapsed.count() > 0 ? seconds / elapsed.count() : 0.0 } };
+    }
+    result["stages"] = stages;
+
+    const auto& stats = gPeepPathfindStats;
+    auto perTick = [ticks](uint64_t count) { return ticks > 0 ? static_cast<double>(count) / ticks : 0.0; };
+    result["pathfinding"] = {
+        { "choices", stats.Choices },
+        { "distance_field_hit_rate", stats.Choices > 0 ? static_cast<double>(stats.DistanceFieldHits) / stats.Choices : 0.0 },
+        { "distance_fields_built", stats.DistanceFieldsBuilt },
+        { "distance_field_tiles_per_tick", perTick(stats.DistanceFieldTilesScanned) },
+        { "heuristic_tiles_per_tick", perTick(stats.HeuristicTilesChecked) },
+    };
+    return result;
+}
+
+/**
+ * Runs every park for the given number of ticks without any network mode and prints the time spent in each stage of
+ * the game logic as JSON, so the results can be compared between builds.
+ */
+static exitcode_t HandleSimulateBenchmark(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    if (argc < 2)
+    {
+        Console::Error::WriteLine("Missing arguments <ticks> <sv6-file> [<sv6-file> ...].");
+        return EXITCODE_FAIL;
+    }
+
+    core_init();
+
+    uint32_t ticks = atol(argv[0]);
+
+    gOpenRCT2Headless = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    auto result = EXITCODE_OK;
+    json_t parks = json_t::array();
+    for (int32_t i = 1; i < argc; i++)
+    {
+        auto park = simulate_benchmark_park(*context, argv[i], ticks);
+        if (park.contains("error"))
+        {
+            result = EXITCODE_FAIL;
+        }
+        parks.push_back(std::move(park));
+    }
+
+    json_t output = { { "ticks", ticks }, { "parks", parks } };
+    Console::WriteLine("%s", output.dump(4).c_str());
+    return result;
+}
+
+static json_t simulate_rides_run(IContext& context, const char* path, uint32_t ticks, bool parallelRideMotion)
+{
+    json_t result = json_t::object();
+    if (!context.LoadParkFromFile(path))
+    {
+        result["error"] = "Unable to load park";
+        return result;
+    }
+
+    gConfigGeneral.parallel_ride_motion = parallelRideMotion;
+    gVehicleMotionStats = {};
+    LogicTimings timings;
+    auto gameState = context.GetGameState();
+    for (uint32_t i = 0; i < ticks; i++)
+    {
+        gameState->UpdateLogic(&timings);
+    }
+
+    const auto& stats = gVehicleMotionStats;
+    result["seconds"] = timings.TimingInfo[static_cast<size_t>(LogicTimePart::Vehicle)].count();
+    result["trains_per_tick"] = ticks > 0 ? static_cast<double>(stats.Trains) / ticks : 0.0;
+    result["run_ahead"] = stats.Trains > 0 ? static_cast<double>(stats.Speculated - stats.Aborted) / stats.Trains : 0.0;
+    result["aborted"] = stats.Speculated > 0 ? static_cast<double>(stats.Aborted) / stats.Speculated : 0.0;
+    result["checksum"] = sprite_checksum().ToString();
+    return result;
+}
+
+/**
+ * Runs every park twice from the saved state, with the trains updated one after another and with the trains of
+ * different rides updated on worker threads, and prints the time spent in vehicle_update_all for both as JSON. Meant for
+ * parks with many roller coasters, the final checksums have to match.
+ */
+static exitcode_t HandleSimulateRides(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    if (argc < 2)
+    {
+        Console::Error::WriteLine("Missing arguments <ticks> <sv6-file> [<sv6-file> ...].");
+        return EXITCODE_FAIL;
+    }
+
+    core_init();
+
+    uint32_t ticks = atol(argv[0]);
+
+    gOpenRCT2Headless = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    auto parallelRideMotion = gConfigGeneral.parallel_ride_motion;
+    auto result = EXITCODE_OK;
+    json_t parks = json_t::array();
+    for (int32_t i = 1; i < argc; i++)
+    {
+        auto serial = simulate_rides_run(*context, argv[i], ticks, false);
+        auto parallel = simulate_rides_run(*context, argv[i], ticks, true);
+        json_t park = { { "park", argv[i] }, { "ticks", ticks } };
+        if (serial.contains("error") || parallel.contains("error"))
+        {
+            park["error"] = "Unable to load park";
+            result = EXITCODE_FAIL;
+        }
+        else
+        {
+            double serialSeconds = serial["seconds"];
+            double parallelSeconds = parallel["seconds"];
+            park["speedup"] = parallelSeconds > 0 ? serialSeconds / parallelSeconds : 0.0;
+            park["checksums_match"] = serial["checksum"] == parallel["checksum"];
+            if (!park["checksums_match"])
+            {
+                result = EXITCODE_FAIL;
+            }
+            park["serial"] = std::move(serial);
+            park["parallel"] = std::move(parallel);
+        }
+        parks.push_back(std::move(park));
+    }
+    gConfigGeneral.parallel_ride_motion = parallelRideMotion;
+
+    json_t output = { { "ticks", ticks }, { "parks", parks } };
+    Console::WriteLine("%s", output.dump(4).c_str());
+    return result;
+}
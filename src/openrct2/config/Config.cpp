@@ -201,6 +201,12 @@ namespace Config
                 "scale_quality", ScaleQuality::SmoothNearestNeighbour, Enum_ScaleQuality);
             model->show_fps = reader->GetBoolean("show_fps", false);
             model->multithreading = reader->GetBoolean("multi_threading", false);
+            model->adaptive_viewport_strips = reader->GetBoolean("adaptive_viewport_strips", false);
+            model->parallel_entity_update = reader->GetBoolean("parallel_entity_update", false);
+            model->parallel_ride_motion = reader->GetBoolean("parallel_ride_motion", false);
+            model->legacy_peep_pathfinding = reader->GetBoolean("legacy_peep_pathfinding", false);
+            model->guest_distance_fields = reader->GetBoolean("guest_distance_fields", false);
+            model->background_saving = reader->GetBoolean("background_saving", true);
             model->trap_cursor = reader->GetBoolean("trap_cursor", false);
             model->auto_open_shops = reader->GetBoolean("auto_open_shops", false);
             model->scenario_select_mode = reader->GetInt32("scenario_select_mode", SCENARIO_SELECT_MODE_ORIGIN);
@@ -277,6 +283,12 @@ namespace Config
         writer->WriteEnum<ScaleQuality>("scale_quality", model->scale_quality, Enum_ScaleQuality);
         writer->WriteBoolean("show_fps", model->show_fps);
         writer->WriteBoolean("multi_threading", model->multithreading);
+        writer->WriteBoolean("adaptive_viewport_strips", model->adaptive_viewport_strips);
+        writer->WriteBoolean("parallel_entity_update", model->parallel_entity_update);
+        writer->WriteBoolean("parallel_ride_motion", model->parallel_ride_motion);
+        writer->WriteBoolean("legacy_peep_pathfinding", model->legacy_peep_pathfinding);
+        writer->WriteBoolean("guest_distance_fields", model->guest_distance_fields);
+        writer->WriteBoolean("background_saving", model->background_saving);
         writer->WriteBoolean("trap_cursor", model->trap_cursor);
         writer->WriteBoolean("auto_open_shops", model->auto_open_shops);
         writer->WriteInt32("scenario_select_mode", model->scenario_select_mode);
@@ -538,6 +550,7 @@ namespace Config
             auto model = &gConfigPlugin;
             model->enable_hot_reloading = reader->GetBoolean("enable_hot_reloading", false);
             model->allowed_hosts = reader->GetString("allowed_hosts", "");
+            model->tick_budget = reader->GetInt32("tick_budget", 0);
         }
     }
 
@@ -547,6 +560,7 @@ namespace Config
         writer->WriteSection("plugin");
         writer->WriteBoolean("enable_hot_reloading", model->enable_hot_reloading);
         writer->WriteString("allowed_hosts", model->allowed_hosts);
+        writer->WriteInt32("tick_budget", model->tick_budget);
     }
 
     static bool SetDefaults()
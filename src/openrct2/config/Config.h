@@ -41,6 +41,12 @@ struct GeneralConfiguration
     bool use_vsync;
     bool show_fps;
     bool multithreading;
+    bool adaptive_viewport_strips;
+    bool parallel_entity_update;
+    bool parallel_ride_motion;
+    bool legacy_peep_pathfinding;
+    bool guest_distance_fields;
+    bool background_saving;
     bool minimize_fullscreen_focus_loss;
     bool disable_screensaver;
 
@@ -205,6 +211,7 @@ struct PluginConfiguration
 {
     bool enable_hot_reloading;
     std::string allowed_hosts;
+    int32_t tick_budget;
 };
 
 enum SORT
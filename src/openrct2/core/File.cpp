@@ -19,6 +19,7 @@
 #include "FileStream.h"
 #include "String.hpp"
 
+#include <cstdio>
 #include <fstream>
 
 namespace File
@@ -43,6 +44,17 @@ namespace File
         return platform_file_move(srcPath.c_str(), dstPath.c_str());
     }
 
+    bool Replace(const std::string& srcPath, const std::string& dstPath)
+    {
+#ifdef _WIN32
+        auto srcPathW = String::ToWideChar(srcPath);
+        auto dstPathW = String::ToWideChar(dstPath);
+        return MoveFileExW(srcPathW.c_str(), dstPathW.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != FALSE;
+#else
+        return rename(srcPath.c_str(), dstPath.c_str()) == 0;
+#endif
+    }
+
     std::vector<uint8_t> ReadAllBytes(const std::string_view& path)
     {
         std::vector<uint8_t> result;
@@ -21,6 +21,8 @@ namespace File
     bool Copy(const std::string& srcPath, const std::string& dstPath, bool overwrite);
     bool Delete(const std::string& path);
     bool Move(const std::string& srcPath, const std::string& dstPath);
+    // Moves srcPath over dstPath in one step, dstPath is left as it was if that fails.
+    bool Replace(const std::string& srcPath, const std::string& dstPath);
     std::vector<uint8_t> ReadAllBytes(const std::string_view& path);
     std::string ReadAllText(const std::string_view& path);
     void WriteAllBytes(const std::string& path, const void* buffer, size_t length);
@@ -19,9 +19,9 @@
 #include "Path.hpp"
 
 #include <chrono>
-#include <list>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 template<typename TItem> class FileIndex
@@ -35,12 +35,19 @@ private:
         uint32_t PathChecksum = 0;
     };
 
+    struct FileRecord
+    {
+        std::string Path;
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
+    };
+
     struct ScanResult
     {
         DirectoryStats const Stats;
-        std::vector<std::string> const Files;
+        std::vector<FileRecord> const Files;
 
-        ScanResult(DirectoryStats stats, std::vector<std::string> files)
+        ScanResult(DirectoryStats stats, std::vector<FileRecord> files)
             : Stats(stats)
             , Files(files)
         {
@@ -55,11 +62,22 @@ private:
         uint8_t VersionB = 0;
         uint16_t LanguageId = 0;
         DirectoryStats Stats;
-        uint32_t NumItems = 0;
+        uint32_t NumFiles = 0;
+    };
+
+    /**
+     * A file as it was when the index was built and the item created from it, if any. Files that have not been
+     * modified since are not loaded again.
+     */
+    struct IndexedFile
+    {
+        FileRecord Record;
+        bool HasItem = false;
+        TItem Item;
     };
 
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t FILE_INDEX_VERSION = 4;
+    static constexpr uint8_t FILE_INDEX_VERSION = 5;
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -95,32 +113,27 @@ public:
     virtual ~FileIndex() = default;
 
     /**
-     * Queries and directories and loads the index header. If the index is up to date,
-     * the items are loaded from the index and returned, otherwise the index is rebuilt.
+     * Queries and directories and loads the index. If the index is up to date, the items are loaded from the index
+     * and returned, otherwise only the files added or modified since the index was written are loaded again.
      */
     std::vector<TItem> LoadOrBuild(int32_t language) const
     {
-        std::vector<TItem> items;
         auto scanResult = Scan();
         auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
+        auto& indexedFiles = std::get<1>(readIndexResult);
         if (std::get<0>(readIndexResult))
         {
-            // Index was loaded
-            items = std::get<1>(readIndexResult);
-        }
-        else
-        {
-            // Index was not loaded
-            items = Build(language, scanResult);
+            // Directory is the same, just use the saved items
+            return GetItems(indexedFiles);
         }
-        return items;
+        return Build(language, scanResult, indexedFiles);
     }
 
     std::vector<TItem> Rebuild(int32_t language) const
     {
         auto scanResult = Scan();
-        auto items = Build(language, scanResult);
-        return items;
+        std::vector<IndexedFile> indexedFiles;
+        return Build(language, scanResult, indexedFiles);
     }
 
 protected:
@@ -139,7 +152,7 @@ private:
     ScanResult Scan() const
     {
         DirectoryStats stats{};
-        std::vector<std::string> files;
+        std::vector<FileRecord> files;
         for (const auto& directory : SearchPaths)
         {
             auto absoluteDirectory = Path::GetAbsolute(directory);
@@ -152,7 +165,7 @@ private:
                 auto fileInfo = scanner->GetFileInfo();
                 auto path = std::string(scanner->GetPath());
 
-                files.push_back(path);
+                files.push_back({ path, fileInfo->Size, fileInfo->LastModified });
 
                 stats.TotalFiles++;
                 stats.TotalFileSize += fileInfo->Size;
@@ -167,13 +180,13 @@ private:
     }
 
     void BuildRange(
-        int32_t language, const ScanResult& scanResult, size_t rangeStart, size_t rangeEnd, std::vector<TItem>& items,
-        std::atomic<size_t>& processed, std::mutex& printLock) const
+        int32_t language, const std::vector<size_t>& modifiedFiles, size_t rangeStart, size_t rangeEnd,
+        std::vector<IndexedFile>& files, std::atomic<size_t>& processed, std::mutex& printLock) const
     {
-        items.reserve(rangeEnd - rangeStart);
         for (size_t i = rangeStart; i < rangeEnd; i++)
         {
-            const auto& filePath = scanResult.Files.at(i);
+            auto& file = files[modifiedFiles[i]];
+            const auto& filePath = file.Record.Path;
 
             if (_log_levels[static_cast<uint8_t>(DiagnosticLevel::Verbose)])
             {
@@ -182,30 +195,57 @@ private:
             }
 
             auto item = Create(language, filePath);
-            if (std::get<0>(item))
+            file.HasItem = std::get<0>(item);
+            if (file.HasItem)
             {
-                items.push_back(std::get<1>(item));
+                file.Item = std::move(std::get<1>(item));
             }
 
             processed++;
         }
     }
 
-    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
+    /**
+     * Creates the items for the files that are not in indexedFiles or have been modified since, the items of the
+     * other files are reused. Files that no longer exist are dropped from the index.
+     */
+    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult, std::vector<IndexedFile>& indexedFiles) const
     {
-        std::vector<TItem> allItems;
-        Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
+        std::unordered_map<std::string, IndexedFile*> indexedFilesByPath;
+        for (auto& indexedFile : indexedFiles)
+        {
+            indexedFilesByPath[indexedFile.Record.Path] = &indexedFile;
+        }
+
+        std::vector<IndexedFile> files(scanResult.Files.size());
+        std::vector<size_t> modifiedFiles;
+        for (size_t i = 0; i < scanResult.Files.size(); i++)
+        {
+            const auto& record = scanResult.Files[i];
+            auto it = indexedFilesByPath.find(record.Path);
+            if (it != indexedFilesByPath.end() && it->second->Record.Size == record.Size
+                && it->second->Record.LastModified == record.LastModified)
+            {
+                files[i] = std::move(*it->second);
+                indexedFilesByPath.erase(it);
+            }
+            else
+            {
+                files[i].Record = record;
+                modifiedFiles.push_back(i);
+            }
+        }
+        size_t reusedCount = files.size() - modifiedFiles.size();
+        Console::WriteLine("Building %s (%zu items)", _name.c_str(), modifiedFiles.size());
 
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        const size_t totalCount = scanResult.Files.size();
+        const size_t totalCount = modifiedFiles.size();
         if (totalCount > 0)
         {
             JobPool jobPool;
             std::mutex printLock; // For verbose prints.
 
-            std::list<std::vector<TItem>> containers;
-
             size_t stepSize = 100; // Handpicked, seems to work well with 4/8 cores.
 
             std::atomic<size_t> processed = ATOMIC_VAR_INIT(0);
@@ -222,36 +262,61 @@ private:
                     stepSize = totalCount - rangeStart;
                 }
 
-                auto& items = containers.emplace_back();
-
                 jobPool.AddTask(std::bind(
-                    &FileIndex<TItem>::BuildRange, this, language, std::cref(scanResult), rangeStart, rangeStart + stepSize,
-                    std::ref(items), std::ref(processed), std::ref(printLock)));
+                    &FileIndex<TItem>::BuildRange, this, language, std::cref(modifiedFiles), rangeStart,
+                    rangeStart + stepSize, std::ref(files), std::ref(processed), std::ref(printLock)));
 
                 reportProgress();
             }
 
             jobPool.Join(reportProgress);
-
-            for (auto&& itr : containers)
-            {
-                allItems.insert(allItems.end(), itr.begin(), itr.end());
-            }
         }
 
-        WriteIndexFile(language, scanResult.Stats, allItems);
+        WriteIndexFile(language, scanResult.Stats, files);
 
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration<float>(endTime - startTime);
-        Console::WriteLine("Finished building %s in %.2f seconds.", _name.c_str(), duration.count());
+        Console::WriteLine(
+            "Finished building %s in %.2f seconds, reused %zu and re-parsed %zu entries.", _name.c_str(), duration.count(),
+            reusedCount, totalCount);
 
-        return allItems;
+        return GetItems(files);
     }
 
-    std::tuple<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    static std::vector<TItem> GetItems(std::vector<IndexedFile>& files)
     {
-        bool loadedItems = false;
         std::vector<TItem> items;
+        items.reserve(files.size());
+        for (auto& file : files)
+        {
+            if (file.HasItem)
+            {
+                items.push_back(std::move(file.Item));
+            }
+        }
+        return items;
+    }
+
+    void SerialiseFile(DataSerialiser& ds, IndexedFile& file) const
+    {
+        ds << file.Record.Path;
+        ds << file.Record.Size;
+        ds << file.Record.LastModified;
+        ds << file.HasItem;
+        if (file.HasItem)
+        {
+            Serialise(ds, file.Item);
+        }
+    }
+
+    /**
+     * Reads the files saved in the index, returns whether the directories are the same as when the index was written
+     * and the files. No files are returned if the index was written by a different version or for another language.
+     */
+    std::tuple<bool, std::vector<IndexedFile>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    {
+        bool isUpToDate = false;
+        std::vector<IndexedFile> files;
         if (File::Exists(_indexPath))
         {
             try
@@ -259,26 +324,24 @@ private:
                 log_verbose("FileIndex:Loading index: '%s'", _indexPath.c_str());
                 auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_OPEN);
 
-                // Read header, check if we need to re-scan
+                // Read header, check if the saved items can be used
                 auto header = fs.ReadValue<FileIndexHeader>();
                 if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
+                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language)
                 {
-                    items.reserve(header.NumItems);
+                    files.resize(header.NumFiles);
                     DataSerialiser ds(false, fs);
-                    // Directory is the same, just read the saved items
-                    for (uint32_t i = 0; i < header.NumItems; i++)
+                    for (auto& file : files)
                     {
-                        TItem item;
-                        Serialise(ds, item);
-                        items.emplace_back(std::move(item));
+                        SerialiseFile(ds, file);
                     }
-                    loadedItems = true;
+
+                    isUpToDate = header.Stats.TotalFiles == stats.TotalFiles
+                        && header.Stats.TotalFileSize == stats.TotalFileSize
+                        && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
+                        && header.Stats.PathChecksum == stats.PathChecksum;
                 }
-                else
+                if (!isUpToDate)
                 {
                     Console::WriteLine("%s out of date", _name.c_str());
                 }
@@ -287,40 +350,55 @@ private:
             {
                 Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
                 Console::Error::WriteLine("%s", e.what());
+                files.clear();
             }
         }
-        return std::make_tuple(loadedItems, std::move(items));
+        return std::make_tuple(isUpToDate, std::move(files));
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, std::vector<TItem>& items) const
+    /**
+     * Writes the index next to the old one first and then replaces it, so the old index is kept if writing fails.
+     */
+    void WriteIndexFile(int32_t language, const DirectoryStats& stats, std::vector<IndexedFile>& files) const
     {
+        auto tempPath = _indexPath + ".tmp";
         try
         {
             log_verbose("FileIndex:Writing index: '%s'", _indexPath.c_str());
             Path::CreateDirectory(Path::GetDirectory(_indexPath));
-            auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_WRITE);
-
-            // Write header
-            FileIndexHeader header;
-            header.MagicNumber = _magicNumber;
-            header.VersionA = FILE_INDEX_VERSION;
-            header.VersionB = _version;
-            header.LanguageId = language;
-            header.Stats = stats;
-            header.NumItems = static_cast<uint32_t>(items.size());
-            fs.WriteValue(header);
-
-            DataSerialiser ds(true, fs);
-            // Write items
-            for (auto& item : items)
             {
-                Serialise(ds, item);
+                auto fs = OpenRCT2::FileStream(tempPath, OpenRCT2::FILE_MODE_WRITE);
+
+                // Write header
+                FileIndexHeader header;
+                header.MagicNumber = _magicNumber;
+                header.VersionA = FILE_INDEX_VERSION;
+                header.VersionB = _version;
+                header.LanguageId = language;
+                header.Stats = stats;
+                header.NumFiles = static_cast<uint32_t>(files.size());
+                fs.WriteValue(header);
+
+                DataSerialiser ds(true, fs);
+                // Write files
+                for (auto& file : files)
+                {
+                    SerialiseFile(ds, file);
+                }
+            }
+            if (!File::Replace(tempPath, _indexPath))
+            {
+                throw IOException("Unable to replace " + _indexPath);
             }
         }
         catch (const std::exception& e)
         {
             Console::Error::WriteLine("Unable to save index: '%s'.", _indexPath.c_str());
             Console::Error::WriteLine("%s", e.what());
+            if (File::Exists(tempPath))
+            {
+                File::Delete(tempPath);
+            }
         }
     }
 
@@ -9,9 +9,46 @@
 
 #include "JobPool.h"
 
-#include <algorithm>
 #include <cassert>
 
+// The pool and queue index of the current thread if it is a worker.
+static thread_local JobPool* _currentPool = nullptr;
+static thread_local size_t _currentQueue = 0;
+
+bool JobPool::TaskQueue::Push(const Task& task)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_count == Capacity)
+        return false;
+
+    _tasks[(_head + _count) % Capacity] = task;
+    _count++;
+    return true;
+}
+
+bool JobPool::TaskQueue::Pop(Task& task)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_count == 0)
+        return false;
+
+    _count--;
+    task = _tasks[(_head + _count) % Capacity];
+    return true;
+}
+
+bool JobPool::TaskQueue::Steal(Task& task)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_count == 0)
+        return false;
+
+    task = _tasks[_head];
+    _head = (_head + 1) % Capacity;
+    _count--;
+    return true;
+}
+
 JobPool::TaskData::TaskData(std::function<void()> workFn, std::function<void()> completionFn)
     : WorkFn(workFn)
     , CompletionFn(completionFn)
@@ -23,7 +60,11 @@ JobPool::JobPool(size_t maxThreads)
     maxThreads = std::min<size_t>(maxThreads, std::thread::hardware_concurrency());
     for (size_t n = 0; n < maxThreads; n++)
     {
-        _threads.emplace_back(&JobPool::ProcessQueue, this);
+        _queues.push_back(std::make_unique<TaskQueue>());
+    }
+    for (size_t n = 0; n < maxThreads; n++)
+    {
+        _threads.emplace_back(&JobPool::ProcessQueue, this, n);
     }
 }
 
@@ -44,9 +85,14 @@ JobPool::~JobPool()
 
 void JobPool::AddTask(std::function<void()> workFn, std::function<void()> completionFn)
 {
-    unique_lock lock(_mutex);
-    _pending.emplace_back(workFn, completionFn);
-    _condPending.notify_one();
+    TaskData* taskData;
+    {
+        unique_lock lock(_mutex);
+        taskData = &_taskData.emplace_back(workFn, completionFn);
+    }
+
+    auto runTaskData = [](void* context, size_t, size_t) -> void { static_cast<TaskData*>(context)->WorkFn(); };
+    Submit({ runTaskData, taskData, 0, 0, &_remaining });
 }
 
 void JobPool::Join(std::function<void()> reportFn)
@@ -54,8 +100,16 @@ void JobPool::Join(std::function<void()> reportFn)
     unique_lock lock(_mutex);
     while (true)
     {
-        // Wait for the queue to become empty or having completed tasks.
-        _condComplete.wait(lock, [this]() { return (_pending.empty() && _processing == 0) || !_completed.empty(); });
+        // Help with the queued tasks, only wait when there is nothing left to run on this thread.
+        lock.unlock();
+        bool ranTask = RunNext();
+        lock.lock();
+
+        if (!ranTask)
+        {
+            // Wait for the queue to become empty or having completed tasks.
+            _condComplete.wait(lock, [this]() { return _remaining == 0 || !_completed.empty(); });
+        }
 
         // Dispatch all completion callbacks if there are any.
         while (!_completed.empty())
@@ -63,11 +117,11 @@ void JobPool::Join(std::function<void()> reportFn)
             auto taskData = _completed.front();
             _completed.pop_front();
 
-            if (taskData.CompletionFn)
+            if (taskData->CompletionFn)
             {
                 lock.unlock();
 
-                taskData.CompletionFn();
+                taskData->CompletionFn();
 
                 lock.lock();
             }
@@ -83,8 +137,9 @@ void JobPool::Join(std::function<void()> reportFn)
         }
 
         // If everything is empty and no more work has to be done we can stop waiting.
-        if (_completed.empty() && _pending.empty() && _processing == 0)
+        if (_completed.empty() && _remaining == 0)
         {
+            _taskData.clear();
             break;
         }
     }
@@ -92,34 +147,107 @@ void JobPool::Join(std::function<void()> reportFn)
 
 size_t JobPool::CountPending()
 {
-    return _pending.size();
+    return _queued;
 }
 
-void JobPool::ProcessQueue()
+void JobPool::Submit(const Task& task)
 {
-    unique_lock lock(_mutex);
-    do
+    task.Remaining->fetch_add(1);
+
+    // Counted before it is queued so a worker taking it right away never sees the count wrap.
+    _queued++;
+    bool queued = false;
+    if (!_queues.empty())
+    {
+        auto index = _currentPool == this ? _currentQueue : _nextQueue++ % _queues.size();
+        queued = _queues[index]->Push(task);
+    }
+    if (!queued)
     {
-        // Wait for work or cancelation.
-        _condPending.wait(lock, [this]() { return _shouldStop || !_pending.empty(); });
+        // No workers or the queue is full, run the task right away.
+        _queued--;
+        Run(task);
+        return;
+    }
 
-        if (!_pending.empty())
+    if (_sleeping > 0)
+    {
+        unique_lock lock(_mutex);
+        _condPending.notify_one();
+    }
+}
+
+void JobPool::Wait(const std::atomic<size_t>& remaining)
+{
+    while (remaining > 0)
+    {
+        if (!RunNext())
         {
-            _processing++;
+            unique_lock lock(_mutex);
+            _condComplete.wait(lock, [&remaining]() { return remaining == 0; });
+        }
+    }
+}
 
-            auto taskData = _pending.front();
-            _pending.pop_front();
+bool JobPool::RunNext()
+{
+    if (_queues.empty())
+        return false;
 
-            lock.unlock();
+    Task task;
+    bool isWorker = _currentPool == this;
+    if (isWorker && _queues[_currentQueue]->Pop(task))
+    {
+        _queued--;
+        Run(task);
+        return true;
+    }
 
-            taskData.WorkFn();
+    // Steal from the other queues, starting at a different queue for every thread.
+    auto start = isWorker ? _currentQueue + 1 : _nextQueue.load();
+    for (size_t i = 0; i < _queues.size(); i++)
+    {
+        if (_queues[(start + i) % _queues.size()]->Steal(task))
+        {
+            _queued--;
+            Run(task);
+            return true;
+        }
+    }
+    return false;
+}
 
-            lock.lock();
+void JobPool::Run(const Task& task)
+{
+    task.Fn(task.Context, task.Begin, task.End);
 
-            _completed.push_back(taskData);
+    if (task.Remaining == &_remaining)
+    {
+        unique_lock lock(_mutex);
+        _completed.push_back(static_cast<TaskData*>(task.Context));
+        _remaining--;
+        _condComplete.notify_all();
+    }
+    else if (--(*task.Remaining) == 0)
+    {
+        unique_lock lock(_mutex);
+        _condComplete.notify_all();
+    }
+}
 
-            _processing--;
-            _condComplete.notify_one();
-        }
-    } while (!_shouldStop);
+void JobPool::ProcessQueue(size_t index)
+{
+    _currentPool = this;
+    _currentQueue = index;
+
+    while (!_shouldStop)
+    {
+        if (RunNext())
+            continue;
+
+        unique_lock lock(_mutex);
+        _sleeping++;
+        _condPending.wait(lock, [this]() { return _shouldStop || _queued > 0; });
+        _sleeping--;
+    }
 }
@@ -9,17 +9,51 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
+/**
+ * Work-stealing thread pool. Every worker owns a fixed size task queue, it runs its own tasks newest first and steals
+ * the oldest tasks of other workers when its own queue is empty. Threads that wait for tasks to finish run queued
+ * tasks themselves instead of blocking.
+ */
 class JobPool
 {
 private:
+    struct Task
+    {
+        void (*Fn)(void* context, size_t begin, size_t end);
+        void* Context;
+        size_t Begin;
+        size_t End;
+        std::atomic<size_t>* Remaining;
+    };
+
+    class TaskQueue
+    {
+    public:
+        static constexpr size_t Capacity = 256;
+
+        bool Push(const Task& task);
+        bool Pop(Task& task);
+        bool Steal(Task& task);
+
+    private:
+        std::mutex _mutex;
+        std::array<Task, Capacity> _tasks{};
+        size_t _head = 0;
+        size_t _count = 0;
+    };
+
     struct TaskData
     {
         const std::function<void()> WorkFn;
@@ -29,10 +63,17 @@ private:
     };
 
     std::atomic_bool _shouldStop = { false };
-    std::atomic<size_t> _processing = { 0 };
+    std::atomic<size_t> _queued = { 0 };
+    std::atomic<size_t> _sleeping = { 0 };
+    std::atomic<size_t> _nextQueue = { 0 };
+    std::vector<std::unique_ptr<TaskQueue>> _queues;
     std::vector<std::thread> _threads;
-    std::deque<TaskData> _pending;
-    std::deque<TaskData> _completed;
+
+    // Tasks added with AddTask, they are kept until Join has dispatched their completion.
+    std::atomic<size_t> _remaining = { 0 };
+    std::deque<TaskData> _taskData;
+    std::deque<TaskData*> _completed;
+
     std::condition_variable _condPending;
     std::condition_variable _condComplete;
     std::mutex _mutex;
@@ -47,6 +88,44 @@ public:
     void Join(std::function<void()> reportFn = nullptr);
     size_t CountPending();
 
+    /**
+     * Calls func(i) for every i in [0, count) and returns once all calls have finished. The range is split in chunks of
+     * at least grainSize items, the calling thread runs chunks as well. Does not allocate.
+     */
+    template<typename TFunc> void ParallelFor(size_t count, TFunc&& func, size_t grainSize = 1)
+    {
+        using TFuncType = std::remove_reference_t<TFunc>;
+        if (count == 0)
+            return;
+
+        // A few chunks per thread so threads that finish early can steal some of the remaining work.
+        size_t maxChunks = (_threads.size() + 1) * 4;
+        grainSize = std::max<size_t>(grainSize, 1);
+        size_t chunkCount = std::min(maxChunks, (count + grainSize - 1) / grainSize);
+        size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+
+        auto runRange = [](void* context, size_t begin, size_t end) -> void {
+            auto& fn = *static_cast<TFuncType*>(context);
+            for (size_t i = begin; i < end; i++)
+            {
+                fn(i);
+            }
+        };
+        auto context = const_cast<void*>(static_cast<const void*>(std::addressof(func)));
+
+        std::atomic<size_t> remaining = { 0 };
+        for (size_t begin = chunkSize; begin < count; begin += chunkSize)
+        {
+            Submit({ runRange, context, begin, std::min(count, begin + chunkSize), &remaining });
+        }
+        runRange(context, 0, std::min(count, chunkSize));
+        Wait(remaining);
+    }
+
 private:
-    void ProcessQueue();
+    void Submit(const Task& task);
+    void Wait(const std::atomic<size_t>& remaining);
+    bool RunNext();
+    void Run(const Task& task);
+    void ProcessQueue(size_t index);
 };
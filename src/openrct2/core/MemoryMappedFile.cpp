@@ -0,0 +1,119 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "MemoryMappedFile.h"
+
+#include "IStream.hpp"
+#include "String.hpp"
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace OpenRCT2
+{
+#ifdef _WIN32
+    MemoryMappedFile::MemoryMappedFile(const std::string& path)
+    {
+        auto pathW = String::ToWideChar(path);
+        auto file = CreateFileW(
+            pathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw IOException("Unable to open " + path);
+        }
+        _file = file;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize))
+        {
+            CloseHandle(file);
+            throw IOException("Unable to get size of " + path);
+        }
+        _length = static_cast<size_t>(fileSize.QuadPart);
+        if (_length == 0)
+        {
+            return;
+        }
+
+        _mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (_mapping != nullptr)
+        {
+            _data = static_cast<const uint8_t*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+        }
+        if (_data == nullptr)
+        {
+            if (_mapping != nullptr)
+            {
+                CloseHandle(_mapping);
+            }
+            CloseHandle(file);
+            throw IOException("Unable to map " + path);
+        }
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (_data != nullptr)
+        {
+            UnmapViewOfFile(_data);
+        }
+        if (_mapping != nullptr)
+        {
+            CloseHandle(_mapping);
+        }
+        CloseHandle(_file);
+    }
+#else
+    MemoryMappedFile::MemoryMappedFile(const std::string& path)
+    {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            throw IOException("Unable to open " + path);
+        }
+
+        struct stat buf;
+        if (fstat(fd, &buf) != 0)
+        {
+            close(fd);
+            throw IOException("Unable to get size of " + path);
+        }
+        _length = static_cast<size_t>(buf.st_size);
+        if (_length == 0)
+        {
+            close(fd);
+            return;
+        }
+
+        // The mapping stays valid after the file is closed.
+        void* data = mmap(nullptr, _length, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED)
+        {
+            throw IOException("Unable to map " + path);
+        }
+        _data = static_cast<const uint8_t*>(data);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (_data != nullptr)
+        {
+            munmap(const_cast<uint8_t*>(_data), _length);
+        }
+    }
+#endif
+
+} // namespace OpenRCT2
@@ -0,0 +1,49 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <string>
+
+namespace OpenRCT2
+{
+    /**
+     * A read only view of a whole file. Pages are only read when they are first accessed and are shared with every
+     * other process that maps the same file.
+     */
+    class MemoryMappedFile final
+    {
+    private:
+#ifdef _WIN32
+        void* _file = nullptr;
+        void* _mapping = nullptr;
+#endif
+        const uint8_t* _data = nullptr;
+        size_t _length = 0;
+
+    public:
+        explicit MemoryMappedFile(const std::string& path);
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+        ~MemoryMappedFile();
+
+        const uint8_t* GetData() const
+        {
+            return _data;
+        }
+
+        size_t GetLength() const
+        {
+            return _length;
+        }
+    };
+
+} // namespace OpenRCT2
@@ -11,16 +11,21 @@
 #include "../OpenRCT2.h"
 #include "../PlatformEnvironment.h"
 #include "../config/Config.h"
+#include "../core/File.h"
 #include "../core/FileStream.h"
+#include "../core/MemoryMappedFile.h"
 #include "../core/Path.hpp"
 #include "../platform/platform.h"
 #include "../sprites.h"
 #include "../ui/UiContext.h"
 #include "../util/Util.h"
 #include "Drawing.h"
+#include "Font.h"
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <vector>
 
@@ -182,10 +187,59 @@ static rct_gx _g2 = {};
 static rct_gx _csg = {};
 static bool _csgLoaded = false;
 
+// Set when the element data points into a mapping of the file rather than a copy.
+static std::unique_ptr<MemoryMappedFile> _g1Mapping;
+static std::unique_ptr<MemoryMappedFile> _g2Mapping;
+static std::unique_ptr<MemoryMappedFile> _csgMapping;
+
+// Set while loading the base graphics is put off until they are first used.
+static std::atomic<const IPlatformEnvironment*> _deferredGraphicsEnv = { nullptr };
+static std::recursive_mutex _deferredGraphicsMutex;
+static bool _deferredGraphicsLoading = false;
+
 static rct_g1_element _g1Temp = {};
 static std::vector<rct_g1_element> _imageListElements;
 bool gTinyFontAntiAliased = false;
 
+/**
+ * Returns the element data of a graphics archive, the data at the current position of fs with the given length. The
+ * file is mapped if possible so the data is only read when a sprite is drawn, otherwise it is read into memory.
+ */
+static void* gfx_read_gx_data(
+    FileStream& fs, const std::string& path, size_t length, std::unique_ptr<MemoryMappedFile>& mapping)
+{
+    auto offset = static_cast<size_t>(fs.GetPosition());
+    try
+    {
+        mapping = std::make_unique<MemoryMappedFile>(path);
+    }
+    catch (const std::exception& e)
+    {
+        log_verbose("Unable to map '%s', reading it instead: %s", path.c_str(), e.what());
+        return fs.ReadArray<uint8_t>(length);
+    }
+
+    if (offset + length > mapping->GetLength())
+    {
+        mapping = nullptr;
+        throw IOException("Attempted to read past end of file.");
+    }
+    return const_cast<uint8_t*>(mapping->GetData() + offset);
+}
+
+static void gfx_free_gx_data(rct_gx& gx, std::unique_ptr<MemoryMappedFile>& mapping)
+{
+    if (mapping != nullptr)
+    {
+        mapping = nullptr;
+        gx.data = nullptr;
+    }
+    else
+    {
+        SafeFree(gx.data);
+    }
+}
+
 /**
  *
  *  rct2: 0x00678998
@@ -213,7 +267,7 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
         gTinyFontAntiAliased = is_rctc;
 
         // Read element data
-        _g1.data = fs.ReadArray<uint8_t>(_g1.header.total_size);
+        _g1.data = gfx_read_gx_data(fs, path, _g1.header.total_size, _g1Mapping);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _g1.header.num_entries; i++)
@@ -239,25 +293,66 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
 
 void gfx_unload_g1()
 {
-    SafeFree(_g1.data);
+    _deferredGraphicsEnv = nullptr;
+    gfx_free_gx_data(_g1, _g1Mapping);
     _g1.elements.clear();
     _g1.elements.shrink_to_fit();
 }
 
 void gfx_unload_g2()
 {
-    SafeFree(_g2.data);
+    gfx_free_gx_data(_g2, _g2Mapping);
     _g2.elements.clear();
     _g2.elements.shrink_to_fit();
 }
 
 void gfx_unload_csg()
 {
-    SafeFree(_csg.data);
+    gfx_free_gx_data(_csg, _csgMapping);
     _csg.elements.clear();
     _csg.elements.shrink_to_fit();
 }
 
+bool gfx_defer_load_base_graphics(const IPlatformEnvironment& env)
+{
+    auto path = Path::Combine(env.GetDirectoryPath(DIRBASE::RCT2, DIRID::DATA), "g1.dat");
+    if (!File::Exists(path))
+    {
+        log_fatal("Unable to load g1 graphics, '%s' does not exist", path.c_str());
+        return false;
+    }
+    _deferredGraphicsEnv = &env;
+    return true;
+}
+
+static void gfx_load_deferred_base_graphics()
+{
+    std::lock_guard<std::recursive_mutex> lock(_deferredGraphicsMutex);
+    auto env = _deferredGraphicsEnv.load();
+    // The font initialisation below gets elements again on this thread.
+    if (env == nullptr || _deferredGraphicsLoading)
+        return;
+
+    _deferredGraphicsLoading = true;
+    log_verbose("Loading the base graphics on first use");
+    if (gfx_load_g1(*env))
+    {
+        gfx_load_g2();
+        gfx_load_csg();
+        font_sprite_initialise_characters();
+    }
+    _deferredGraphicsLoading = false;
+    _deferredGraphicsEnv = nullptr;
+}
+
+static void gfx_ensure_base_graphics_loaded()
+{
+    if (_deferredGraphicsEnv.load(std::memory_order_acquire) != nullptr)
+    {
+        gfx_load_deferred_base_graphics();
+    }
+}
+
 bool gfx_load_g2()
 {
     log_verbose("gfx_load_g2()");
@@ -276,7 +371,7 @@ bool gfx_load_g2()
         read_and_convert_gxdat(&fs, _g2.header.num_entries, false, _g2.elements.data());
 
         // Read element data
-        _g2.data = fs.ReadArray<uint8_t>(_g2.header.total_size);
+        _g2.data = gfx_read_gx_data(fs, path, _g2.header.total_size, _g2Mapping);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _g2.header.num_entries; i++)
@@ -333,7 +428,7 @@ bool gfx_load_csg()
         read_and_convert_gxdat(&fileHeader, _csg.header.num_entries, false, _csg.elements.data());
 
         // Read element data
-        _csg.data = fileData.ReadArray<uint8_t>(_csg.header.total_size);
+        _csg.data = gfx_read_gx_data(fileData, pathDataPath, _csg.header.total_size, _csgMapping);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _csg.header.num_entries; i++)
@@ -657,6 +752,7 @@ const rct_g1_element* gfx_get_g1_element(ImageId imageId)
 const rct_g1_element* gfx_get_g1_element(int32_t image_id)
 {
     openrct2_assert(!gOpenRCT2NoGraphics, "gfx_get_g1_element called on headless instance");
+    gfx_ensure_base_graphics_loaded();
 
     auto offset = static_cast<size_t>(image_id);
     if (offset == 0x7FFFF)
@@ -734,6 +830,8 @@ void gfx_set_g1_element(int32_t imageId, const rct_g1_element* g1)
         {
             if (imageId < SPR_RCTC_G1_END)
             {
+                // Only overwriting a g1 element needs g1, object images go to the image list.
+                gfx_ensure_base_graphics_loaded();
                 if (imageId < static_cast<int32_t>(_g1.elements.size()))
                 {
                     _g1.elements[imageId] = *g1;
@@ -755,6 +853,7 @@ void gfx_set_g1_element(int32_t imageId, const rct_g1_element* g1)
 
 bool is_csg_loaded()
 {
+    gfx_ensure_base_graphics_loaded();
     return _csgLoaded;
 }
 
@@ -703,6 +703,8 @@ void gfx_filter_rect(rct_drawpixelinfo* dpi, const ScreenRect& rect, FilterPalet
 bool gfx_load_g1(const OpenRCT2::IPlatformEnvironment& env);
 bool gfx_load_g2();
 bool gfx_load_csg();
+// Checks g1.dat exists and loads the base graphics the first time an element is used.
+bool gfx_defer_load_base_graphics(const OpenRCT2::IPlatformEnvironment& env);
 void gfx_unload_g1();
 void gfx_unload_g2();
 void gfx_unload_csg();
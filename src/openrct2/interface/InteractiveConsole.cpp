@@ -43,6 +43,7 @@
 #include "../platform/platform.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
+#include "../scripting/ScriptEngine.h"
 #include "../util/Util.h"
 #include "../windows/Intent.h"
 #include "../world/Climate.h"
@@ -52,6 +53,7 @@
 #include "Viewport.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstdarg>
 #include <cstdlib>
@@ -1141,6 +1143,32 @@ static int32_t cc_object_count(InteractiveConsole& console, [[maybe_unused]] con
     return 0;
 }
 
+static int32_t cc_plugins(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+#ifdef ENABLE_SCRIPTING
+    using milliseconds = std::chrono::duration<double, std::milli>;
+
+    if (gConfigPlugin.tick_budget > 0)
+    {
+        console.WriteFormatLine("Tick budget: %d ms", gConfigPlugin.tick_budget);
+    }
+
+    // Time spent in nested plugin calls only counts for the called plugin.
+    auto& scriptEngine = OpenRCT2::GetContext()->GetScriptEngine();
+    for (const auto& plugin : scriptEngine.GetPlugins())
+    {
+        console.WriteFormatLine(
+            "%s: %.2f ms, last tick %.3f ms, throttled for %u ticks%s", plugin->GetMetadata().Name.c_str(),
+            std::chrono::duration_cast<milliseconds>(plugin->GetTimeSpent()).count(),
+            std::chrono::duration_cast<milliseconds>(plugin->GetTickTimeSpent()).count(), plugin->GetThrottledTicks(),
+            plugin->IsThrottled() ? " (throttled)" : "");
+    }
+#else
+    console.WriteFormatLine("Plugins are not supported in this build.");
+#endif
+    return 0;
+}
+
 static int32_t cc_open(InteractiveConsole& console, const arguments_t& argv)
 {
     if (!argv.empty())
@@ -1224,8 +1252,7 @@ static int32_t cc_remove_park_fences(InteractiveConsole& console, [[maybe_unused
 
 static int32_t cc_show_limits(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
-    map_reorganise_elements();
-    int32_t tileElementCount = gNextFreeTileElement - gTileElements - 1;
+    auto elementStats = map_get_element_stats();
 
     int32_t rideCount = ride_get_count();
     int32_t spriteCount = 0;
@@ -1254,7 +1281,13 @@ static int32_t cc_show_limits(InteractiveConsole& console, [[maybe_unused]] cons
     }
 
     console.WriteFormatLine("Sprites: %d/%d", spriteCount, MAX_SPRITES);
-    console.WriteFormatLine("Map Elements: %d/%d", tileElementCount, MAX_TILE_ELEMENTS);
+    console.WriteFormatLine("Map Elements: %u/%u", elementStats.UsedElements, map_get_max_elements());
+    console.WriteFormatLine(
+        "Free map elements: %u in %u runs, largest %u", elementStats.FreeElements, elementStats.FreeRuns,
+        elementStats.LargestFreeRun);
+    console.WriteFormatLine(
+        "Map element compaction: %u moves in %.2f ms, %u reorganisations", elementStats.CompactionMoves,
+        elementStats.CompactionTime / 1000.0, elementStats.Reorganisations);
     console.WriteFormatLine("Banners: %d/%zu", bannerCount, MAX_BANNERS);
     console.WriteFormatLine("Rides: %d/%d", rideCount, MAX_RIDES);
     console.WriteFormatLine("Staff: %d/%d", staffCount, STAFF_MAX_COUNT);
@@ -1481,14 +1514,21 @@ static int32_t cc_replay_start(InteractiveConsole& console, const arguments_t& a
 
     if (argv.size() < 1)
     {
-        console.WriteFormatLine("Parameters required <replay_name>");
+        console.WriteFormatLine("Parameters required <replay_name> [<start_tick = 0>]");
         return 0;
     }
 
     std::string name = argv[0];
 
+    // Playback starts from the closest keyframe before the tick.
+    uint32_t startTick = 0;
+    if (argv.size() >= 2)
+    {
+        startTick = atol(argv[1].c_str());
+    }
+
     auto* replayManager = OpenRCT2::GetContext()->GetReplayManager();
-    if (replayManager->StartPlayback(name))
+    if (replayManager->StartPlayback(name, startTick))
     {
         OpenRCT2::ReplayRecordInfo info;
         replayManager->GetCurrentReplayInfo(info);
@@ -1786,6 +1826,7 @@ static constexpr const console_command console_command_table[] = {
     { "load_park", cc_load_park, "Load park from save directory or by absolute path", "load_park <filename>" },
     { "object_count", cc_object_count, "Shows the number of objects of each type in the scenario.", "object_count" },
     { "open", cc_open, "Opens the window with the give name.", "open <window>." },
+    { "plugins", cc_plugins, "Shows the time spent in each plugin.", "plugins" },
     { "quit", cc_close, "Closes the console.", "quit" },
     { "remove_park_fences", cc_remove_park_fences, "Removes all park fences from the surface", "remove_park_fences" },
     { "remove_unused_objects", cc_remove_unused_objects, "Removes all the unused objects from the object selection.", "remove_unused_objects" },
@@ -1801,7 +1842,7 @@ static constexpr const console_command console_command_table[] = {
     { "windows", cc_windows, "Lists all the windows that can be opened.", "windows" },
     { "replay_startrecord", cc_replay_startrecord, "Starts recording a new replay.", "replay_startrecord <name> [max_ticks]"},
     { "replay_stoprecord", cc_replay_stoprecord, "Stops recording a new replay.", "replay_stoprecord"},
-    { "replay_start", cc_replay_start, "Starts a replay", "replay_start <name>"},
+    { "replay_start", cc_replay_start, "Starts a replay", "replay_start <name> [start_tick]"},
     { "replay_stop", cc_replay_stop, "Stops the replay", "replay_stop"},
     { "replay_normalise", cc_replay_normalise, "Normalises the replay to remove all gaps", "replay_normalise <input file> <output file>"},
     { "mp_desync", cc_mp_desync, "Forces a multiplayer desync", "cc_mp_desync [desync_type, 0 = Random t-shirt color on random peep, 1 = Remove random peep ]"},
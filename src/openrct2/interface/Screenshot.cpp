@@ -18,6 +18,7 @@
 #include "../audio/audio.h"
 #include "../core/Console.hpp"
 #include "../core/Imaging.h"
+#include "../core/String.hpp"
 #include "../drawing/Drawing.h"
 #include "../drawing/X8DrawingEngine.h"
 #include "../localisation/Localisation.h"
@@ -472,11 +473,13 @@ static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<I
         double totalTime = 0.0;
 
         std::array<double, MAX_ZOOM_LEVEL> zoomAverages;
+        std::array<ViewportPaintStats, MAX_ZOOM_LEVEL> zoomStats;
 
         // Render at every zoom.
         for (int32_t zoom = 0; zoom < MAX_ZOOM_LEVEL; zoom++)
         {
             double zoomLevelTime = 0.0;
+            gViewportPaintStats = {};
 
             // Render at every rotation.
             for (int32_t rotation = 0; rotation < MAX_ROTATIONS; rotation++)
@@ -493,6 +496,7 @@ static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<I
             }
 
             zoomAverages[zoom] = zoomLevelTime / static_cast<double>(MAX_ROTATIONS * iterationCount);
+            zoomStats[zoom] = gViewportPaintStats;
         }
 
         const double average = totalTime / static_cast<double>(totalRenderCount);
@@ -504,6 +508,13 @@ static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<I
         {
             const auto zoomAverage = zoomAverages[zoom];
             std::printf("Zoom[%d] average: %.06fs, %.f FPS\n", zoom, zoomAverage, 1.0 / zoomAverage);
+
+            // Per frame, generated paint structs above the drawn ones were set up twice at the edges of two sessions.
+            const auto& stats = zoomStats[zoom];
+            const auto frames = static_cast<double>(MAX_ROTATIONS * iterationCount);
+            std::printf(
+                "Zoom[%d] sessions: %.f, paint structs generated: %.f, drawn: %.f\n", zoom, stats.Sessions / frames,
+                stats.PaintStructsGenerated / frames, stats.PaintStructsDrawn / frames);
         }
         std::printf("Total average: %.06fs, %.f FPS\n", average, 1.0 / average);
         std::printf("Time: %.05fs\n", totalTime);
@@ -519,19 +530,33 @@ static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<I
 
 int32_t cmdline_for_gfxbench(const char** argv, int32_t argc)
 {
-    if (argc != 1 && argc != 2)
+    if (argc < 1 || argc > 3)
     {
-        printf("Usage: openrct2 benchgfx <file> [<iteration_count>]\n");
+        printf("Usage: openrct2 benchgfx <file> [<iteration_count>] [fixed|adaptive]\n");
         return -1;
     }
 
     core_init();
     int32_t iterationCount = 5;
-    if (argc == 2)
+    if (argc >= 2)
     {
         iterationCount = atoi(argv[1]);
     }
 
+    bool adaptiveStrips = false;
+    if (argc == 3)
+    {
+        if (String::Equals(argv[2], "adaptive", true))
+        {
+            adaptiveStrips = true;
+        }
+        else if (!String::Equals(argv[2], "fixed", true))
+        {
+            printf("Unknown viewport strip mode: %s, expected fixed or adaptive\n", argv[2]);
+            return -1;
+        }
+    }
+
     const char* inputPath = argv[0];
 
     gOpenRCT2Headless = true;
@@ -540,6 +565,8 @@ int32_t cmdline_for_gfxbench(const char** argv, int32_t argc)
     if (context->Initialise())
     {
         drawing_engine_init();
+        gConfigGeneral.adaptive_viewport_strips = adaptiveStrips;
+        std::printf("Viewport strips: %s\n", adaptiveStrips ? "adaptive" : "fixed");
 
         benchgfx_render_screenshots(inputPath, context, iterationCount);
 
@@ -22,6 +22,7 @@
 #include "../peep/Staff.h"
 #include "../ride/Ride.h"
 #include "../ride/TrackDesign.h"
+#include "../ride/Vehicle.h"
 #include "../ui/UiContext.h"
 #include "../ui/WindowManager.h"
 #include "../world/Climate.h"
@@ -32,7 +33,9 @@
 #include "Window_internal.h"
 
 #include <algorithm>
+#include <array>
 #include <cstring>
+#include <thread>
 
 using namespace OpenRCT2;
 
@@ -46,6 +49,12 @@ rct_viewport* g_music_tracking_viewport;
 
 static std::unique_ptr<JobPool> _paintJobs;
 
+// Paint structs generated per 32x32 pixel block of a column, by zoom level. Used to size the adaptive strips.
+static std::array<float, 8> _paintStructDensity;
+static constexpr float PaintStructBudget = 2000;
+
+ViewportPaintStats gViewportPaintStats;
+
 ScreenCoordsXY gSavedView;
 ZoomLevel gSavedViewZoom;
 uint8_t gSavedViewRotation;
@@ -865,7 +874,7 @@ static void viewport_fill_column(paint_session* session, std::vector<paint_sessi
     PaintSessionArrange(session);
 }
 
-static void viewport_paint_column(paint_session* session)
+static uint32_t viewport_paint_column(paint_session* session)
 {
     if (session->ViewFlags
             & (VIEWPORT_FLAG_HIDE_VERTICAL | VIEWPORT_FLAG_HIDE_BASE | VIEWPORT_FLAG_UNDERGROUND_INSIDE
@@ -880,7 +889,7 @@ static void viewport_paint_column(paint_session* session)
         gfx_clear(&session->DPI, colour);
     }
 
-    PaintDrawStructs(session);
+    uint32_t drawn = PaintDrawStructs(session);
 
     if (gConfigGeneral.render_weather_gloom && !gTrackDesignSaveMode && !(session->ViewFlags & VIEWPORT_FLAG_INVISIBLE_SPRITES)
         && !(session->ViewFlags & VIEWPORT_FLAG_HIGHLIGHT_PATH_ISSUES))
@@ -894,6 +903,114 @@ static void viewport_paint_column(paint_session* session)
     }
 
     PaintSessionFree(session);
+    return drawn;
+}
+
+/**
+ * Creates the session for the part of the viewport between x and x + width.
+ */
+static paint_session* viewport_alloc_strip(rct_drawpixelinfo* dpi, uint32_t viewFlags, int32_t x, int32_t width)
+{
+    paint_session* session = PaintSessionAlloc(dpi, viewFlags);
+
+    rct_drawpixelinfo& dpi2 = session->DPI;
+    if (x >= dpi2.x)
+    {
+        int16_t leftPitch = x - dpi2.x;
+        dpi2.width -= leftPitch;
+        dpi2.bits += leftPitch / dpi2.zoom_level;
+        dpi2.pitch += leftPitch / dpi2.zoom_level;
+        dpi2.x = x;
+    }
+
+    int16_t paintRight = dpi2.x + dpi2.width;
+    if (paintRight >= x + width)
+    {
+        int16_t rightPitch = paintRight - x - width;
+        paintRight -= rightPitch;
+        dpi2.pitch += rightPitch / dpi2.zoom_level;
+    }
+    dpi2.width = paintRight - dpi2.x;
+    return session;
+}
+
+static float& viewport_get_strip_density(ZoomLevel zoom)
+{
+    auto index = std::clamp<int32_t>(
+        static_cast<int8_t>(zoom) + 4, 0, static_cast<int32_t>(_paintStructDensity.size()) - 1);
+    return _paintStructDensity[index];
+}
+
+/**
+ * The number of 32 pixel columns painted by one session. Strips are made wide enough to set up fewer tiles and sprites
+ * twice at their edges, narrow enough to keep every worker busy and well below the paint structs a session can hold.
+ */
+static int32_t viewport_get_strip_columns(ZoomLevel zoom, int32_t columnCount, int32_t height, bool useMultithreading)
+{
+    float density = viewport_get_strip_density(zoom);
+    if (density <= 0)
+    {
+        // Nothing measured at this zoom level yet.
+        return 1;
+    }
+
+    int32_t columns = columnCount;
+    if (useMultithreading)
+    {
+        const int32_t threads = std::max(1u, std::thread::hardware_concurrency());
+        columns = columnCount / (threads * 4);
+    }
+
+    const float perColumn = density * ((height + 31) / 32);
+    columns = std::min(columns, static_cast<int32_t>(PaintStructBudget / perColumn));
+    return std::clamp(columns, 1, columnCount);
+}
+
+/**
+ * Measures the paint structs generated per column, strips that ran out of paint structs are set up again in single
+ * columns.
+ */
+static void viewport_update_strip_density(
+    rct_drawpixelinfo* dpi, ZoomLevel zoom, std::vector<paint_session*>& columns, int32_t columnCount)
+{
+    bool overflowed = false;
+    size_t generated = 0;
+    for (size_t i = 0; i < columns.size(); i++)
+    {
+        paint_session* strip = columns[i];
+        if (strip->NoPaintStructsAvailable() && strip->DPI.width > 32)
+        {
+            overflowed = true;
+
+            std::vector<paint_session*> stripColumns;
+            const int32_t stripRight = strip->DPI.x + strip->DPI.width;
+            for (int32_t x = floor2(strip->DPI.x, 32); x < stripRight; x += 32)
+            {
+                paint_session* session = viewport_alloc_strip(dpi, strip->ViewFlags, x, 32);
+                viewport_fill_column(session, nullptr, 0);
+                generated += session->NextFreePaintStruct - session->PaintStructs;
+                stripColumns.push_back(session);
+            }
+            PaintSessionFree(strip);
+
+            columns.erase(columns.begin() + i);
+            columns.insert(columns.begin() + i, stripColumns.begin(), stripColumns.end());
+            i += stripColumns.size() - 1;
+            continue;
+        }
+        generated += strip->NextFreePaintStruct - strip->PaintStructs;
+    }
+
+    const float measured = static_cast<float>(generated) / (columnCount * ((dpi->height + 31) / 32));
+    float& density = viewport_get_strip_density(zoom);
+    if (overflowed)
+    {
+        density = std::max(density * 2, measured);
+    }
+    else
+    {
+        density = density <= 0 ? measured : (density + measured) / 2;
+    }
 }
 
 /**
@@ -958,46 +1075,27 @@ void viewport_paint(
         _paintJobs.reset();
     }
 
+    // Recorded sessions are expected to hold a single column each.
+    const int32_t columnCount = (rightBorder - alignedX + 31) / 32;
+    const bool adaptive = gConfigGeneral.adaptive_viewport_strips && recorded_sessions == nullptr;
+    const int32_t stripColumns = adaptive
+        ? viewport_get_strip_columns(viewport->zoom, columnCount, dpi1.height, useMultithreading)
+        : 1;
+
     // Create space to record sessions and keep track which index is being drawn
     size_t index = 0;
     if (recorded_sessions != nullptr)
     {
-        const uint16_t columnSize = rightBorder - alignedX;
-        const uint16_t columnCount = (columnSize + 31) / 32;
         recorded_sessions->resize(columnCount);
     }
 
-    // Splits the area into 32 pixel columns and renders them
-    for (x = alignedX; x < rightBorder; x += 32, index++)
+    // Splits the area into strips of 32 pixel columns and renders them
+    for (int32_t stripX = alignedX; stripX < rightBorder; stripX += stripColumns * 32, index++)
     {
-        paint_session* session = PaintSessionAlloc(&dpi1, viewFlags);
+        paint_session* session = viewport_alloc_strip(&dpi1, viewFlags, stripX, stripColumns * 32);
         columns.push_back(session);
 
-        rct_drawpixelinfo& dpi2 = session->DPI;
-        if (x >= dpi2.x)
-        {
-            int16_t leftPitch = x - dpi2.x;
-            dpi2.width -= leftPitch;
-            dpi2.bits += leftPitch / dpi2.zoom_level;
-            dpi2.pitch += leftPitch / dpi2.zoom_level;
-            dpi2.x = x;
-        }
-
-        int16_t paintRight = dpi2.x + dpi2.width;
-        if (paintRight >= x + 32)
-        {
-            int16_t rightPitch = paintRight - x - 32;
-            paintRight -= rightPitch;
-            dpi2.pitch += rightPitch / dpi2.zoom_level;
-        }
-        dpi2.width = paintRight - dpi2.x;
-
-        if (useMultithreading)
-        {
-            _paintJobs->AddTask(
-                [session, recorded_sessions, index]() -> void { viewport_fill_column(session, recorded_sessions, index); });
-        }
-        else
+        if (!useMultithreading)
         {
             viewport_fill_column(session, recorded_sessions, index);
         }
@@ -1005,12 +1103,23 @@ void viewport_paint(
 
     if (useMultithreading)
     {
-        _paintJobs->Join();
+        _paintJobs->ParallelFor(
+            columns.size(), [&columns, recorded_sessions](size_t i) -> void {
+                viewport_fill_column(columns[i], recorded_sessions, i);
+            });
     }
 
+    if (adaptive)
+    {
+        viewport_update_strip_density(&dpi1, viewport->zoom, columns, columnCount);
+    }
+
+    gViewportPaintStats.Sessions += static_cast<uint32_t>(columns.size());
     for (auto&& column : columns)
     {
-        viewport_paint_column(column);
+        gViewportPaintStats.PaintStructsGenerated += static_cast<uint32_t>(
+            column->NextFreePaintStruct - column->PaintStructs);
+        gViewportPaintStats.PaintStructsDrawn += viewport_paint_column(column);
     }
 }
 
@@ -1690,6 +1799,10 @@ InteractionInfo get_map_coordinates_from_pos_window(rct_window* window, const Sc
  */
 void viewport_invalidate(rct_viewport* viewport, int32_t left, int32_t top, int32_t right, int32_t bottom)
 {
+    // Trains updated ahead on worker threads invalidate their area once they are committed in order.
+    if (vehicle_motion_defer_viewport_invalidate(viewport, left, top, right, bottom))
+        return;
+
     // if unknown viewport visibility, use the containing window to discover the status
     if (viewport->visibility == VisibilityCache::Unknown)
     {
@@ -116,6 +116,17 @@ extern uint8_t gSavedViewRotation;
 extern paint_entry* gNextFreePaintStruct;
 extern uint8_t gCurrentRotation;
 
+/**
+ * Counters of viewport_paint, accumulated until reset by the caller.
+ */
+struct ViewportPaintStats
+{
+    uint32_t Sessions;
+    uint32_t PaintStructsGenerated;
+    uint32_t PaintStructsDrawn;
+};
+extern ViewportPaintStats gViewportPaintStats;
+
 void viewport_init_all();
 std::optional<ScreenCoordsXY> centre_2d_coordinates(const CoordsXYZ& loc, rct_viewport* viewport);
 void viewport_create(
@@ -22,6 +22,7 @@
 #include "../localisation/Localisation.h"
 #include "../localisation/StringIds.h"
 #include "../platform/platform.h"
+#include "../ride/Vehicle.h"
 #include "../scenario/Scenario.h"
 #include "../sprites.h"
 #include "../ui/UiContext.h"
@@ -486,6 +487,8 @@ void window_invalidate_by_class(rct_windowclass cls)
  */
 void window_invalidate_by_number(rct_windowclass cls, rct_windownumber number)
 {
+    vehicle_motion_require_serial();
+
     window_invalidate_by_condition(
         [cls, number](rct_window* w) -> bool { return w->classification == cls && w->number == number; });
 }
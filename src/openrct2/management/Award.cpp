@@ -18,6 +18,7 @@
 #include "../ride/RideData.h"
 #include "../scenario/Scenario.h"
 #include "../world/Park.h"
+#include "../world/ParkAggregates.h"
 #include "NewsItem.h"
 
 #include <algorithm>
@@ -74,6 +75,14 @@ bool award_is_positive(int32_t type)
 
 #pragma region Award checks
 
+/** Guests in the park whose newest thought is about litter, disgusting paths or vandalism. */
+static uint32_t award_get_untidy_thought_count(const ParkAggregates& aggregates)
+{
+    return aggregates.GetFreshThoughtCount(PeepThoughtType::BadLitter)
+        + aggregates.GetFreshThoughtCount(PeepThoughtType::PathDisgusting)
+        + aggregates.GetFreshThoughtCount(PeepThoughtType::Vandalism);
+}
+
 /** More than 1/16 of the total guests must be thinking untidy thoughts. */
 static bool award_is_deserved_most_untidy(int32_t activeAwardTypes)
 {
@@ -84,22 +93,7 @@ static bool award_is_deserved_most_untidy(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(ParkAward::MostTidy))
         return false;
 
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>(EntityListId::Peep))
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        if (peep->Thoughts[0].freshness > 5)
-            continue;
-
-        if (peep->Thoughts[0].type == PeepThoughtType::BadLitter || peep->Thoughts[0].type == PeepThoughtType::PathDisgusting
-            || peep->Thoughts[0].type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
-
+    uint32_t negativeCount = award_get_untidy_thought_count(park_aggregates_get());
     return (negativeCount > gNumGuestsInPark / 16);
 }
 
@@ -111,26 +105,9 @@ static bool award_is_deserved_most_tidy(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(ParkAward::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>(EntityListId::Peep))
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        if (peep->Thoughts[0].freshness > 5)
-            continue;
-
-        if (peep->Thoughts[0].type == PeepThoughtType::VeryClean)
-            positiveCount++;
-
-        if (peep->Thoughts[0].type == PeepThoughtType::BadLitter || peep->Thoughts[0].type == PeepThoughtType::PathDisgusting
-            || peep->Thoughts[0].type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
-
+    const auto& aggregates = park_aggregates_get();
+    uint32_t positiveCount = aggregates.GetFreshThoughtCount(PeepThoughtType::VeryClean);
+    uint32_t negativeCount = award_get_untidy_thought_count(aggregates);
     return (negativeCount <= 5 && positiveCount > gNumGuestsInPark / 64);
 }
 
@@ -190,27 +167,9 @@ static bool award_is_deserved_most_beautiful(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(ParkAward::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    auto list = EntityList<Guest>(EntityListId::Peep);
-    for (auto peep : list)
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        if (peep->Thoughts[0].freshness > 5)
-            continue;
-
-        if (peep->Thoughts[0].type == PeepThoughtType::Scenery)
-            positiveCount++;
-
-        if (peep->Thoughts[0].type == PeepThoughtType::BadLitter || peep->Thoughts[0].type == PeepThoughtType::PathDisgusting
-            || peep->Thoughts[0].type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
-
+    const auto& aggregates = park_aggregates_get();
+    uint32_t positiveCount = aggregates.GetFreshThoughtCount(PeepThoughtType::Scenery);
+    uint32_t negativeCount = award_get_untidy_thought_count(aggregates);
     return (negativeCount <= 15 && positiveCount > gNumGuestsInPark / 128);
 }
 
@@ -233,15 +192,7 @@ static bool award_is_deserved_worst_value(int32_t activeAwardTypes)
 /** No more than 2 people who think the vandalism is bad and no crashes. */
 static bool award_is_deserved_safest([[maybe_unused]] int32_t activeAwardTypes)
 {
-    auto peepsWhoDislikeVandalism = 0;
-    for (auto peep : EntityList<Guest>(EntityListId::Peep))
-    {
-        if (peep->OutsideOfPark)
-            continue;
-        if (peep->Thoughts[0].freshness <= 5 && peep->Thoughts[0].type == PeepThoughtType::Vandalism)
-            peepsWhoDislikeVandalism++;
-    }
-
+    auto peepsWhoDislikeVandalism = park_aggregates_get().GetFreshThoughtCount(PeepThoughtType::Vandalism);
     if (peepsWhoDislikeVandalism > 2)
         return false;
 
@@ -314,15 +265,7 @@ static bool award_is_deserved_best_food(int32_t activeAwardTypes)
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>(EntityListId::Peep))
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        if (peep->Thoughts[0].freshness <= 5 && peep->Thoughts[0].type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
+    auto hungryPeeps = park_aggregates_get().GetFreshThoughtCount(PeepThoughtType::Hungry);
     return (hungryPeeps <= 12);
 }
 
@@ -358,15 +301,7 @@ static bool award_is_deserved_worst_food(int32_t activeAwardTypes)
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>(EntityListId::Peep))
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        if (peep->Thoughts[0].freshness <= 5 && peep->Thoughts[0].type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
+    auto hungryPeeps = park_aggregates_get().GetFreshThoughtCount(PeepThoughtType::Hungry);
     return (hungryPeeps > 15);
 }
 
@@ -388,15 +323,7 @@ static bool award_is_deserved_best_restrooms([[maybe_unused]] int32_t activeAwar
         return false;
 
     // Count number of guests who are thinking they need the restroom
-    auto guestsWhoNeedRestroom = 0;
-    for (auto peep : EntityList<Guest>(EntityListId::Peep))
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        if (peep->Thoughts[0].freshness <= 5 && peep->Thoughts[0].type == PeepThoughtType::Toilet)
-            guestsWhoNeedRestroom++;
-    }
+    auto guestsWhoNeedRestroom = park_aggregates_get().GetFreshThoughtCount(PeepThoughtType::Toilet);
     return (guestsWhoNeedRestroom <= 16);
 }
 
@@ -514,18 +441,10 @@ static bool award_is_deserved_most_dazzling_ride_colours(int32_t activeAwardType
 /** At least 10 peeps and more than 1/64 of total guests are lost or can't find something. */
 static bool award_is_deserved_most_confusing_layout([[maybe_unused]] int32_t activeAwardTypes)
 {
-    uint32_t peepsCounted = 0;
-    uint32_t peepsLost = 0;
-    for (auto peep : EntityList<Guest>(EntityListId::Peep))
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        peepsCounted++;
-        if (peep->Thoughts[0].freshness <= 5
-            && (peep->Thoughts[0].type == PeepThoughtType::Lost || peep->Thoughts[0].type == PeepThoughtType::CantFind))
-            peepsLost++;
-    }
+    const auto& aggregates = park_aggregates_get();
+    uint32_t peepsCounted = aggregates.GuestsInPark;
+    uint32_t peepsLost = aggregates.GetFreshThoughtCount(PeepThoughtType::Lost)
+        + aggregates.GetFreshThoughtCount(PeepThoughtType::CantFind);
 
     return (peepsLost >= 10 && peepsLost >= peepsCounted / 64);
 }
@@ -19,6 +19,7 @@
 #include "../ride/RideData.h"
 #include "../ride/ShopItem.h"
 #include "../world/Park.h"
+#include "../world/ParkAggregates.h"
 #include "Finance.h"
 #include "NewsItem.h"
 
@@ -162,6 +163,7 @@ void marketing_set_guest_campaign(Peep* peep, int32_t campaignType)
             peep->GuestIsLostCountdown = 240;
             break;
     }
+    park_aggregates_update_guest(peep);
 }
 
 bool marketing_is_campaign_type_applicable(int32_t campaignType)
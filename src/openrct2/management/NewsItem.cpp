@@ -19,6 +19,7 @@
 #include "../localisation/Localisation.h"
 #include "../management/Research.h"
 #include "../ride/Ride.h"
+#include "../ride/Vehicle.h"
 #include "../util/Util.h"
 #include "../windows/Intent.h"
 #include "../world/Location.hpp"
@@ -303,6 +304,8 @@ News::Item* News::ItemQueues::FirstOpenOrNewSlot()
  */
 News::Item* News::AddItemToQueue(News::ItemType type, rct_string_id string_id, uint32_t assoc, const Formatter& formatter)
 {
+    vehicle_motion_require_serial();
+
     utf8 buffer[256];
 
     // overflows possible?
@@ -312,6 +315,8 @@ News::Item* News::AddItemToQueue(News::ItemType type, rct_string_id string_id, u
 
 News::Item* News::AddItemToQueue(News::ItemType type, const utf8* text, uint32_t assoc)
 {
+    vehicle_motion_require_serial();
+
     News::Item* newsItem = gNewsItems.FirstOpenOrNewSlot();
     newsItem->Type = type;
     newsItem->Flags = 0;
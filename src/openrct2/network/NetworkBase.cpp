@@ -34,7 +34,7 @@
 // This string specifies which version of network stream current build uses.
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
-#define NETWORK_STREAM_VERSION "8"
+#define NETWORK_STREAM_VERSION "12"
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
 static Peep* _pickup_peep = nullptr;
@@ -71,6 +71,7 @@ static constexpr uint32_t CHUNK_SIZE = 1024 * 63;
 #    include "NetworkConnection.h"
 #    include "NetworkGroup.h"
 #    include "NetworkKey.h"
+#    include "NetworkMapExport.h"
 #    include "NetworkPacket.h"
 #    include "NetworkPlayer.h"
 #    include "NetworkServerAdvertiser.h"
@@ -191,6 +192,7 @@ void NetworkBase::Close()
         CloseConnection();
 
         client_connection_list.clear();
+        _socketPoller = nullptr;
         GameActions::ClearQueue();
         GameActions::ResumeQueue();
         player_list.clear();
@@ -258,6 +260,7 @@ bool NetworkBase::BeginClient(const std::string& host, uint16_t port)
     _serverConnection->Socket = CreateTcpSocket();
     _serverConnection->Socket->ConnectAsync(host, port);
     _serverState.gamestateSnapshotsEnabled = false;
+    _serverGameStateBase.reset();
 
     status = NETWORK_STATUS_CONNECTING;
     _lastConnectStatus = SocketStatus::Closed;
@@ -364,6 +367,9 @@ bool NetworkBase::BeginServer(uint16_t port, const std::string& address)
         return false;
     }
 
+    _socketPoller = CreateTcpSocketPoller();
+    _socketPoller->Add(*_listenSocket);
+
     ServerName = gConfigNetwork.server_name;
     ServerDescription = gConfigNetwork.server_description;
     ServerGreeting = gConfigNetwork.server_greeting;
@@ -496,8 +502,25 @@ void NetworkBase::Flush()
     }
 }
 
+bool NetworkBase::Wait(uint32_t timeoutMs)
+{
+    if (GetMode() != NETWORK_MODE_SERVER || _socketPoller == nullptr || !_socketPoller->IsEventDriven())
+        return false;
+
+    if (_socketPoller->Wait(timeoutMs))
+    {
+        // Handle the data right away, replies do not have to wait for the next tick.
+        Update();
+        Flush();
+    }
+    return true;
+}
+
 void NetworkBase::UpdateServer()
 {
+    // Only returns the sockets that are ready, connections without pending data are not read from.
+    _socketPoller->Wait(0);
+
     for (auto& connection : client_connection_list)
     {
         // This can be called multiple times before the connection is removed.
@@ -507,6 +530,12 @@ void NetworkBase::UpdateServer()
         if (!ProcessConnection(*connection))
         {
             connection->IsDisconnected = true;
+
+            // Closed sockets stay readable, stop watching them until the connection is removed.
+            if (connection->Socket != nullptr)
+            {
+                _socketPoller->Remove(*connection->Socket);
+            }
         }
         else
         {
@@ -526,10 +555,15 @@ void NetworkBase::UpdateServer()
         _advertiser->Update();
     }
 
-    std::unique_ptr<ITcpSocket> tcpSocket = _listenSocket->Accept();
-    if (tcpSocket != nullptr)
+    ProcessMapTransfers();
+
+    if (_socketPoller->IsReadable(*_listenSocket))
     {
-        AddClient(std::move(tcpSocket));
+        std::unique_ptr<ITcpSocket> tcpSocket = _listenSocket->Accept();
+        if (tcpSocket != nullptr)
+        {
+            AddClient(std::move(tcpSocket));
+        }
     }
 }
 
@@ -711,6 +745,8 @@ const char* NetworkBase::FormatChat(NetworkPlayer* fromplayer, const char* text)
 
 void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, bool gameCmd)
 {
+    // Serialise once, all connections share the same immutable buffer.
+    NetworkWireBufferPtr wire;
     for (auto& client_connection : client_connection_list)
     {
         if (client_connection->IsDisconnected)
@@ -730,8 +766,12 @@ void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, b
                 continue;
             }
         }
-        auto packetCopy = packet;
-        client_connection->QueuePacket(std::move(packetCopy), front);
+        if (wire == nullptr)
+        {
+            wire = packet.Serialise();
+            _broadcastBytesCopied += wire->Bytes.size();
+        }
+        client_connection->QueuePacket(wire, front);
     }
 }
 
@@ -756,7 +796,7 @@ bool NetworkBase::CheckSRAND(uint32_t tick, uint32_t srand0)
 
     if (!storedTick.spriteHash.empty())
     {
-        rct_sprite_checksum checksum = sprite_checksum();
+        rct_sprite_checksum checksum = sprite_checksum_incremental();
         std::string clientSpriteHash = checksum.ToString();
         if (clientSpriteHash != storedTick.spriteHash)
         {
@@ -1193,8 +1233,11 @@ void NetworkBase::Client_Send_RequestGameState(uint32_t tick)
 
     log_verbose("Requesting gamestate from server for tick %u", tick);
 
+    // Let the server know which of its states we already have so it only needs to send the changes.
+    uint32_t baseTick = _serverGameStateBase != nullptr ? _serverGameStateBaseTick : tick;
+
     NetworkPacket packet(NetworkCommand::RequestGameState);
-    packet << tick;
+    packet << tick << baseTick;
     _serverConnection->QueuePacket(std::move(packet));
 }
 
@@ -1332,7 +1375,9 @@ NetworkStats_t NetworkBase::GetStats() const
                 stats.bytesReceived[n] += connection->Stats.bytesReceived[n];
                 stats.bytesSent[n] += connection->Stats.bytesSent[n];
             }
+            stats.bytesCopied += connection->Stats.bytesCopied;
         }
+        stats.bytesCopied += _broadcastBytesCopied;
     }
     return stats;
 }
@@ -1373,8 +1418,8 @@ void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
         objects = objManager.GetPackableObjects();
     }
 
-    auto header = save_for_network(objects);
-    if (header.empty())
+    auto mapExport = GetMapExport(objects);
+    if (mapExport == nullptr)
     {
         if (connection)
         {
@@ -1383,57 +1428,82 @@ void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
         }
         return;
     }
-    size_t chunksize = CHUNK_SIZE;
-    for (size_t i = 0; i < header.size(); i += chunksize)
+
+    // The first chunk only holds the header and is queued right away, this keeps the start of the map in order
+    // with the game actions of the following ticks. The remaining chunks are sent by ProcessMapTransfers.
+    NetworkPacket packet(NetworkCommand::Map);
+    auto headerSize = mapExport->WriteHeader(packet);
+    auto wire = packet.Serialise();
+    for (auto& client_connection : client_connection_list)
     {
-        size_t datasize = std::min(chunksize, header.size() - i);
-        NetworkPacket packet(NetworkCommand::Map);
-        packet << static_cast<uint32_t>(header.size()) << static_cast<uint32_t>(i);
-        packet.Write(&header[i], datasize);
-        if (connection)
-        {
-            connection->QueuePacket(std::move(packet));
-        }
-        else
-        {
-            SendPacketToClients(packet);
-        }
+        if (client_connection->IsDisconnected || (connection != nullptr && client_connection.get() != connection))
+            continue;
+
+        client_connection->MapTransfer = mapExport;
+        client_connection->MapTransferOffset = headerSize;
+        client_connection->QueuePacket(wire);
     }
+    ProcessMapTransfers();
 }
 
-std::vector<uint8_t> NetworkBase::save_for_network(const std::vector<const ObjectRepositoryItem*>& objects) const
+std::shared_ptr<NetworkMapExport> NetworkBase::GetMapExport(const std::vector<const ObjectRepositoryItem*>& objects)
 {
-    std::vector<uint8_t> header;
+    // Clients joining during the same tick share one export, any game action sent since makes it outdated.
+    if (_mapExport != nullptr && _mapExport->Tick == gCurrentTicks && _mapExport->Objects == objects)
+    {
+        log_verbose("Reusing map export of tick %u", gCurrentTicks);
+        return _mapExport;
+    }
+    _mapExport = nullptr;
+
     bool RLEState = gUseRLE;
     gUseRLE = false;
 
     auto ms = OpenRCT2::MemoryStream();
-    if (!SaveMap(&ms, objects))
+    bool saved = SaveMap(&ms, objects);
+    gUseRLE = RLEState;
+    if (!saved)
     {
         log_warning("Failed to export map.");
-        return header;
+        return nullptr;
     }
-    gUseRLE = RLEState;
 
-    const void* data = ms.GetData();
-    int32_t size = ms.GetLength();
+    _mapExport = NetworkMapExport::Start(gCurrentTicks, objects, std::move(ms));
+    return _mapExport;
+}
 
-    auto compressed = util_zlib_deflate(static_cast<const uint8_t*>(data), size);
-    if (compressed != std::nullopt)
-    {
-        std::string headerString = "open2_sv6_zlib";
-        header.resize(headerString.size() + 1 + compressed->size());
-        std::memcpy(&header[0], headerString.c_str(), headerString.size() + 1);
-        std::memcpy(&header[headerString.size() + 1], compressed->data(), compressed->size());
-        log_verbose("Sending map of size %u bytes, compressed to %u bytes", size, headerString.size() + 1 + compressed->size());
-    }
-    else
+void NetworkBase::ProcessMapTransfers()
+{
+    for (auto& connection : client_connection_list)
     {
-        log_warning("Failed to compress the data, falling back to non-compressed sv6.");
-        header.resize(size);
-        std::memcpy(header.data(), data, size);
+        if (connection->IsDisconnected || connection->MapTransfer == nullptr)
+            continue;
+
+        auto& mapExport = *connection->MapTransfer;
+        if (mapExport.HasFailed())
+        {
+            connection->MapTransfer = nullptr;
+            connection->SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
+            connection->Socket->Disconnect();
+            continue;
+        }
+
+        while (true)
+        {
+            NetworkPacket packet(NetworkCommand::Map);
+            auto length = mapExport.WriteChunk(packet, connection->MapTransferOffset, CHUNK_SIZE);
+            if (length == 0)
+                break;
+
+            connection->MapTransferOffset += length;
+            connection->QueuePacket(std::move(packet));
+        }
+
+        if (mapExport.IsComplete(connection->MapTransferOffset))
+        {
+            connection->MapTransfer = nullptr;
+        }
     }
-    return header;
 }
 
 void NetworkBase::Client_Send_CHAT(const char* text)
@@ -1455,12 +1525,14 @@ void NetworkBase::Server_Send_CHAT(const char* text, const std::vector<uint8_t>&
     }
     else
     {
+        auto wire = packet.Serialise();
+        _broadcastBytesCopied += wire->Bytes.size();
         for (auto playerId : playerIds)
         {
             auto conn = GetPlayerConnection(playerId);
             if (conn != nullptr && !conn->IsDisconnected)
             {
-                conn->QueuePacket(packet);
+                conn->QueuePacket(wire);
             }
         }
     }
@@ -1497,6 +1569,9 @@ void NetworkBase::Server_Send_GAME_ACTION(const GameAction* action)
     packet << gCurrentTicks << action->GetType() << stream;
 
     SendPacketToClients(packet);
+
+    // A map exported earlier in this tick would miss the action.
+    _mapExport = nullptr;
 }
 
 void NetworkBase::Server_Send_TICK()
@@ -1519,7 +1594,7 @@ void NetworkBase::Server_Send_TICK()
     packet << flags;
     if (flags & NETWORK_TICK_FLAG_CHECKSUMS)
     {
-        rct_sprite_checksum checksum = sprite_checksum();
+        rct_sprite_checksum checksum = sprite_checksum_incremental();
         packet.WriteString(checksum.ToString().c_str());
     }
 
@@ -1655,35 +1730,39 @@ void NetworkBase::Server_Send_EVENT_PLAYER_DISCONNECTED(const char* playerName,
 
 bool NetworkBase::ProcessConnection(NetworkConnection& connection)
 {
-    NetworkReadPacket packetStatus;
-    do
+    // The server only reads from connections the poller reported, the client always has a single connection to read.
+    if (_socketPoller == nullptr || _socketPoller->IsReadable(*connection.Socket))
     {
-        packetStatus = connection.ReadPacket();
-        switch (packetStatus)
+        NetworkReadPacket packetStatus;
+        do
         {
-            case NetworkReadPacket::Disconnected:
-                // closed connection or network error
-                if (!connection.GetLastDisconnectReason())
-                {
-                    connection.SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
-                }
-                return false;
-            case NetworkReadPacket::Success:
-                // done reading in packet
-                ProcessPacket(connection, connection.InboundPacket);
-                if (connection.Socket == nullptr)
-                {
+            packetStatus = connection.ReadPacket();
+            switch (packetStatus)
+            {
+                case NetworkReadPacket::Disconnected:
+                    // closed connection or network error
+                    if (!connection.GetLastDisconnectReason())
+                    {
+                        connection.SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
+                    }
                     return false;
-                }
-                break;
-            case NetworkReadPacket::MoreData:
-                // more data required to be read
-                break;
-            case NetworkReadPacket::NoData:
-                // could not read anything from socket
-                break;
-        }
-    } while (packetStatus == NetworkReadPacket::Success);
+                case NetworkReadPacket::Success:
+                    // done reading in packet
+                    ProcessPacket(connection, connection.InboundPacket);
+                    if (connection.Socket == nullptr)
+                    {
+                        return false;
+                    }
+                    break;
+                case NetworkReadPacket::MoreData:
+                    // more data required to be read
+                    break;
+                case NetworkReadPacket::NoData:
+                    // could not read anything from socket
+                    break;
+            }
+        } while (packetStatus == NetworkReadPacket::Success);
+    }
 
     connection.SendQueuedPackets();
 
@@ -1941,6 +2020,7 @@ void NetworkBase::AddClient(std::unique_ptr<ITcpSocket>&& socket)
     // Store connection
     auto connection = std::make_unique<NetworkConnection>();
     connection->Socket = std::move(socket);
+    _socketPoller->Add(*connection->Socket);
 
     client_connection_list.push_back(std::move(connection));
 }
@@ -2161,7 +2241,8 @@ void NetworkBase::Client_Handle_TOKEN(NetworkConnection& connection, NetworkPack
 void NetworkBase::Server_Handle_REQUEST_GAMESTATE(NetworkConnection& connection, NetworkPacket& packet)
 {
     uint32_t tick;
-    packet >> tick;
+    uint32_t baseTick;
+    packet >> tick >> baseTick;
 
     if (_serverState.gamestateSnapshotsEnabled == false)
     {
@@ -2177,7 +2258,19 @@ void NetworkBase::Server_Handle_REQUEST_GAMESTATE(NetworkConnection& connection,
         MemoryStream snapshotMemory;
         DataSerialiser ds(true, snapshotMemory);
 
-        snapshots->SerialiseSnapshot(const_cast<GameStateSnapshot_t&>(*snapshot), ds);
+        // Send only the changes if the client still has a state we also have in the history.
+        const GameStateSnapshot_t* baseSnapshot = baseTick != tick ? snapshots->GetLinkedSnapshot(baseTick) : nullptr;
+        bool isDelta = baseSnapshot != nullptr;
+        ds << isDelta << baseTick;
+        if (isDelta)
+        {
+            snapshots->SerialiseSnapshotDelta(
+                const_cast<GameStateSnapshot_t&>(*baseSnapshot), const_cast<GameStateSnapshot_t&>(*snapshot), ds);
+        }
+        else
+        {
+            snapshots->SerialiseSnapshot(const_cast<GameStateSnapshot_t&>(*snapshot), ds);
+        }
 
         uint32_t bytesSent = 0;
         uint32_t length = static_cast<uint32_t>(snapshotMemory.GetLength());
@@ -2412,13 +2505,33 @@ void NetworkBase::Client_Handle_GAMESTATE(NetworkConnection& connection, Network
 
         IGameStateSnapshots* snapshots = GetContext()->GetGameStateSnapshots();
 
-        GameStateSnapshot_t& serverSnapshot = snapshots->CreateSnapshot();
-        snapshots->SerialiseSnapshot(serverSnapshot, ds);
+        bool isDelta = false;
+        uint32_t baseTick = 0;
+        ds << isDelta << baseTick;
+
+        auto serverSnapshot = snapshots->CreateDetachedSnapshot();
+        if (isDelta)
+        {
+            if (_serverGameStateBase == nullptr || _serverGameStateBaseTick != baseTick)
+            {
+                log_error("Received game state delta for tick %u without having the base state", tick);
+                return;
+            }
+            snapshots->SerialiseSnapshotDelta(*_serverGameStateBase, *serverSnapshot, ds);
+        }
+        else
+        {
+            snapshots->SerialiseSnapshot(*serverSnapshot, ds);
+        }
+
+        // Keep the received state around, the next request can then be answered with a delta.
+        _serverGameStateBase = serverSnapshot;
+        _serverGameStateBaseTick = tick;
 
         const GameStateSnapshot_t* desyncSnapshot = snapshots->GetLinkedSnapshot(tick);
         if (desyncSnapshot)
         {
-            GameStateCompareData_t cmpData = snapshots->Compare(serverSnapshot, *desyncSnapshot);
+            GameStateCompareData_t cmpData = snapshots->Compare(*serverSnapshot, *desyncSnapshot);
 
             std::string outputPath = GetContext()->GetPlatformEnvironment()->GetDirectoryPath(
                 DIRBASE::USER, DIRID::LOG_DESYNCS);
@@ -2626,14 +2739,17 @@ void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connecti
         _serverTickData.clear();
         _clientMapLoaded = false;
     }
-    if (size > chunk_buffer.size())
+    // The server sends a size of 0 until it has finished compressing the map, only the final chunks carry it.
+    uint32_t received = offset + chunksize;
+    uint32_t expected = std::max(size, received);
+    if (expected > chunk_buffer.size())
     {
-        chunk_buffer.resize(size);
+        chunk_buffer.resize(expected);
     }
     char str_downloading_map[256];
     uint32_t downloading_map_args[2] = {
-        (offset + chunksize) / 1024,
-        size / 1024,
+        received / 1024,
+        expected / 1024,
     };
     format_string(str_downloading_map, 256, STR_MULTIPLAYER_DOWNLOADING_MAP, downloading_map_args);
 
@@ -2643,7 +2759,7 @@ void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connecti
     context_open_intent(&intent);
 
     std::memcpy(&chunk_buffer[offset], const_cast<void*>(static_cast<const void*>(packet.Read(chunksize))), chunksize);
-    if (offset + chunksize == size)
+    if (received == size)
     {
         // Allow queue processing of game actions again.
         GameActions::ResumeQueue();
@@ -3236,6 +3352,11 @@ void network_flush()
     gNetwork.Flush();
 }
 
+bool network_wait(uint32_t timeoutMs)
+{
+    return gNetwork.Wait(timeoutMs);
+}
+
 int32_t network_get_mode()
 {
     return gNetwork.GetMode();
@@ -3982,6 +4103,10 @@ uint32_t network_get_server_tick()
 void network_flush()
 {
 }
+bool network_wait(uint32_t timeoutMs)
+{
+    return false;
+}
 void network_send_tick()
 {
 }
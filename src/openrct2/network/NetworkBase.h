@@ -12,6 +12,9 @@
 
 #ifndef DISABLE_NETWORK
 
+class NetworkMapExport;
+struct GameStateSnapshot_t;
+
 class NetworkBase
 {
 public:
@@ -28,6 +31,7 @@ public: // Common
     uint32_t GetServerTick();
     void Update();
     void Flush();
+    bool Wait(uint32_t timeoutMs);
     void ProcessPending();
     void ProcessPlayerList();
     std::vector<std::unique_ptr<NetworkPlayer>>::iterator GetPlayerIteratorByID(uint8_t id);
@@ -69,7 +73,8 @@ public: // Server
     void UpdateServer();
     void ServerClientDisconnected(std::unique_ptr<NetworkConnection>& connection);
     bool SaveMap(OpenRCT2::IStream* stream, const std::vector<const ObjectRepositoryItem*>& objects) const;
-    std::vector<uint8_t> save_for_network(const std::vector<const ObjectRepositoryItem*>& objects) const;
+    std::shared_ptr<NetworkMapExport> GetMapExport(const std::vector<const ObjectRepositoryItem*>& objects);
+    void ProcessMapTransfers();
     std::string MakePlayerNameUnique(const std::string& name);
 
     // Packet dispatchers.
@@ -187,12 +192,15 @@ private: // Common Data
 private: // Server Data
     std::unordered_map<NetworkCommand, CommandHandler> server_command_handlers;
     std::unique_ptr<ITcpSocket> _listenSocket;
+    std::unique_ptr<ITcpSocketPoller> _socketPoller;
     std::unique_ptr<INetworkServerAdvertiser> _advertiser;
     std::list<std::unique_ptr<NetworkConnection>> client_connection_list;
     std::string _serverLogPath;
     std::string _serverLogFilenameFormat = "%Y%m%d-%H%M%S.txt";
     std::ofstream _server_log_fs;
     uint16_t listening_port = 0;
+    uint64_t _broadcastBytesCopied = 0;
+    std::shared_ptr<NetworkMapExport> _mapExport;
     bool _playerListInvalidated = false;
 
 private: // Client Data
@@ -219,6 +227,8 @@ private: // Client Data
     std::string _chatLogFilenameFormat = "%Y%m%d-%H%M%S.txt";
     std::string _password;
     OpenRCT2::MemoryStream _serverGameState;
+    std::shared_ptr<GameStateSnapshot_t> _serverGameStateBase;
+    uint32_t _serverGameStateBaseTick = 0;
     NetworkServerState_t _serverState;
     uint32_t _lastSentHeartbeat = 0;
     uint32_t last_ping_sent_time = 0;
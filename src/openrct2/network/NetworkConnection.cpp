@@ -89,7 +89,7 @@ NetworkReadPacket NetworkConnection::ReadPacket()
             // Received complete packet.
             _lastPacketTime = platform_get_ticks();
 
-            RecordPacketStats(InboundPacket, false);
+            RecordPacketStats(InboundPacket.GetCommand(), InboundPacket.BytesTransferred, false);
 
             return NetworkReadPacket::Success;
         }
@@ -98,42 +98,39 @@ NetworkReadPacket NetworkConnection::ReadPacket()
     return NetworkReadPacket::MoreData;
 }
 
-bool NetworkConnection::SendPacket(NetworkPacket& packet)
+bool NetworkConnection::SendPacket(OutboundPacket& packet)
 {
-    auto header = packet.Header;
+    const auto& bytes = packet.Wire->Bytes;
 
-    std::vector<uint8_t> buffer;
-    buffer.reserve(sizeof(header) + header.Size);
-
-    // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
-    // Previously the Id field was not part of the header rather part of the body.
-    header.Size += sizeof(header.Id);
-    header.Size = Convert::HostToNetwork(header.Size);
-    header.Id = ByteSwapBE(header.Id);
-
-    buffer.insert(buffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
-    buffer.insert(buffer.end(), packet.Data.begin(), packet.Data.end());
-
-    size_t bufferSize = buffer.size() - packet.BytesTransferred;
-    size_t sent = Socket->SendData(buffer.data() + packet.BytesTransferred, bufferSize);
+    size_t bufferSize = bytes.size() - packet.BytesTransferred;
+    size_t sent = Socket->SendData(bytes.data() + packet.BytesTransferred, bufferSize);
     if (sent > 0)
     {
         packet.BytesTransferred += sent;
     }
 
-    bool sendComplete = packet.BytesTransferred == buffer.size();
+    bool sendComplete = packet.BytesTransferred == bytes.size();
     if (sendComplete)
     {
-        RecordPacketStats(packet, true);
+        RecordPacketStats(packet.Wire->Command, packet.BytesTransferred, true);
     }
     return sendComplete;
 }
 
-void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
+void NetworkConnection::QueuePacket(const NetworkPacket& packet, bool front)
 {
     if (AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
     {
-        packet.Header.Size = static_cast<uint16_t>(packet.Data.size());
+        auto wire = packet.Serialise();
+        Stats.bytesCopied += wire->Bytes.size();
+        QueuePacket(wire, front);
+    }
+}
+
+void NetworkConnection::QueuePacket(const NetworkWireBufferPtr& wire, bool front)
+{
+    if (AuthStatus == NetworkAuth::Ok || !NetworkPacket::CommandRequiresAuth(wire->Command))
+    {
         if (front)
         {
             // If the first packet was already partially sent add new packet to second position
@@ -141,16 +138,16 @@ void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
             {
                 auto it = _outboundPackets.begin();
                 it++; // Second position
-                _outboundPackets.insert(it, std::move(packet));
+                _outboundPackets.insert(it, OutboundPacket{ wire });
             }
             else
             {
-                _outboundPackets.push_front(std::move(packet));
+                _outboundPackets.push_front(OutboundPacket{ wire });
             }
         }
         else
         {
-            _outboundPackets.push_back(std::move(packet));
+            _outboundPackets.push_back(OutboundPacket{ wire });
         }
     }
 }
@@ -207,12 +204,11 @@ void NetworkConnection::SetLastDisconnectReason(const rct_string_id string_id, v
     SetLastDisconnectReason(buffer);
 }
 
-void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool sending)
+void NetworkConnection::RecordPacketStats(NetworkCommand command, size_t packetSize, bool sending)
 {
-    uint32_t packetSize = static_cast<uint32_t>(packet.BytesTransferred);
     NetworkStatisticsGroup trafficGroup;
 
-    switch (packet.GetCommand())
+    switch (command)
     {
         case NetworkCommand::GameAction:
             trafficGroup = NetworkStatisticsGroup::Commands;
@@ -20,6 +20,7 @@
 #    include <memory>
 #    include <vector>
 
+class NetworkMapExport;
 class NetworkPlayer;
 struct ObjectRepositoryItem;
 
@@ -35,18 +36,16 @@ public:
     NetworkKey Key;
     std::vector<uint8_t> Challenge;
     std::vector<const ObjectRepositoryItem*> RequestedObjects;
+    std::shared_ptr<NetworkMapExport> MapTransfer;
+    size_t MapTransferOffset = 0;
     bool IsDisconnected = false;
 
     NetworkConnection();
     ~NetworkConnection();
 
     NetworkReadPacket ReadPacket();
-    void QueuePacket(NetworkPacket&& packet, bool front = false);
-    void QueuePacket(const NetworkPacket& packet, bool front = false)
-    {
-        auto copy = packet;
-        return QueuePacket(std::move(copy), front);
-    }
+    void QueuePacket(const NetworkPacket& packet, bool front = false);
+    void QueuePacket(const NetworkWireBufferPtr& wire, bool front = false);
 
     void SendQueuedPackets();
     void ResetLastPacketTime();
@@ -57,12 +56,18 @@ public:
     void SetLastDisconnectReason(const rct_string_id string_id, void* args = nullptr);
 
 private:
-    std::deque<NetworkPacket> _outboundPackets;
+    struct OutboundPacket
+    {
+        NetworkWireBufferPtr Wire;
+        size_t BytesTransferred = 0;
+    };
+
+    std::deque<OutboundPacket> _outboundPackets;
     uint32_t _lastPacketTime = 0;
     utf8* _lastDisconnectReason = nullptr;
 
-    void RecordPacketStats(const NetworkPacket& packet, bool sending);
-    bool SendPacket(NetworkPacket& packet);
+    void RecordPacketStats(NetworkCommand command, size_t packetSize, bool sending);
+    bool SendPacket(OutboundPacket& packet);
 };
 
 #endif // DISABLE_NETWORK
@@ -0,0 +1,144 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include "NetworkMapExport.h"
+
+#    include "../Diagnostic.h"
+#    include "NetworkPacket.h"
+
+#    include <algorithm>
+#    include <cstring>
+#    include <zlib.h>
+
+// Prefix of compressed maps, see NetworkBase::Client_Handle_MAP.
+static constexpr const char MapHeaderZlib[] = "open2_sv6_zlib";
+static constexpr size_t DeflateBufferSize = 64 * 1024;
+
+std::shared_ptr<NetworkMapExport> NetworkMapExport::Start(
+    uint32_t tick, const std::vector<const ObjectRepositoryItem*>& objects, OpenRCT2::MemoryStream&& data)
+{
+    auto mapExport = std::make_shared<NetworkMapExport>(tick, objects);
+    mapExport->_data = std::move(data);
+
+    // The thread is owned by the export, dropping the last reference cancels the compression and joins it.
+    auto exportPtr = mapExport.get();
+    mapExport->_thread = std::thread([exportPtr]() -> void { exportPtr->Deflate(); });
+    return mapExport;
+}
+
+NetworkMapExport::NetworkMapExport(uint32_t tick, const std::vector<const ObjectRepositoryItem*>& objects)
+    : Tick(tick)
+    , Objects(objects)
+{
+    _compressed.assign(std::begin(MapHeaderZlib), std::end(MapHeaderZlib));
+}
+
+NetworkMapExport::~NetworkMapExport()
+{
+    _cancelled = true;
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+}
+
+bool NetworkMapExport::HasFailed()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _failed;
+}
+
+bool NetworkMapExport::IsComplete(size_t offset)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _finished && offset >= _compressed.size();
+}
+
+size_t NetworkMapExport::WriteHeader(NetworkPacket& packet)
+{
+    // Never the final chunk, compressed data always follows.
+    packet << static_cast<uint32_t>(0) << static_cast<uint32_t>(0);
+    packet.Write(MapHeaderZlib, sizeof(MapHeaderZlib));
+    return sizeof(MapHeaderZlib);
+}
+
+size_t NetworkMapExport::WriteChunk(NetworkPacket& packet, size_t offset, size_t chunkSize)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    size_t available = _compressed.size();
+    if (_failed || offset >= available)
+        return 0;
+
+    // Hold back the tail while compressing so the final chunk is always the one carrying the total size.
+    if (!_finished && available - offset <= chunkSize)
+        return 0;
+
+    size_t length = std::min(chunkSize, available - offset);
+    uint32_t totalSize = _finished ? static_cast<uint32_t>(available) : 0;
+    packet << totalSize << static_cast<uint32_t>(offset);
+    packet.Write(&_compressed[offset], length);
+    return length;
+}
+
+void NetworkMapExport::Deflate()
+{
+    auto size = _data.GetLength();
+
+    z_stream strm{};
+    int ret = deflateInit(&strm, Z_DEFAULT_COMPRESSION);
+    if (ret == Z_OK)
+    {
+        strm.next_in = static_cast<Bytef*>(const_cast<void*>(_data.GetData()));
+        strm.avail_in = static_cast<uInt>(size);
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _compressed.reserve(_compressed.size() + deflateBound(&strm, static_cast<uLong>(size)));
+        }
+
+        std::vector<uint8_t> buffer(DeflateBufferSize);
+        do
+        {
+            if (_cancelled)
+                break;
+            strm.next_out = buffer.data();
+            strm.avail_out = static_cast<uInt>(buffer.size());
+            ret = deflate(&strm, Z_FINISH);
+            if (ret == Z_STREAM_ERROR)
+                break;
+            Append(buffer.data(), buffer.size() - strm.avail_out);
+        } while (ret != Z_STREAM_END);
+        deflateEnd(&strm);
+    }
+
+    // The uncompressed data is no longer needed.
+    _data = OpenRCT2::MemoryStream();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _finished = true;
+    if (ret != Z_STREAM_END)
+    {
+        if (!_cancelled)
+            log_warning("Failed to compress the map.");
+        _failed = true;
+        return;
+    }
+    log_verbose(
+        "Sending map of size %u bytes, compressed to %u bytes", static_cast<uint32_t>(size),
+        static_cast<uint32_t>(_compressed.size()));
+}
+
+void NetworkMapExport::Append(const uint8_t* data, size_t length)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _compressed.insert(_compressed.end(), data, data + length);
+}
+
+#endif // DISABLE_NETWORK
@@ -0,0 +1,86 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifndef DISABLE_NETWORK
+
+#    include "../common.h"
+#    include "../core/MemoryStream.h"
+
+#    include <atomic>
+#    include <memory>
+#    include <mutex>
+#    include <thread>
+#    include <vector>
+
+struct NetworkPacket;
+struct ObjectRepositoryItem;
+
+/**
+ * A map exported for joining clients. The export itself is taken on the game thread, compression runs on a
+ * background thread and the compressed bytes can be sent while they are being produced. The same export is
+ * shared by all clients that request the map during the same tick with the same packed objects.
+ */
+class NetworkMapExport final
+{
+public:
+    const uint32_t Tick;
+    const std::vector<const ObjectRepositoryItem*> Objects;
+
+    /**
+     * Starts compressing the exported map data on a background thread.
+     */
+    static std::shared_ptr<NetworkMapExport> Start(
+        uint32_t tick, const std::vector<const ObjectRepositoryItem*>& objects, OpenRCT2::MemoryStream&& data);
+
+    NetworkMapExport(uint32_t tick, const std::vector<const ObjectRepositoryItem*>& objects);
+    NetworkMapExport(const NetworkMapExport&) = delete;
+
+    /**
+     * Stops the compression if it is still running and waits for the background thread.
+     */
+    ~NetworkMapExport();
+
+    bool HasFailed();
+
+    /**
+     * Whether the compression has finished and the map has been written up to offset.
+     */
+    bool IsComplete(size_t offset);
+
+    /**
+     * Writes the first map chunk which only holds the header, it can be sent before any data is compressed.
+     * @return The amount of map bytes written.
+     */
+    size_t WriteHeader(NetworkPacket& packet);
+
+    /**
+     * Writes the next map chunk starting at offset into the packet. The total size is only sent with the final
+     * chunks, the preceding chunks carry a size of 0 while the compression has not finished yet.
+     * @return The amount of map bytes written, 0 if no chunk is ready yet.
+     */
+    size_t WriteChunk(NetworkPacket& packet, size_t offset, size_t chunkSize);
+
+private:
+    OpenRCT2::MemoryStream _data;
+
+    std::mutex _mutex;
+    std::vector<uint8_t> _compressed;
+    bool _finished = false;
+    bool _failed = false;
+
+    std::atomic<bool> _cancelled{ false };
+    std::thread _thread;
+
+    void Deflate();
+    void Append(const uint8_t* data, size_t length);
+};
+
+#endif // DISABLE_NETWORK
@@ -12,6 +12,7 @@
 #    include "NetworkPacket.h"
 
 #    include "NetworkTypes.h"
+#    include "Socket.h"
 
 #    include <memory>
 
@@ -42,9 +43,14 @@ void NetworkPacket::Clear()
     Data.clear();
 }
 
-bool NetworkPacket::CommandRequiresAuth()
+bool NetworkPacket::CommandRequiresAuth() const
 {
-    switch (GetCommand())
+    return CommandRequiresAuth(GetCommand());
+}
+
+bool NetworkPacket::CommandRequiresAuth(NetworkCommand command)
+{
+    switch (command)
     {
         case NetworkCommand::Ping:
         case NetworkCommand::Auth:
@@ -59,6 +65,26 @@ bool NetworkPacket::CommandRequiresAuth()
     }
 }
 
+NetworkWireBufferPtr NetworkPacket::Serialise() const
+{
+    auto header = Header;
+    header.Size = static_cast<uint16_t>(Data.size());
+
+    // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
+    // Previously the Id field was not part of the header rather part of the body.
+    header.Size += sizeof(header.Id);
+    header.Size = Convert::HostToNetwork(header.Size);
+    header.Id = ByteSwapBE(header.Id);
+
+    auto wire = std::make_shared<NetworkWireBuffer>();
+    wire->Command = GetCommand();
+    wire->Bytes.reserve(sizeof(header) + Data.size());
+    wire->Bytes.insert(
+        wire->Bytes.end(), reinterpret_cast<const uint8_t*>(&header), reinterpret_cast<const uint8_t*>(&header) + sizeof(header));
+    wire->Bytes.insert(wire->Bytes.end(), Data.begin(), Data.end());
+    return wire;
+}
+
 void NetworkPacket::Write(const void* bytes, size_t size)
 {
     const uint8_t* src = reinterpret_cast<const uint8_t*>(bytes);
@@ -25,6 +25,17 @@ struct PacketHeader
 static_assert(sizeof(PacketHeader) == 6);
 #pragma pack(pop)
 
+/**
+ * Immutable, fully serialised packet: the header in network byte order followed by the payload.
+ * Built once and then shared by every connection the packet is queued on.
+ */
+struct NetworkWireBuffer final
+{
+    NetworkCommand Command = NetworkCommand::Invalid;
+    std::vector<uint8_t> Bytes;
+};
+using NetworkWireBufferPtr = std::shared_ptr<const NetworkWireBuffer>;
+
 struct NetworkPacket final
 {
     NetworkPacket() = default;
@@ -36,7 +47,10 @@ struct NetworkPacket final
     NetworkCommand GetCommand() const;
 
     void Clear();
-    bool CommandRequiresAuth();
+    bool CommandRequiresAuth() const;
+    static bool CommandRequiresAuth(NetworkCommand command);
+
+    NetworkWireBufferPtr Serialise() const;
 
     const uint8_t* Read(size_t size);
     const utf8* ReadString();
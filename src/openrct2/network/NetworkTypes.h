@@ -145,4 +145,6 @@ struct NetworkStats_t
 {
     uint64_t bytesReceived[EnumValue(NetworkStatisticsGroup::Max)];
     uint64_t bytesSent[EnumValue(NetworkStatisticsGroup::Max)];
+    // Bytes copied while serialising outgoing packets, broadcasts are only counted once.
+    uint64_t bytesCopied;
 };
@@ -9,6 +9,7 @@
 
 #ifndef DISABLE_NETWORK
 
+#    include <algorithm>
 #    include <atomic>
 #    include <chrono>
 #    include <cmath>
@@ -16,6 +17,7 @@
 #    include <future>
 #    include <string>
 #    include <thread>
+#    include <unordered_set>
 
 // clang-format off
 // MSVC: include <math.h> here otherwise PI gets defined twice
@@ -59,6 +61,7 @@
     #define closesocket close
     #define ioctlsocket ioctl
     #if defined(__linux__)
+        #include <sys/epoll.h>
         #define FLAG_NO_PIPE MSG_NOSIGNAL
     #else
         #define FLAG_NO_PIPE 0
@@ -459,9 +462,7 @@ public:
 
             do
             {
-                // Sleep for a bit
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
-
+                // Wait for the socket to become writable, select returns as soon as the connection is established.
                 fd_set writeFD;
                 FD_ZERO(&writeFD);
 #    pragma warning(push)
@@ -470,7 +471,7 @@ public:
 #    pragma warning(pop)
                 timeval timeout{};
                 timeout.tv_sec = 0;
-                timeout.tv_usec = 0;
+                timeout.tv_usec = 100 * 1000;
                 if (select(static_cast<int32_t>(_socket + 1), nullptr, &writeFD, nullptr, &timeout) > 0)
                 {
                     error = 0;
@@ -629,6 +630,11 @@ public:
         return _ipAddress;
     }
 
+    SOCKET GetSocket() const
+    {
+        return _socket;
+    }
+
 private:
     explicit TcpSocket(SOCKET socket, const std::string& hostName, const std::string& ipAddress)
     {
@@ -883,6 +889,107 @@ private:
     }
 };
 
+/**
+ * Used where no readiness API is available, every socket has to be polled.
+ */
+class PollingTcpSocketPoller final : public ITcpSocketPoller
+{
+public:
+    bool IsEventDriven() const override
+    {
+        return false;
+    }
+
+    void Add(ITcpSocket& socket) override
+    {
+    }
+
+    void Remove(ITcpSocket& socket) override
+    {
+    }
+
+    bool Wait(uint32_t timeoutMs) override
+    {
+        return false;
+    }
+
+    bool IsReadable(const ITcpSocket& socket) const override
+    {
+        return true;
+    }
+};
+
+#    ifdef __linux__
+class EpollTcpSocketPoller final : public ITcpSocketPoller
+{
+private:
+    int32_t _epoll = -1;
+    size_t _count = 0;
+    std::vector<epoll_event> _events;
+    std::unordered_set<const ITcpSocket*> _readable;
+
+public:
+    EpollTcpSocketPoller()
+    {
+        _epoll = epoll_create1(EPOLL_CLOEXEC);
+        if (_epoll == -1)
+        {
+            throw SocketException("Unable to create epoll instance.");
+        }
+    }
+
+    ~EpollTcpSocketPoller() override
+    {
+        close(_epoll);
+    }
+
+    bool IsEventDriven() const override
+    {
+        return true;
+    }
+
+    void Add(ITcpSocket& socket) override
+    {
+        epoll_event ev{};
+        ev.events = EPOLLIN | EPOLLRDHUP;
+        ev.data.ptr = &socket;
+        if (epoll_ctl(_epoll, EPOLL_CTL_ADD, static_cast<TcpSocket&>(socket).GetSocket(), &ev) != 0)
+        {
+            log_error("Unable to watch socket. %d", LAST_SOCKET_ERROR());
+            return;
+        }
+        _count++;
+    }
+
+    void Remove(ITcpSocket& socket) override
+    {
+        if (epoll_ctl(_epoll, EPOLL_CTL_DEL, static_cast<TcpSocket&>(socket).GetSocket(), nullptr) == 0)
+        {
+            _count--;
+        }
+        _readable.erase(&socket);
+    }
+
+    bool Wait(uint32_t timeoutMs) override
+    {
+        _events.resize(std::max<size_t>(_count, 1));
+        _readable.clear();
+
+        int32_t numEvents = epoll_wait(_epoll, _events.data(), static_cast<int32_t>(_events.size()), static_cast<int32_t>(timeoutMs));
+        for (int32_t i = 0; i < numEvents; i++)
+        {
+            _readable.insert(static_cast<const ITcpSocket*>(_events[i].data.ptr));
+        }
+        return numEvents > 0;
+    }
+
+    bool IsReadable(const ITcpSocket& socket) const override
+    {
+        return _readable.find(&socket) != _readable.end();
+    }
+};
+#    endif
+
 std::unique_ptr<ITcpSocket> CreateTcpSocket()
 {
     InitialiseWSA();
@@ -895,6 +1002,21 @@ std::unique_ptr<IUdpSocket> CreateUdpSocket()
     return std::make_unique<UdpSocket>();
 }
 
+std::unique_ptr<ITcpSocketPoller> CreateTcpSocketPoller()
+{
+#    ifdef __linux__
+    try
+    {
+        return std::make_unique<EpollTcpSocketPoller>();
+    }
+    catch (const std::exception& e)
+    {
+        log_warning("%s Falling back to polling every socket.", e.what());
+    }
+#    endif
+    return std::make_unique<PollingTcpSocketPoller>();
+}
+
 #    ifdef _WIN32
 static std::vector<INTERFACE_INFO> GetNetworkInterfaces()
 {
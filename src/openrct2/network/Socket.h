@@ -98,8 +98,38 @@ public:
     virtual void Close() abstract;
 };
 
+/**
+ * Waits for incoming data on many TCP sockets at once, listening sockets become readable when a client connects.
+ * Backed by epoll on Linux, elsewhere every socket is reported as readable so the caller keeps polling all of them.
+ */
+struct ITcpSocketPoller
+{
+public:
+    virtual ~ITcpSocketPoller() = default;
+
+    /**
+     * Whether Wait can block until a socket is ready, false if the caller has to poll every socket.
+     */
+    virtual bool IsEventDriven() const abstract;
+
+    virtual void Add(ITcpSocket& socket) abstract;
+    virtual void Remove(ITcpSocket& socket) abstract;
+
+    /**
+     * Blocks for at most timeoutMs until one of the sockets can be read from.
+     * @return true if at least one socket is ready.
+     */
+    virtual bool Wait(uint32_t timeoutMs) abstract;
+
+    /**
+     * Whether the socket had data or was closed by the remote end during the last Wait.
+     */
+    virtual bool IsReadable(const ITcpSocket& socket) const abstract;
+};
+
 std::unique_ptr<ITcpSocket> CreateTcpSocket();
 std::unique_ptr<IUdpSocket> CreateUdpSocket();
+std::unique_ptr<ITcpSocketPoller> CreateTcpSocketPoller();
 std::vector<std::unique_ptr<INetworkEndpoint>> GetBroadcastAddresses();
 
 namespace Convert
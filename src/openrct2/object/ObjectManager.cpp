@@ -12,6 +12,7 @@
 #include "../Context.h"
 #include "../ParkImporter.h"
 #include "../core/Console.hpp"
+#include "../core/JobPool.h"
 #include "../core/Memory.hpp"
 #include "../localisation/StringIds.h"
 #include "../util/Util.h"
@@ -29,7 +30,6 @@
 #include <array>
 #include <memory>
 #include <mutex>
-#include <thread>
 #include <unordered_set>
 
 class ObjectManager final : public IObjectManager
@@ -42,6 +42,9 @@ private:
     // Used to return a safe empty vector back from GetAllRideEntries, can be removed when std::span is available
     std::vector<ObjectEntryIndex> _nullRideTypeEntries;
 
+    // Created on first use, reading objects is the only work that runs on it.
+    std::unique_ptr<JobPool> _loadJobs;
+
 public:
     explicit ObjectManager(IObjectRepository& objectRepository)
         : _objectRepository(objectRepository)
@@ -572,28 +575,13 @@ private:
         return requiredObjects;
     }
 
-    template<typename T, typename TFunc> static void ParallelFor(const std::vector<T>& items, TFunc func)
+    template<typename T, typename TFunc> void ParallelFor(const std::vector<T>& items, TFunc func)
     {
-        auto partitions = std::thread::hardware_concurrency();
-        auto partitionSize = (items.size() + (partitions - 1)) / partitions;
-        std::vector<std::thread> threads;
-        for (size_t n = 0; n < partitions; n++)
-        {
-            auto begin = n * partitionSize;
-            auto end = std::min(items.size(), begin + partitionSize);
-            threads.emplace_back(
-                [func](size_t pbegin, size_t pend) {
-                    for (size_t i = pbegin; i < pend; i++)
-                    {
-                        func(i);
-                    }
-                },
-                begin, end);
-        }
-        for (auto& t : threads)
+        if (_loadJobs == nullptr)
         {
-            t.join();
+            _loadJobs = std::make_unique<JobPool>();
         }
+        _loadJobs->ParallelFor(items.size(), func);
     }
 
     std::vector<std::unique_ptr<Object>> LoadObjects(
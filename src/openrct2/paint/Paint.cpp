@@ -22,6 +22,8 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <limits>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -183,20 +185,102 @@ static std::optional<paint_struct> CreateNormalPaintStruct(
     return { ps };
 }
 
+/**
+ * Tiles and sprites set up by the previous columns of a strip. A column shares tiles with the column next to it and
+ * sprites with up to three columns to the left, always in the same or a neighbouring row.
+ */
+class PaintColumnVisits
+{
+public:
+    // Tiles use the first two slots of a row, sprites the other four.
+    static constexpr size_t TileSlots = 2;
+    static constexpr size_t SlotsPerRow = 6;
+
+    explicit PaintColumnVisits(size_t rows)
+        : _rows(rows)
+        , _visits(ColumnHistory * rows * SlotsPerRow, Unvisited)
+    {
+    }
+
+    /**
+     * Records the position and returns false if a previous column has already set it up.
+     */
+    bool Visit(size_t row, size_t slot, int16_t x, int16_t y)
+    {
+        const CoordsXY pos{ x, y };
+        const bool isTile = slot < TileSlots;
+        for (size_t back = 1; back < ColumnHistory && back <= _column; back++)
+        {
+            const size_t firstRow = row > 0 ? row - 1 : 0;
+            const size_t lastRow = std::min(row + 1, _rows - 1);
+            for (size_t r = firstRow; r <= lastRow; r++)
+            {
+                const CoordsXY* visits = &_visits[Index(_column - back, r, 0)];
+                for (size_t i = isTile ? 0 : TileSlots; i < (isTile ? TileSlots : SlotsPerRow); i++)
+                {
+                    if (visits[i] == pos)
+                    {
+                        _visits[Index(_column, row, slot)] = pos;
+                        return false;
+                    }
+                }
+            }
+        }
+        _visits[Index(_column, row, slot)] = pos;
+        return true;
+    }
+
+    void NextColumn()
+    {
+        _column++;
+        std::fill_n(&_visits[Index(_column, 0, 0)], _rows * SlotsPerRow, Unvisited);
+    }
+
+private:
+    static constexpr size_t ColumnHistory = 4;
+    // Map positions are 16 bit, this never matches one.
+    static constexpr CoordsXY Unvisited{ std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::min() };
+
+    size_t _rows;
+    size_t _column = 0;
+    std::vector<CoordsXY> _visits;
+
+    size_t Index(size_t column, size_t row, size_t slot) const
+    {
+        return ((column % ColumnHistory) * _rows + row) * SlotsPerRow + slot;
+    }
+};
+
+static void PaintSetupTile(paint_session* session, PaintColumnVisits* visits, size_t row, size_t slot, int16_t x, int16_t y)
+{
+    if (visits == nullptr || visits->Visit(row, slot, x, y))
+    {
+        tile_element_paint_setup(session, x, y);
+    }
+}
+
+static void PaintSetupSprites(
+    paint_session* session, PaintColumnVisits* visits, size_t row, size_t slot, int16_t x, int16_t y)
+{
+    if (visits == nullptr || visits->Visit(row, PaintColumnVisits::TileSlots + slot, x, y))
+    {
+        sprite_paint_setup(session, x, y);
+    }
+}
+
 /**
  *
  *  rct2: 0x0068B6C2
  */
-void PaintSessionGenerate(paint_session* session)
+static void PaintSessionGenerateColumn(paint_session* session, int16_t columnX, PaintColumnVisits* visits)
 {
     rct_drawpixelinfo* dpi = &session->DPI;
-    LocationXY16 mapTile = { static_cast<int16_t>(dpi->x & 0xFFE0), static_cast<int16_t>((dpi->y - 16) & 0xFFE0) };
+    LocationXY16 mapTile = { columnX, static_cast<int16_t>((dpi->y - 16) & 0xFFE0) };
 
     int16_t half_x = mapTile.x >> 1;
-    uint16_t num_vertical_quadrants = (dpi->height + 2128) >> 5;
+    const uint16_t rows = (dpi->height + 2128) >> 5;
 
-    session->CurrentRotation = get_current_rotation();
-    switch (get_current_rotation())
+    switch (session->CurrentRotation)
     {
         case 0:
             mapTile.x = mapTile.y - half_x;
@@ -205,18 +289,18 @@ void PaintSessionGenerate(paint_session* session)
             mapTile.x &= 0xFFE0;
             mapTile.y &= 0xFFE0;
 
-            for (; num_vertical_quadrants > 0; --num_vertical_quadrants)
+            for (uint16_t row = 0; row < rows; row++)
             {
-                tile_element_paint_setup(session, mapTile.x, mapTile.y);
-                sprite_paint_setup(session, mapTile.x, mapTile.y);
+                PaintSetupTile(session, visits, row, 0, mapTile.x, mapTile.y);
+                PaintSetupSprites(session, visits, row, 0, mapTile.x, mapTile.y);
 
-                sprite_paint_setup(session, mapTile.x - 32, mapTile.y + 32);
+                PaintSetupSprites(session, visits, row, 1, mapTile.x - 32, mapTile.y + 32);
 
-                tile_element_paint_setup(session, mapTile.x, mapTile.y + 32);
-                sprite_paint_setup(session, mapTile.x, mapTile.y + 32);
+                PaintSetupTile(session, visits, row, 1, mapTile.x, mapTile.y + 32);
+                PaintSetupSprites(session, visits, row, 2, mapTile.x, mapTile.y + 32);
 
                 mapTile.x += 32;
-                sprite_paint_setup(session, mapTile.x, mapTile.y);
+                PaintSetupSprites(session, visits, row, 3, mapTile.x, mapTile.y);
 
                 mapTile.y += 32;
             }
@@ -228,18 +312,18 @@ void PaintSessionGenerate(paint_session* session)
             mapTile.x &= 0xFFE0;
             mapTile.y &= 0xFFE0;
 
-            for (; num_vertical_quadrants > 0; --num_vertical_quadrants)
+            for (uint16_t row = 0; row < rows; row++)
             {
-                tile_element_paint_setup(session, mapTile.x, mapTile.y);
-                sprite_paint_setup(session, mapTile.x, mapTile.y);
+                PaintSetupTile(session, visits, row, 0, mapTile.x, mapTile.y);
+                PaintSetupSprites(session, visits, row, 0, mapTile.x, mapTile.y);
 
-                sprite_paint_setup(session, mapTile.x - 32, mapTile.y - 32);
+                PaintSetupSprites(session, visits, row, 1, mapTile.x - 32, mapTile.y - 32);
 
-                tile_element_paint_setup(session, mapTile.x - 32, mapTile.y);
-                sprite_paint_setup(session, mapTile.x - 32, mapTile.y);
+                PaintSetupTile(session, visits, row, 1, mapTile.x - 32, mapTile.y);
+                PaintSetupSprites(session, visits, row, 2, mapTile.x - 32, mapTile.y);
 
                 mapTile.y += 32;
-                sprite_paint_setup(session, mapTile.x, mapTile.y);
+                PaintSetupSprites(session, visits, row, 3, mapTile.x, mapTile.y);
 
                 mapTile.x -= 32;
             }
@@ -251,19 +335,19 @@ void PaintSessionGenerate(paint_session* session)
             mapTile.x &= 0xFFE0;
             mapTile.y &= 0xFFE0;
 
-            for (; num_vertical_quadrants > 0; --num_vertical_quadrants)
+            for (uint16_t row = 0; row < rows; row++)
             {
-                tile_element_paint_setup(session, mapTile.x, mapTile.y);
-                sprite_paint_setup(session, mapTile.x, mapTile.y);
+                PaintSetupTile(session, visits, row, 0, mapTile.x, mapTile.y);
+                PaintSetupSprites(session, visits, row, 0, mapTile.x, mapTile.y);
 
-                sprite_paint_setup(session, mapTile.x + 32, mapTile.y - 32);
+                PaintSetupSprites(session, visits, row, 1, mapTile.x + 32, mapTile.y - 32);
 
-                tile_element_paint_setup(session, mapTile.x, mapTile.y - 32);
-                sprite_paint_setup(session, mapTile.x, mapTile.y - 32);
+                PaintSetupTile(session, visits, row, 1, mapTile.x, mapTile.y - 32);
+                PaintSetupSprites(session, visits, row, 2, mapTile.x, mapTile.y - 32);
 
                 mapTile.x -= 32;
 
-                sprite_paint_setup(session, mapTile.x, mapTile.y);
+                PaintSetupSprites(session, visits, row, 3, mapTile.x, mapTile.y);
 
                 mapTile.y -= 32;
             }
@@ -275,19 +359,19 @@ void PaintSessionGenerate(paint_session* session)
             mapTile.x &= 0xFFE0;
             mapTile.y &= 0xFFE0;
 
-            for (; num_vertical_quadrants > 0; --num_vertical_quadrants)
+            for (uint16_t row = 0; row < rows; row++)
             {
-                tile_element_paint_setup(session, mapTile.x, mapTile.y);
-                sprite_paint_setup(session, mapTile.x, mapTile.y);
+                PaintSetupTile(session, visits, row, 0, mapTile.x, mapTile.y);
+                PaintSetupSprites(session, visits, row, 0, mapTile.x, mapTile.y);
 
-                sprite_paint_setup(session, mapTile.x + 32, mapTile.y + 32);
+                PaintSetupSprites(session, visits, row, 1, mapTile.x + 32, mapTile.y + 32);
 
-                tile_element_paint_setup(session, mapTile.x + 32, mapTile.y);
-                sprite_paint_setup(session, mapTile.x + 32, mapTile.y);
+                PaintSetupTile(session, visits, row, 1, mapTile.x + 32, mapTile.y);
+                PaintSetupSprites(session, visits, row, 2, mapTile.x + 32, mapTile.y);
 
                 mapTile.y -= 32;
 
-                sprite_paint_setup(session, mapTile.x, mapTile.y);
+                PaintSetupSprites(session, visits, row, 3, mapTile.x, mapTile.y);
 
                 mapTile.x += 32;
             }
@@ -295,6 +379,28 @@ void PaintSessionGenerate(paint_session* session)
     }
 }
 
+void PaintSessionGenerate(paint_session* session)
+{
+    rct_drawpixelinfo* dpi = &session->DPI;
+    session->CurrentRotation = get_current_rotation();
+
+    // Sessions wider than one 32 pixel column are set up column by column.
+    const int16_t firstColumnX = static_cast<int16_t>(dpi->x & 0xFFE0);
+    const int32_t columnCount = std::max(1, (dpi->x + dpi->width - firstColumnX + 31) / 32);
+    if (columnCount == 1)
+    {
+        PaintSessionGenerateColumn(session, firstColumnX, nullptr);
+        return;
+    }
+
+    PaintColumnVisits visits((dpi->height + 2128) >> 5);
+    for (int32_t column = 0; column < columnCount; column++)
+    {
+        PaintSessionGenerateColumn(session, static_cast<int16_t>(firstColumnX + column * 32), &visits);
+        visits.NextColumn();
+    }
+}
+
 template<uint8_t>
 static bool CheckBoundingBox(const paint_struct_bound_box& initialBBox, const paint_struct_bound_box& currentBBox)
 {
@@ -528,16 +634,19 @@ static void PaintDrawStruct(paint_session* session, paint_struct* ps)
  *
  *  rct2: 0x00688485
  */
-void PaintDrawStructs(paint_session* session)
+uint32_t PaintDrawStructs(paint_session* session)
 {
     paint_struct* ps = &session->PaintHead;
 
+    uint32_t count = 0;
     for (ps = ps->next_quadrant_ps; ps;)
     {
         PaintDrawStruct(session, ps);
+        count++;
 
         ps = ps->next_quadrant_ps;
     }
+    return count;
 }
 
 /**
@@ -2696,12 +2696,12 @@ static PeepThoughtType peep_assess_surroundings(int16_t centre_x, int16_t centre
     uint16_t nearby_music = 0;
     uint16_t num_rubbish = 0;
 
-    int16_t initial_x = std::max(centre_x - 160, 0);
-    int16_t initial_y = std::max(centre_y - 160, 0);
-    int16_t final_x = std::min(centre_x + 160, MAXIMUM_MAP_SIZE_BIG);
-    int16_t final_y = std::min(centre_y + 160, MAXIMUM_MAP_SIZE_BIG);
+    int32_t initial_x = std::max(centre_x - 160, 0);
+    int32_t initial_y = std::max(centre_y - 160, 0);
+    int32_t final_x = std::min(centre_x + 160, map_get_size_big());
+    int32_t final_y = std::min(centre_y + 160, map_get_size_big());
 
-    for (int16_t x = initial_x; x < final_x; x += COORDS_XY_STEP)
+    for (int32_t x = initial_x; x < final_x; x += COORDS_XY_STEP)
     {
         for (int16_t y = initial_y; y < final_y; y += COORDS_XY_STEP)
         {
@@ -9,7 +9,10 @@
 
 #include "GuestPathfinding.h"
 
+#include "../config/Config.h"
 #include "../core/Guard.hpp"
+#include "../core/JobPool.h"
+#include "../network/network.h"
 #include "../ride/RideData.h"
 #include "../ride/Station.h"
 #include "../ride/Track.h"
@@ -17,20 +20,29 @@
 #include "../util/Util.h"
 #include "../world/Entrance.h"
 #include "../world/Footpath.h"
+#include "../world/FootpathGraph.h"
 #include "Peep.h"
 #include "Staff.h"
 
+#include <algorithm>
+#include <array>
 #include <cstring>
-
-static bool _peepPathFindIsStaff;
-static int8_t _peepPathFindNumJunctions;
-static int8_t _peepPathFindMaxJunctions;
-static int32_t _peepPathFindTilesChecked;
-static uint8_t _peepPathFindFewestNumSteps;
-
-TileCoordsXYZ gPeepPathFindGoalPosition;
-bool gPeepPathFindIgnoreForeignQueues;
-ride_id_t gPeepPathFindQueueRideIndex;
+#include <deque>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// The search state is per thread, guest searches are also run ahead on worker threads (see peep_pathfind_predict_all).
+static thread_local bool _peepPathFindIsStaff;
+static thread_local int8_t _peepPathFindNumJunctions;
+static thread_local int8_t _peepPathFindMaxJunctions;
+static thread_local int32_t _peepPathFindTilesChecked;
+static thread_local uint8_t _peepPathFindFewestNumSteps;
+
+thread_local TileCoordsXYZ gPeepPathFindGoalPosition;
+thread_local bool gPeepPathFindIgnoreForeignQueues;
+thread_local ride_id_t gPeepPathFindQueueRideIndex;
 
 #if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
 // Use to guard calls to log messages
@@ -40,12 +52,13 @@ utf8 gPathFindDebugPeepName[256];
 #endif // defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
 
 static int32_t guest_surface_path_finding(Peep* peep);
+static Direction peep_pathfind_search_directions(const TileCoordsXYZ& loc, Peep* peep);
 
 /* A junction history for the peep pathfinding heuristic search
  * The magic number 16 is the largest value returned by
  * peep_pathfind_get_max_number_junctions() which should eventually
  * be declared properly. */
-static struct
+static thread_local struct
 {
     TileCoordsXYZ location;
     Direction direction;
@@ -125,7 +138,7 @@ static int32_t peep_move_one_tile(Direction direction, Peep* peep)
     assert(direction_valid(direction));
     auto newTile = CoordsXY{ CoordsXY{ peep->NextLoc } + CoordsDirectionDelta[direction] }.ToTileCentre();
 
-    if (newTile.x >= MAXIMUM_MAP_SIZE_BIG || newTile.y >= MAXIMUM_MAP_SIZE_BIG)
+    if (newTile.x >= map_get_size_big() || newTile.y >= map_get_size_big())
     {
         // This could loop!
         return guest_surface_path_finding(peep);
@@ -600,6 +613,90 @@ static constexpr const char* pathSearchToString(uint8_t pathFindSearchResult)
 }
 #endif
 
+/**
+ * Updates the search results if the search path ending at loc is better than the best so far.
+ */
+static void peep_pathfind_update_search_end(
+    const TileCoordsXYZ& loc, uint16_t score, uint8_t counter, uint16_t* endScore, uint8_t* endJunctions,
+    TileCoordsXYZ junctionList[16], uint8_t directionList[16], TileCoordsXYZ* endXYZ, uint8_t* endSteps)
+{
+    if (score < *endScore || (score == *endScore && counter < *endSteps))
+    {
+        *endScore = score;
+        *endSteps = counter;
+        *endXYZ = loc;
+        *endJunctions = _peepPathFindMaxJunctions - _peepPathFindNumJunctions;
+        for (uint8_t junctInd = 0; junctInd < *endJunctions; junctInd++)
+        {
+            uint8_t histIdx = _peepPathFindMaxJunctions - junctInd;
+            junctionList[junctInd].x = _peepPathFindHistory[histIdx].location.x;
+            junctionList[junctInd].y = _peepPathFindHistory[histIdx].location.y;
+            junctionList[junctInd].z = _peepPathFindHistory[histIdx].location.z;
+            directionList[junctInd] = _peepPathFindHistory[histIdx].direction;
+        }
+    }
+}
+
+static bool peep_pathfind_segment_contains(const FootpathGraphSegment& segment, int32_t x, int32_t y)
+{
+    return x >= segment.Min.x && x <= segment.Max.x && y >= segment.Min.y && y <= segment.Max.y;
+}
+
+/**
+ * Follows plain path tiles (see FootpathGraphTile) from loc, the tile entered through test_edge. Does what
+ * peep_pathfind_heuristic_search does on these tiles without reading their tile elements: there is only one edge to
+ * continue through, so the search path either ends on them or carries on to the next tile. Runs of plain tiles are
+ * skipped in one go when none of their tiles can end the search path.
+ *
+ * Returns false if the search path ended, otherwise loc, test_edge and counter are the first tile that is not plain.
+ */
+static bool peep_pathfind_follow_plain_paths(
+    TileCoordsXYZ& loc, Direction& test_edge, uint8_t& counter, bool& followed, uint16_t* endScore, uint8_t* endJunctions,
+    TileCoordsXYZ junctionList[16], uint8_t directionList[16], TileCoordsXYZ* endXYZ, uint8_t* endSteps)
+{
+    const FootpathGraphTile* tile;
+    while ((tile = footpath_graph_get_tile(loc)) != nullptr && (tile->Edges & (1 << direction_reverse(test_edge)))
+           && tile->IsValidEntry(loc.z, test_edge))
+    {
+        auto exitDirection = static_cast<Direction>(bitscanforward(tile->Edges & ~(1 << direction_reverse(test_edge))));
+        const auto& segment = footpath_graph_get_segment(*tile, exitDirection);
+        const auto& start = _peepPathFindHistory[0].location;
+        if (segment.Length > 1 && counter + segment.Length <= 200
+            && _peepPathFindTilesChecked >= static_cast<int32_t>(segment.Length)
+            && !peep_pathfind_segment_contains(segment, gPeepPathFindGoalPosition.x, gPeepPathFindGoalPosition.y)
+            && !peep_pathfind_segment_contains(segment, start.x, start.y))
+        {
+            // Neither the goal, the start nor a search limit is reached on the way.
+            counter += segment.Length;
+            _peepPathFindTilesChecked -= segment.Length;
+            loc = segment.End;
+            test_edge = segment.EndDirection;
+        }
+        else
+        {
+            loc.z = tile->BaseZ;
+            uint16_t score = CalculateHeuristicPathingScore(loc, gPeepPathFindGoalPosition);
+            if (score == 0 || counter >= 200 || _peepPathFindTilesChecked <= 0)
+            {
+                peep_pathfind_update_search_end(
+                    loc, score, counter, endScore, endJunctions, junctionList, directionList, endXYZ, endSteps);
+                return false;
+            }
+
+            loc = { loc.x + TileDirectionDelta[exitDirection].x, loc.y + TileDirectionDelta[exitDirection].y,
+                    tile->GetExitHeight(exitDirection) };
+            test_edge = exitDirection;
+            ++counter;
+            _peepPathFindTilesChecked--;
+        }
+        followed = true;
+
+        if (start.x == loc.x && start.y == loc.y && start.z == loc.z)
+            return false;
+    }
+    return true;
+}
+
 /**
  * Searches for the tile with the best heuristic score within the search limits
  * starting from the given tile x,y,z and going in the given direction test_edge.
@@ -699,8 +796,8 @@ static void peep_pathfind_heuristic_search(
     /* If this is where the search started this is a search loop and the
      * current search path ends here.
      * Return without updating the parameters (best result so far). */
-    if ((_peepPathFindHistory[0].location.x == static_cast<uint8_t>(loc.x))
-        && (_peepPathFindHistory[0].location.y == static_cast<uint8_t>(loc.y)) && (_peepPathFindHistory[0].location.z == loc.z))
+    if ((_peepPathFindHistory[0].location.x == loc.x) && (_peepPathFindHistory[0].location.y == loc.y)
+        && (_peepPathFindHistory[0].location.z == loc.z))
     {
 #if defined(DEBUG_LEVEL_2) && DEBUG_LEVEL_2
         if (gPathFindDebug)
@@ -730,6 +827,27 @@ static void peep_pathfind_heuristic_search(
         }
     }
 
+    bool isMechanic = peep->AssignedPeepType == PeepType::Staff && peep->AssignedStaffType == StaffType::Mechanic;
+    if (!gConfigGeneral.legacy_peep_pathfinding && !isMechanic)
+    {
+#if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+        // Every tile is logged when debugging.
+        if (!gPathFindDebug)
+#endif // defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+        {
+            bool followed = false;
+            if (!peep_pathfind_follow_plain_paths(
+                    loc, test_edge, counter, followed, endScore, endJunctions, junctionList, directionList, endXYZ,
+                    endSteps))
+            {
+                return;
+            }
+            // Plain path tiles are never wide.
+            if (followed)
+                currentElementIsWide = false;
+        }
+    }
+
     /* Get the next map element of interest in the direction of test_edge. */
     bool found = false;
     TileElement* tileElement = map_get_first_element_at(loc.ToCoordsXY());
@@ -1102,8 +1220,8 @@ static void peep_pathfind_heuristic_search(
                     for (int32_t junctionNum = _peepPathFindNumJunctions + 1; junctionNum <= _peepPathFindMaxJunctions;
                          junctionNum++)
                     {
-                        if ((_peepPathFindHistory[junctionNum].location.x == static_cast<uint8_t>(loc.x))
-                            && (_peepPathFindHistory[junctionNum].location.y == static_cast<uint8_t>(loc.y))
+                        if ((_peepPathFindHistory[junctionNum].location.x == loc.x)
+                            && (_peepPathFindHistory[junctionNum].location.y == loc.y)
                             && (_peepPathFindHistory[junctionNum].location.z == loc.z))
                         {
                             pathLoop = true;
@@ -1162,8 +1280,8 @@ static void peep_pathfind_heuristic_search(
 
                 /* This junction was NOT previously visited in the current
                  * search path, so add the junction to the history. */
-                _peepPathFindHistory[_peepPathFindNumJunctions].location.x = static_cast<uint8_t>(loc.x);
-                _peepPathFindHistory[_peepPathFindNumJunctions].location.y = static_cast<uint8_t>(loc.y);
+                _peepPathFindHistory[_peepPathFindNumJunctions].location.x = loc.x;
+                _peepPathFindHistory[_peepPathFindNumJunctions].location.y = loc.y;
                 _peepPathFindHistory[_peepPathFindNumJunctions].location.z = loc.z;
                 // .direction take is added below.
 
@@ -1251,6 +1369,380 @@ static void peep_pathfind_heuristic_search(
     }
 }
 
+/**
+ * One heuristic search of a guest from a junction, with everything besides the map and the guest type that
+ * peep_pathfind_heuristic_search reads. The search gives the same result whenever these are the same.
+ */
+struct PathSearchRecord
+{
+    TileCoordsXYZ Start;
+    const TileElement* StartElement;
+    TileCoordsXYZ Goal;
+    int32_t TilesChecked;
+    int8_t MaxJunctions;
+    ride_id_t QueueRideIndex;
+    bool IgnoreForeignQueues;
+    Direction TestEdge;
+    TileCoordsXYZD History[4];
+
+    uint16_t Score;
+    uint8_t Steps;
+    int32_t TilesLeft;
+
+    bool HasSameInputs(const PathSearchRecord& other) const
+    {
+        return Start == other.Start && StartElement == other.StartElement && Goal == other.Goal
+            && TilesChecked == other.TilesChecked && MaxJunctions == other.MaxJunctions
+            && QueueRideIndex == other.QueueRideIndex && IgnoreForeignQueues == other.IgnoreForeignQueues
+            && TestEdge == other.TestEdge && std::equal(std::begin(History), std::end(History), std::begin(other.History));
+    }
+};
+
+// The searches a guest is expected to run when it next chooses a direction.
+struct PathfindPrediction
+{
+    const Guest* Peep;
+    uint8_t Count;
+    std::array<PathSearchRecord, NumOrthogonalDirections> Searches;
+};
+
+static std::unique_ptr<JobPool> _pathfindJobs;
+static std::vector<PathfindPrediction> _pathfindPredictions;
+// Index into _pathfindPredictions by sprite index, -1 when there is none.
+static std::vector<int32_t> _pathfindPredictionIndex;
+// Set on the threads running the predictions, searches are recorded instead of looked up.
+static thread_local PathfindPrediction* _pathfindRecording = nullptr;
+
+/**
+ * Looks up a search with the same inputs that was run ahead for this guest and fills in its result.
+ */
+static bool peep_pathfind_get_predicted_search(const Peep* peep, PathSearchRecord& search)
+{
+#if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+    // The junction lists of the search are only logged, they are not kept.
+    if (gPathFindDebug)
+        return false;
+#endif // defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+
+    if (_pathfindRecording != nullptr || _pathfindPredictionIndex.empty() || peep->AssignedPeepType != PeepType::Guest)
+        return false;
+
+    auto index = _pathfindPredictionIndex[peep->sprite_index];
+    if (index == -1 || _pathfindPredictions[index].Peep != peep)
+        return false;
+
+    const auto& prediction = _pathfindPredictions[index];
+    for (uint8_t i = 0; i < prediction.Count; i++)
+    {
+        if (prediction.Searches[i].HasSameInputs(search))
+        {
+            search.Score = prediction.Searches[i].Score;
+            search.Steps = prediction.Searches[i].Steps;
+            search.TilesLeft = prediction.Searches[i].TilesLeft;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Distances to a guest goal over the footpath network. Path elements are keyed by their tile and base height, the
+ * distance is the number of tiles to walk to the goal.
+ */
+struct GuestDistanceField
+{
+    TileCoordsXYZ Goal;
+    std::unordered_map<uint64_t, uint16_t> Distances;
+    // Bounds of the tiles read while building the field.
+    TileCoordsXY Min;
+    TileCoordsXY Max;
+    uint32_t LastUsed;
+};
+
+static constexpr size_t MaxGuestDistanceFields = 64;
+
+static std::vector<std::unique_ptr<GuestDistanceField>> _guestDistanceFields;
+static uint32_t _guestDistanceFieldsRevision = 0;
+static uint32_t _guestDistanceFieldsLastUsed = 0;
+
+PeepPathfindStats gPeepPathfindStats;
+
+static uint64_t guest_distance_field_key(const TileCoordsXY& loc, int32_t z)
+{
+    return ((static_cast<uint64_t>(loc.y) << 16 | static_cast<uint16_t>(loc.x)) << 8) | static_cast<uint8_t>(z);
+}
+
+/**
+ * Whether the heuristic search would end on this track or entrance element when it is the goal.
+ */
+static bool guest_distance_field_is_destination(const TileElement* tileElement, Direction direction)
+{
+    if (tileElement->GetType() == TILE_ELEMENT_TYPE_TRACK)
+    {
+        auto ride = get_ride(tileElement->AsTrack()->GetRideIndex());
+        return ride != nullptr && ride_type_has_flag(ride->type, RIDE_TYPE_FLAG_IS_SHOP);
+    }
+    switch (tileElement->AsEntrance()->GetEntranceType())
+    {
+        case ENTRANCE_TYPE_RIDE_ENTRANCE:
+        case ENTRANCE_TYPE_RIDE_EXIT:
+            return tileElement->GetDirection() == direction;
+        case ENTRANCE_TYPE_PARK_ENTRANCE:
+            return true;
+    }
+    return false;
+}
+
+/**
+ * Finds what a guest walks onto when entering loc at height z through direction, the same elements the heuristic
+ * search looks at. Queues other than the goal are not walked through. Returns false if there is nothing to walk onto.
+ */
+static bool guest_distance_field_step(
+    const TileCoordsXYZ& goal, const TileCoordsXY& loc, int32_t z, Direction direction, uint64_t& key, bool& isGoal)
+{
+    isGoal = false;
+    TileElement* tileElement = map_get_first_element_at(loc.ToCoordsXY());
+    if (tileElement == nullptr)
+        return false;
+
+    bool isGoalTile = loc.x == goal.x && loc.y == goal.y;
+    bool found = false;
+    do
+    {
+        if (tileElement->IsGhost())
+            continue;
+
+        switch (tileElement->GetType())
+        {
+            case TILE_ELEMENT_TYPE_TRACK:
+            case TILE_ELEMENT_TYPE_ENTRANCE:
+                if (isGoalTile && z == goal.z && tileElement->base_height == z
+                    && guest_distance_field_is_destination(tileElement, direction))
+                {
+                    isGoal = true;
+                    return true;
+                }
+                break;
+            case TILE_ELEMENT_TYPE_PATH:
+                if (!IsValidPathZAndDirection(tileElement, z, direction))
+                    break;
+                if (isGoalTile && tileElement->base_height == goal.z)
+                {
+                    isGoal = true;
+                    return true;
+                }
+                if (!found && !tileElement->AsPath()->IsQueue())
+                {
+                    found = true;
+                    key = guest_distance_field_key(loc, tileElement->base_height);
+                }
+                break;
+        }
+    } while (!(tileElement++)->IsLastForTile());
+    return found;
+}
+
+/**
+ * Builds the distances with a breadth first search backwards from the goal: the paths next to a tile are added when
+ * walking off them through the connecting edge leads onto that tile.
+ */
+static std::unique_ptr<GuestDistanceField> guest_distance_field_build(const TileCoordsXYZ& goal)
+{
+    auto field = std::make_unique<GuestDistanceField>();
+    field->Goal = goal;
+    field->Min = goal;
+    field->Max = goal;
+
+    struct Node
+    {
+        TileCoordsXY Loc;
+        uint64_t Key;
+        bool IsGoal;
+        uint16_t Distance;
+    };
+    std::deque<Node> queue;
+    queue.push_back({ goal, guest_distance_field_key(goal, goal.z), true, 0 });
+
+    // Guests are not allowed through no entry signs.
+    _peepPathFindIsStaff = false;
+    uint64_t tilesScanned = 0;
+    while (!queue.empty())
+    {
+        auto node = queue.front();
+        queue.pop_front();
+        tilesScanned++;
+        if (node.Distance == std::numeric_limits<uint16_t>::max())
+            continue;
+
+        for (Direction direction : ALL_DIRECTIONS)
+        {
+            auto from = node.Loc;
+            from -= TileDirectionDelta[direction];
+            TileElement* tileElement = map_get_first_element_at(from.ToCoordsXY());
+            if (tileElement == nullptr)
+                continue;
+
+            field->Min = { std::min(field->Min.x, from.x), std::min(field->Min.y, from.y) };
+            field->Max = { std::max(field->Max.x, from.x), std::max(field->Max.y, from.y) };
+            do
+            {
+                if (tileElement->GetType() != TILE_ELEMENT_TYPE_PATH || tileElement->IsGhost())
+                    continue;
+                auto path = tileElement->AsPath();
+                if (path->IsQueue() || !(path_get_permitted_edges(path) & (1 << direction)))
+                    continue;
+
+                auto fromKey = guest_distance_field_key(from, tileElement->base_height);
+                if (field->Distances.count(fromKey) != 0)
+                    continue;
+
+                int32_t z = tileElement->base_height;
+                if (path->IsSloped() && path->GetSlopeDirection() == direction)
+                    z += 2;
+
+                uint64_t key = 0;
+                bool isGoal = false;
+                if (!guest_distance_field_step(goal, node.Loc, z, direction, key, isGoal) || isGoal != node.IsGoal)
+                    continue;
+                if (!isGoal && key != node.Key)
+                    continue;
+
+                auto distance = static_cast<uint16_t>(node.Distance + 1);
+                field->Distances[fromKey] = distance;
+                queue.push_back({ from, fromKey, false, distance });
+            } while (!(tileElement++)->IsLastForTile());
+        }
+    }
+
+    gPeepPathfindStats.DistanceFieldsBuilt++;
+    gPeepPathfindStats.DistanceFieldTilesScanned += tilesScanned;
+    return field;
+}
+
+/**
+ * Drops the fields that read any of the tiles the footpath graph has seen change since the fields were checked last.
+ */
+static void guest_distance_fields_invalidate()
+{
+    footpath_graph_update();
+    auto revision = footpath_graph_get_revision();
+    if (revision == _guestDistanceFieldsRevision)
+        return;
+
+    const auto* changedTiles = footpath_graph_get_changed_tiles();
+    if (changedTiles == nullptr || revision != _guestDistanceFieldsRevision + 1)
+    {
+        _guestDistanceFields.clear();
+    }
+    else
+    {
+        auto isAffected = [changedTiles](const std::unique_ptr<GuestDistanceField>& field) {
+            return std::any_of(changedTiles->begin(), changedTiles->end(), [&field](const TileCoordsXY& loc) {
+                return loc.x >= field->Min.x && loc.x <= field->Max.x && loc.y >= field->Min.y && loc.y <= field->Max.y;
+            });
+        };
+        _guestDistanceFields.erase(
+            std::remove_if(_guestDistanceFields.begin(), _guestDistanceFields.end(), isAffected),
+            _guestDistanceFields.end());
+    }
+    _guestDistanceFieldsRevision = revision;
+}
+
+static const GuestDistanceField& guest_distance_field_get(const TileCoordsXYZ& goal)
+{
+    guest_distance_fields_invalidate();
+
+    auto it = std::find_if(_guestDistanceFields.begin(), _guestDistanceFields.end(), [&goal](const auto& field) {
+        return field->Goal == goal;
+    });
+    if (it == _guestDistanceFields.end())
+    {
+        if (_guestDistanceFields.size() >= MaxGuestDistanceFields)
+        {
+            // Replace the field that was used longest ago.
+            it = std::min_element(_guestDistanceFields.begin(), _guestDistanceFields.end(), [](const auto& a, const auto& b) {
+                return a->LastUsed < b->LastUsed;
+            });
+            *it = guest_distance_field_build(goal);
+        }
+        else
+        {
+            it = _guestDistanceFields.insert(_guestDistanceFields.end(), guest_distance_field_build(goal));
+        }
+    }
+    (*it)->LastUsed = ++_guestDistanceFieldsLastUsed;
+    return **it;
+}
+
+bool peep_pathfind_distance_fields_enabled()
+{
+    return gConfigGeneral.guest_distance_fields && network_get_mode() == NETWORK_MODE_NONE;
+}
+
+int32_t peep_pathfind_get_distance_field_distance(const TileCoordsXYZ& goal, const TileCoordsXYZ& loc)
+{
+    if (loc == goal)
+        return 0;
+
+    const auto& field = guest_distance_field_get(goal);
+    auto it = field.Distances.find(guest_distance_field_key(loc, loc.z));
+    return it != field.Distances.end() ? it->second : -1;
+}
+
+/**
+ * Picks the edge with the shortest walk to the goal from the distance field of the goal, guests heading for the same
+ * goal share it. Returns false if none of the edges lead to the goal, the heuristic search is used then.
+ */
+static bool guest_distance_field_choose_edge(
+    const Peep* peep, const TileCoordsXYZ& loc, const TileElement* pathElement, uint8_t edges, const TileCoordsXYZ& goal,
+    int32_t& chosenEdge)
+{
+    if (_pathfindRecording != nullptr)
+        return false;
+
+    gPeepPathfindStats.Choices++;
+    if (!peep_pathfind_distance_fields_enabled() || peep->AssignedPeepType != PeepType::Guest)
+        return false;
+
+    const auto& field = guest_distance_field_get(goal);
+    uint32_t bestDistance = std::numeric_limits<uint32_t>::max();
+    for (Direction direction : ALL_DIRECTIONS)
+    {
+        if (!(edges & (1 << direction)))
+            continue;
+
+        int32_t z = loc.z;
+        if (pathElement->AsPath()->IsSloped() && pathElement->AsPath()->GetSlopeDirection() == direction)
+            z += 2;
+
+        uint64_t key = 0;
+        bool isGoal = false;
+        TileCoordsXY next = TileCoordsXY{ loc } + TileDirectionDelta[direction];
+        if (!guest_distance_field_step(goal, next, z, direction, key, isGoal))
+            continue;
+
+        uint32_t distance = 0;
+        if (!isGoal)
+        {
+            auto it = field.Distances.find(key);
+            if (it == field.Distances.end())
+                continue;
+            distance = it->second;
+        }
+        if (distance < bestDistance)
+        {
+            bestDistance = distance;
+            chosenEdge = direction;
+        }
+    }
+
+    if (bestDistance == std::numeric_limits<uint32_t>::max())
+        return false;
+
+    gPeepPathfindStats.DistanceFieldHits++;
+    return true;
+}
+
 /**
  * Returns:
  *   -1   - no direction chosen
@@ -1262,7 +1754,15 @@ Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
 {
     // The max number of thin junctions searched - a per-search-path limit.
     _peepPathFindMaxJunctions = peep_pathfind_get_max_number_junctions(peep);
+    return peep_pathfind_search_directions(loc, peep);
+}
 
+/**
+ * The part of peep_pathfind_choose_direction after _peepPathFindMaxJunctions is set up, this does not use the random
+ * number generator.
+ */
+static Direction peep_pathfind_search_directions(const TileCoordsXYZ& loc, Peep* peep)
+{
     /* The max number of tiles to check - a whole-search limit.
      * Mainly to limit the performance impact of the path finding. */
     int32_t maxTilesChecked = (peep->AssignedPeepType == PeepType::Staff) ? 50000 : 15000;
@@ -1409,7 +1909,7 @@ Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
         peep->PathfindGoal.direction = 0;
 
         // Clear pathfinding history
-        std::fill_n(reinterpret_cast<uint8_t*>(peep->PathfindHistory), sizeof(peep->PathfindHistory), 0xFF);
+        std::fill(std::begin(peep->PathfindHistory), std::end(peep->PathfindHistory), TileCoordsXYZD{ 0xFF, 0xFF, 0xFF, 0xFF });
 #if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
         if (gPathFindDebug)
         {
@@ -1425,7 +1925,8 @@ Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
     int32_t chosen_edge = bitscanforward(edges);
 
     // Peep has multiple edges still to try.
-    if (edges & ~(1 << chosen_edge))
+    if ((edges & ~(1 << chosen_edge))
+        && !guest_distance_field_choose_edge(peep, loc, first_tile_element, edges, goal, chosen_edge))
     {
         uint16_t best_score = 0xFFFF;
         uint8_t best_sub = 0xFF;
@@ -1470,8 +1971,8 @@ Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
             /* The pathfinding will only use elements
              * 1.._peepPathFindMaxJunctions, so the starting point
              * is placed in element 0 */
-            _peepPathFindHistory[0].location.x = static_cast<uint8_t>(loc.x);
-            _peepPathFindHistory[0].location.y = static_cast<uint8_t>(loc.y);
+            _peepPathFindHistory[0].location.x = loc.x;
+            _peepPathFindHistory[0].location.y = loc.y;
             _peepPathFindHistory[0].location.z = loc.z;
             _peepPathFindHistory[0].direction = 0xF;
 
@@ -1512,9 +2013,39 @@ Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
             }
 #endif // defined(DEBUG_LEVEL_2) && DEBUG_LEVEL_2
 
-            peep_pathfind_heuristic_search(
-                { loc.x, loc.y, height }, peep, first_tile_element, inPatrolArea, 0, &score, test_edge, &endJunctions,
-                endJunctionList, endDirectionList, &endXYZ, &endSteps);
+            PathSearchRecord search{};
+            search.Start = { loc.x, loc.y, height };
+            search.StartElement = first_tile_element;
+            search.Goal = goal;
+            search.TilesChecked = _peepPathFindTilesChecked;
+            search.MaxJunctions = _peepPathFindMaxJunctions;
+            search.QueueRideIndex = gPeepPathFindQueueRideIndex;
+            search.IgnoreForeignQueues = gPeepPathFindIgnoreForeignQueues;
+            search.TestEdge = static_cast<Direction>(test_edge);
+            std::copy(std::begin(peep->PathfindHistory), std::end(peep->PathfindHistory), std::begin(search.History));
+            if (peep_pathfind_get_predicted_search(peep, search))
+            {
+                score = search.Score;
+                endSteps = search.Steps;
+            }
+            else
+            {
+                peep_pathfind_heuristic_search(
+                    { loc.x, loc.y, height }, peep, first_tile_element, inPatrolArea, 0, &score, test_edge, &endJunctions,
+                    endJunctionList, endDirectionList, &endXYZ, &endSteps);
+                search.TilesLeft = _peepPathFindTilesChecked;
+
+                if (_pathfindRecording != nullptr && _pathfindRecording->Count < _pathfindRecording->Searches.size())
+                {
+                    search.Score = score;
+                    search.Steps = endSteps;
+                    _pathfindRecording->Searches[_pathfindRecording->Count++] = search;
+                }
+            }
+            if (_pathfindRecording == nullptr)
+            {
+                gPeepPathfindStats.HeuristicTilesChecked += search.TilesChecked - std::max(search.TilesLeft, 0);
+            }
 
 #if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
             if (gPathFindDebug)
@@ -1609,8 +2140,8 @@ Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
          * and remember this junction. */
         int32_t i = peep->PathfindGoal.direction++;
         peep->PathfindGoal.direction &= 3;
-        peep->PathfindHistory[i].x = static_cast<uint8_t>(loc.x);
-        peep->PathfindHistory[i].y = static_cast<uint8_t>(loc.y);
+        peep->PathfindHistory[i].x = loc.x;
+        peep->PathfindHistory[i].y = loc.y;
         peep->PathfindHistory[i].z = loc.z;
         peep->PathfindHistory[i].direction = permitted_edges;
         /* Remove the chosen_edge from those left to try. */
@@ -1974,6 +2505,70 @@ static StationIndex guest_pathfinding_select_random_station(
 
     return 0;
 }
+/**
+ * The end of the queue line of the ride station the guest heads for.
+ */
+static TileCoordsXYZ guest_pathfinding_get_ride_goal(const Guest* peep, const Ride* ride)
+{
+    TileCoordsXYZ loc;
+
+    /* Find the ride's closest entrance station to the peep.
+     * At the same time, count how many entrance stations there are and
+     * which stations are entrance stations. */
+    auto bestScore = std::numeric_limits<int32_t>::max();
+    StationIndex closestStationNum = 0;
+
+    int32_t numEntranceStations = 0;
+    std::bitset<MAX_STATIONS> entranceStations = {};
+
+    for (StationIndex stationNum = 0; stationNum < MAX_STATIONS; ++stationNum)
+    {
+        // Skip if stationNum has no entrance (so presumably an exit only station)
+        if (ride_get_entrance_location(ride, stationNum).isNull())
+            continue;
+
+        numEntranceStations++;
+        entranceStations[stationNum] = true;
+
+        TileCoordsXYZD entranceLocation = ride_get_entrance_location(ride, stationNum);
+        auto score = CalculateHeuristicPathingScore(entranceLocation, TileCoordsXYZ{ peep->NextLoc });
+        if (score < bestScore)
+        {
+            bestScore = score;
+            closestStationNum = stationNum;
+            continue;
+        }
+    }
+
+    // Ride has no stations with an entrance, so head to station 0.
+    if (numEntranceStations == 0)
+        closestStationNum = 0;
+
+    if (numEntranceStations > 1 && (ride->depart_flags & RIDE_DEPART_SYNCHRONISE_WITH_ADJACENT_STATIONS))
+    {
+        closestStationNum = guest_pathfinding_select_random_station(peep, numEntranceStations, entranceStations);
+    }
+
+    if (numEntranceStations == 0)
+    {
+        // closestStationNum is always 0 here.
+        auto entranceXY = TileCoordsXY(ride->stations[closestStationNum].Start);
+        loc.x = entranceXY.x;
+        loc.y = entranceXY.y;
+        loc.z = ride->stations[closestStationNum].Height;
+    }
+    else
+    {
+        TileCoordsXYZD entranceXYZD = ride_get_entrance_location(ride, closestStationNum);
+        loc.x = entranceXYZD.x;
+        loc.y = entranceXYZD.y;
+        loc.z = entranceXYZD.z;
+    }
+
+    get_ride_queue_end(loc);
+    return loc;
+}
+
 /**
  *
  *  rct2: 0x00694C35
@@ -2180,60 +2775,7 @@ int32_t guest_path_finding(Guest* peep)
     // The ride is open.
     gPeepPathFindQueueRideIndex = rideIndex;
 
-    /* Find the ride's closest entrance station to the peep.
-     * At the same time, count how many entrance stations there are and
-     * which stations are entrance stations. */
-    auto bestScore = std::numeric_limits<int32_t>::max();
-    StationIndex closestStationNum = 0;
-
-    int32_t numEntranceStations = 0;
-    std::bitset<MAX_STATIONS> entranceStations = {};
-
-    for (StationIndex stationNum = 0; stationNum < MAX_STATIONS; ++stationNum)
-    {
-        // Skip if stationNum has no entrance (so presumably an exit only station)
-        if (ride_get_entrance_location(ride, stationNum).isNull())
-            continue;
-
-        numEntranceStations++;
-        entranceStations[stationNum] = true;
-
-        TileCoordsXYZD entranceLocation = ride_get_entrance_location(ride, stationNum);
-        auto score = CalculateHeuristicPathingScore(entranceLocation, TileCoordsXYZ{ peep->NextLoc });
-        if (score < bestScore)
-        {
-            bestScore = score;
-            closestStationNum = stationNum;
-            continue;
-        }
-    }
-
-    // Ride has no stations with an entrance, so head to station 0.
-    if (numEntranceStations == 0)
-        closestStationNum = 0;
-
-    if (numEntranceStations > 1 && (ride->depart_flags & RIDE_DEPART_SYNCHRONISE_WITH_ADJACENT_STATIONS))
-    {
-        closestStationNum = guest_pathfinding_select_random_station(peep, numEntranceStations, entranceStations);
-    }
-
-    if (numEntranceStations == 0)
-    {
-        // closestStationNum is always 0 here.
-        auto entranceXY = TileCoordsXY(ride->stations[closestStationNum].Start);
-        loc.x = entranceXY.x;
-        loc.y = entranceXY.y;
-        loc.z = ride->stations[closestStationNum].Height;
-    }
-    else
-    {
-        TileCoordsXYZD entranceXYZD = ride_get_entrance_location(ride, closestStationNum);
-        loc.x = entranceXYZD.x;
-        loc.y = entranceXYZD.y;
-        loc.z = entranceXYZD.z;
-    }
-
-    get_ride_queue_end(loc);
+    loc = guest_pathfinding_get_ride_goal(peep, ride);
 
     gPeepPathFindGoalPosition = loc;
     gPeepPathFindIgnoreForeignQueues = true;
@@ -2270,6 +2812,128 @@ int32_t guest_path_finding(Guest* peep)
     return peep_move_one_tile(direction, peep);
 }
 
+/**
+ * Whether the guest reaches its destination in this tick and chooses where to walk next, see Peep::PerformNextAction.
+ * This is only a guess, searches of guests that end up doing something else are not used.
+ */
+static bool guest_pathfinding_is_due(const Guest* peep)
+{
+    if (peep->State != PeepState::Walking && peep->State != PeepState::EnteringPark
+        && peep->State != PeepState::LeavingPark)
+        return false;
+    if (peep->Action != PeepActionType::None1 && peep->Action != PeepActionType::None2)
+        return false;
+    if (peep->StepProgress + peep->GetStepsToTake() <= 255)
+        return false;
+
+    int32_t distance = abs(peep->x - peep->DestinationX) + abs(peep->y - peep->DestinationY);
+    return distance <= peep->DestinationTolerance;
+}
+
+/**
+ * Runs the searches guest_path_finding would run for the guest. Works on a copy of the guest, choosing a direction
+ * updates the pathfind goal and history.
+ */
+static void guest_pathfinding_predict(PathfindPrediction& prediction)
+{
+    Guest peep = *prediction.Peep;
+    if (peep.GetNextIsSurface())
+        return;
+
+    TileCoordsXYZ loc{ peep.NextLoc };
+    auto* pathElement = map_get_path_element_at(loc);
+    if (pathElement == nullptr)
+        return;
+
+    // Guests only choose a direction at junctions, not counting the edge they came from.
+    _peepPathFindIsStaff = false;
+    uint8_t edges = path_get_permitted_edges(pathElement) & ~(1 << direction_reverse(peep.PeepDirection));
+    if (bitcount(edges) < 2)
+        return;
+
+    gPeepPathFindIgnoreForeignQueues = true;
+    gPeepPathFindQueueRideIndex = RIDE_ID_NULL;
+    if (peep.OutsideOfPark)
+    {
+        if (peep.State == PeepState::EnteringPark)
+        {
+            uint8_t entranceIndex = get_nearest_park_entrance_index(peep.NextLoc.x, peep.NextLoc.y);
+            if (entranceIndex == 0xFF)
+                return;
+            gPeepPathFindGoalPosition = TileCoordsXYZ(gParkEntrances[entranceIndex]);
+        }
+        else if (peep.State == PeepState::LeavingPark)
+        {
+            uint8_t spawnIndex = get_nearest_peep_spawn_index(peep.NextLoc.x, peep.NextLoc.y);
+            if (spawnIndex == 0xFF)
+                return;
+            const auto spawnLoc = gPeepSpawns[spawnIndex].ToTileStart();
+            if (spawnLoc.x == peep.NextLoc.x && spawnLoc.y == peep.NextLoc.y)
+                return;
+            gPeepPathFindGoalPosition = TileCoordsXYZ(spawnLoc);
+        }
+        else
+        {
+            return;
+        }
+    }
+    else if (peep.PeepFlags & PEEP_FLAGS_LEAVING_PARK)
+    {
+        uint8_t entranceIndex = peep.ChosenParkEntrance;
+        if (!(peep.PeepFlags & PEEP_FLAGS_PARK_ENTRANCE_CHOSEN) || entranceIndex >= gParkEntrances.size())
+            entranceIndex = get_nearest_park_entrance_index(peep.NextLoc.x, peep.NextLoc.y);
+        if (entranceIndex == 0xFF)
+            return;
+        gPeepPathFindGoalPosition = TileCoordsXYZ(gParkEntrances[entranceIndex]);
+    }
+    else
+    {
+        auto ride = get_ride(peep.GuestHeadingToRideId);
+        if (ride == nullptr || ride->status != RIDE_STATUS_OPEN)
+            return;
+        gPeepPathFindQueueRideIndex = ride->id;
+        gPeepPathFindGoalPosition = guest_pathfinding_get_ride_goal(&peep, ride);
+    }
+
+    // peep_pathfind_get_max_number_junctions without drawing the random number that clears PEEP_FLAGS_2.
+    _peepPathFindMaxJunctions = (peep.PeepFlags & PEEP_FLAGS_2) ? 8 : peep_pathfind_get_max_number_junctions(&peep);
+
+    _pathfindRecording = &prediction;
+    peep_pathfind_search_directions(loc, &peep);
+    _pathfindRecording = nullptr;
+}
+
+void peep_pathfind_predict_all()
+{
+    if (_pathfindJobs == nullptr)
+    {
+        _pathfindJobs = std::make_unique<JobPool>();
+        _pathfindPredictionIndex.resize(MAX_SPRITES, -1);
+    }
+
+    for (auto peep : EntityList<Guest>(EntityListId::Peep))
+    {
+        if (guest_pathfinding_is_due(peep))
+        {
+            _pathfindPredictionIndex[peep->sprite_index] = static_cast<int32_t>(_pathfindPredictions.size());
+            _pathfindPredictions.push_back({ peep, 0, {} });
+        }
+    }
+
+    // Only reads the map and the guests, the guests are updated in order afterwards.
+    _pathfindJobs->ParallelFor(
+        _pathfindPredictions.size(), [](size_t i) -> void { guest_pathfinding_predict(_pathfindPredictions[i]); });
+}
+
+void peep_pathfind_clear_predictions()
+{
+    for (const auto& prediction : _pathfindPredictions)
+    {
+        _pathfindPredictionIndex[prediction.Peep->sprite_index] = -1;
+    }
+    _pathfindPredictions.clear();
+}
+
 bool IsValidPathZAndDirection(TileElement* tileElement, int32_t currentZ, int32_t currentDirection)
 {
     if (tileElement->AsPath()->IsSloped())
@@ -22,12 +22,12 @@ struct TileElement;
 //
 // This gets copied into Peep::PathfindGoal. The two separate variables are needed because
 // when the goal changes the peep's pathfind history needs to be reset.
-extern TileCoordsXYZ gPeepPathFindGoalPosition;
+extern thread_local TileCoordsXYZ gPeepPathFindGoalPosition;
 
 // When the heuristic pathfinder is examining neighboring tiles, one possibility is that it finds a
 // queue tile; furthermore, this queue tile may or may not be for the ride that the peep is trying
 // to get to, if any. This first var is used to store the ride that the peep is currently headed to.
-extern ride_id_t gPeepPathFindQueueRideIndex;
+extern thread_local ride_id_t gPeepPathFindQueueRideIndex;
 
 // Furthermore, staff members don't care about this stuff; even if they are e.g. a mechanic headed
 // to a particular ride, they have no issues with walking over queues for other rides to get there.
@@ -35,7 +35,7 @@ extern ride_id_t gPeepPathFindQueueRideIndex;
 // than their target ride, and if false, they will treat it like a regular path.
 //
 // In practice, if this is false, gPeepPathFindQueueRideIndex is always RIDE_ID_NULL.
-extern bool gPeepPathFindIgnoreForeignQueues;
+extern thread_local bool gPeepPathFindIgnoreForeignQueues;
 
 // Given a peep 'peep' at tile 'loc', who is trying to get to 'gPeepPathFindGoalPosition', decide
 // the direction the peep should walk in from the current tile.
@@ -51,6 +51,35 @@ bool IsValidPathZAndDirection(TileElement* tileElement, int32_t currentZ, int32_
 // Returns 0 if the guest has successfully had a new destination set up, nonzero otherwise.
 int32_t guest_path_finding(Guest* peep);
 
+// Runs the heuristic searches of the guests that are about to choose a direction on worker threads, before the guests
+// are updated in order. peep_pathfind_choose_direction uses a result when it searches with exactly the same inputs, so
+// the guests end up doing the same as without.
+void peep_pathfind_predict_all();
+void peep_pathfind_clear_predictions();
+
+// Whether guests choose their direction from shared distance fields (guest_distance_fields). The choices differ from
+// the heuristic search and the setting is not synchronised, so the fields are never used in multiplayer.
+bool peep_pathfind_distance_fields_enabled();
+
+// The number of tiles to walk from the path at loc to goal in the distance field of goal, -1 if the path does not lead
+// there. The field is built if needed, whether or not the fields are enabled.
+int32_t peep_pathfind_get_distance_field_distance(const TileCoordsXYZ& goal, const TileCoordsXYZ& loc);
+
+struct PeepPathfindStats
+{
+    // Direction choices with more than one edge to try.
+    uint64_t Choices;
+    // Choices made from a guest distance field, the fields built and the tiles read to build them.
+    uint64_t DistanceFieldHits;
+    uint64_t DistanceFieldsBuilt;
+    uint64_t DistanceFieldTilesScanned;
+    // Tiles checked by the heuristic searches, the budget counted down in _peepPathFindTilesChecked.
+    uint64_t HeuristicTilesChecked;
+};
+
+// Counted on the main thread only, reset by whoever reports them.
+extern PeepPathfindStats gPeepPathfindStats;
+
 #if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
 #    define PATHFIND_DEBUG                                                                                                     \
         0 // Set to 0 to disable pathfinding debugging;
@@ -37,9 +37,11 @@
 #include "../world/Climate.h"
 #include "../world/Entrance.h"
 #include "../world/Footpath.h"
+#include "../world/FootpathGraph.h"
 #include "../world/LargeScenery.h"
 #include "../world/Map.h"
 #include "../world/Park.h"
+#include "../world/ParkAggregates.h"
 #include "../world/Scenery.h"
 #include "../world/SmallScenery.h"
 #include "../world/Sprite.h"
@@ -387,6 +389,17 @@ void peep_update_all()
     if (gScreenFlags & SCREEN_FLAGS_EDITOR)
         return;
 
+    if (!gConfigGeneral.legacy_peep_pathfinding)
+    {
+        footpath_graph_update();
+    }
+
+    // Guests choosing from distance fields would not use most of the searches run ahead.
+    if (gConfigGeneral.parallel_entity_update && !peep_pathfind_distance_fields_enabled())
+    {
+        peep_pathfind_predict_all();
+    }
+
     int32_t i = 0;
     // Warning this loop can delete peeps
     for (auto peep : EntityList<Peep>(EntityListId::Peep))
@@ -404,8 +417,17 @@ void peep_update_all()
             }
         }
 
+        // Guests are only changed by their own update for the most part, counting them again here keeps the park
+        // aggregates up to date without scanning all guests when they are read.
+        if (peep->sprite_identifier == SpriteIdentifier::Peep && peep->AssignedPeepType == PeepType::Guest)
+        {
+            park_aggregates_update_guest(peep);
+        }
+
         i++;
     }
+
+    peep_pathfind_clear_predictions();
 }
 
 /**
@@ -996,6 +1018,7 @@ void Peep::SetState(PeepState new_state)
 {
     peep_decrement_num_riders(this);
     State = new_state;
+    sprite_checksum_invalidate(this);
     peep_window_state_update(this);
 }
 
@@ -1079,18 +1102,9 @@ static void peep_update_thoughts(Peep* peep)
  *
  *  rct2: 0x0068FC1E
  */
-void Peep::Update()
+// Walking speed logic
+uint32_t Peep::GetStepsToTake() const
 {
-    if (AssignedPeepType == PeepType::Guest)
-    {
-        if (PreviousRide != RIDE_ID_NULL)
-            if (++PreviousRideTimeOut >= 720)
-                PreviousRide = RIDE_ID_NULL;
-
-        peep_update_thoughts(this);
-    }
-
-    // Walking speed logic
     uint32_t stepsToTake = Energy;
     if (stepsToTake < 95 && State == PeepState::Queuing)
         stepsToTake = 95;
@@ -1102,7 +1116,21 @@ void Peep::Update()
         if (State == PeepState::Queuing)
             stepsToTake += stepsToTake / 2;
     }
+    return stepsToTake;
+}
+
+void Peep::Update()
+{
+    if (AssignedPeepType == PeepType::Guest)
+    {
+        if (PreviousRide != RIDE_ID_NULL)
+            if (++PreviousRideTimeOut >= 720)
+                PreviousRide = RIDE_ID_NULL;
+
+        peep_update_thoughts(this);
+    }
 
+    uint32_t stepsToTake = GetStepsToTake();
     uint32_t carryCheck = StepProgress + stepsToTake;
     StepProgress = carryCheck;
     if (carryCheck <= 255)
@@ -1569,6 +1597,7 @@ void Peep::InsertNewThought(PeepThoughtType thoughtType, uint8_t thoughtArgument
     Thoughts[0].fresh_timeout = 0;
 
     WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_THOUGHTS;
+    park_aggregates_update_guest(this);
 }
 
 /**
@@ -1742,6 +1771,7 @@ Peep* Peep::Generate(const CoordsXYZ& coords)
     peep->EnergyTarget = energy;
 
     increment_guests_heading_for_park();
+    park_aggregates_update_guest(peep);
 
     return peep;
 }
@@ -2472,6 +2502,7 @@ static void peep_interact_with_entrance(Peep* peep, const CoordsXYE& coords, uin
         {
             peep->State = PeepState::LeavingPark;
             peep->Var37 = 1;
+            sprite_checksum_invalidate(peep);
             decrement_guests_heading_for_park();
             peep_window_state_update(peep);
             peep_return_to_centre_of_tile(peep);
@@ -2536,6 +2567,7 @@ static void peep_interact_with_entrance(Peep* peep, const CoordsXYE& coords, uin
         {
             peep->State = PeepState::LeavingPark;
             peep->Var37 = 1;
+            sprite_checksum_invalidate(peep);
             decrement_guests_heading_for_park();
             peep_window_state_update(peep);
             peep_return_to_centre_of_tile(peep);
@@ -2564,6 +2596,7 @@ static void peep_interact_with_entrance(Peep* peep, const CoordsXYE& coords, uin
             {
                 peep->State = PeepState::LeavingPark;
                 peep->Var37 = 1;
+                sprite_checksum_invalidate(peep);
                 decrement_guests_heading_for_park();
                 peep_window_state_update(peep);
                 peep_return_to_centre_of_tile(peep);
@@ -2809,6 +2842,7 @@ static void peep_interact_with_path(Peep* peep, const CoordsXYE& coords)
                     peep->CurrentRideStation = stationNum;
                     peep->State = PeepState::Queuing;
                     peep->DaysInQueue = 0;
+                    sprite_checksum_invalidate(peep);
                     peep_window_state_update(peep);
 
                     peep->SubState = 10;
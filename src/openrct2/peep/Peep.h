@@ -671,8 +671,8 @@ struct Peep : SpriteBase
     };
     ride_id_t Photo1RideRef;
     uint32_t PeepFlags;
-    rct12_xyzd8 PathfindGoal;
-    rct12_xyzd8 PathfindHistory[4];
+    TileCoordsXYZD PathfindGoal;
+    TileCoordsXYZD PathfindHistory[4];
     uint8_t WalkingFrameNum;
     // 0x3F Litter Count split into lots of 3 with time, 0xC0 Time since last recalc
     uint8_t LitterCount;
@@ -742,6 +742,7 @@ public: // Peep
     void MoveTo(const CoordsXYZ& newLocation);
     uint8_t GetNextDirection() const;
     bool GetNextIsSloped() const;
+    uint32_t GetStepsToTake() const;
     bool GetNextIsSurface() const;
     void SetNextFlags(uint8_t next_direction, bool is_sloped, bool is_surface);
     void Pickup();
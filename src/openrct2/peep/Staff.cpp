@@ -380,6 +380,12 @@ static std::pair<int32_t, int32_t> getPatrolAreaOffsetIndex(const CoordsXY& coor
     return { hash >> 5, hash & 0x1F };
 }
 
+// The patrol areas cover the map sizes the park files can hold, tiles beyond it on larger maps can not be patrolled.
+static bool isPatrolAreaInRange(const CoordsXY& coords)
+{
+    return coords.x < MAXIMUM_MAP_SIZE_BIG && coords.y < MAXIMUM_MAP_SIZE_BIG;
+}
+
 static bool staff_is_patrol_area_set(int32_t staffIndex, const CoordsXY& coords)
 {
     // Patrol quads are stored in a bit map (8 patrol quads per byte).
@@ -387,6 +393,8 @@ static bool staff_is_patrol_area_set(int32_t staffIndex, const CoordsXY& coords)
     // Therefore there are in total 64 x 64 patrol quads in the 256 x 256 map.
     // At the end of the array (after the slots for individual staff members),
     // there are slots that save the combined patrol area for every staff type.
+    if (!isPatrolAreaInRange(coords))
+        return false;
 
     int32_t peepOffset = staffIndex * STAFF_PATROL_AREA_SIZE;
     auto [offset, bitIndex] = getPatrolAreaOffsetIndex(coords);
@@ -405,6 +413,9 @@ bool staff_is_patrol_area_set_for_type(StaffType type, const CoordsXY& coords)
 
 void staff_set_patrol_area(int32_t staffIndex, const CoordsXY& coords, bool value)
 {
+    if (!isPatrolAreaInRange(coords))
+        return;
+
     int32_t peepOffset = staffIndex * STAFF_PATROL_AREA_SIZE;
     auto [offset, bitIndex] = getPatrolAreaOffsetIndex(coords);
     uint32_t* addr = &gStaffPatrolAreas[peepOffset + offset];
@@ -420,6 +431,9 @@ void staff_set_patrol_area(int32_t staffIndex, const CoordsXY& coords, bool valu
 
 void staff_toggle_patrol_area(int32_t staffIndex, const CoordsXY& coords)
 {
+    if (!isPatrolAreaInRange(coords))
+        return;
+
     int32_t peepOffset = staffIndex * STAFF_PATROL_AREA_SIZE;
     auto [offset, bitIndex] = getPatrolAreaOffsetIndex(coords);
     gStaffPatrolAreas[peepOffset + offset] ^= (1 << bitIndex);
@@ -2043,6 +2057,7 @@ void Staff::UpdateFixing(int32_t steps)
         // Ride has broken down since Mechanic was called to inspect it.
         // Mechanic identifies the breakdown and switches to fixing it.
         State = PeepState::Fixing;
+        sprite_checksum_invalidate(this);
     }
 
     while (progressToNextSubstate)
@@ -24,6 +24,7 @@
 #include "../drawing/LightFX.h"
 #include "../localisation/Currency.h"
 #include "../localisation/Localisation.h"
+#include "../util/SawyerCoding.h"
 #include "../util/Util.h"
 #include "../world/Climate.h"
 #include "Platform2.h"
@@ -270,6 +271,7 @@ void core_init()
         platform_ticks_init();
         bitcount_init();
         mask_init();
+        sawyercoding_init();
 
 #if defined(__APPLE__) && (__ENVIRONMENT_MAC_OS_X_VERSION_MIN_REQUIRED__ < 101200)
         kern_return_t ret = mach_timebase_info(&_mach_base_info);
@@ -2003,6 +2003,7 @@ private:
     {
         gMapBaseZ = 7;
 
+        map_resize_storage(MAX_TILE_ELEMENTS_WITH_SPARE_ROOM);
         for (uint32_t index = 0, dstOffset = 0; index < RCT1_MAX_TILE_ELEMENTS; index++)
         {
             auto src = &_s4.tile_elements[index];
@@ -2752,32 +2753,31 @@ private:
     void ClearExtraTileEntries()
     {
         // Reset the map tile pointers
-        std::fill(std::begin(gTileElementTilePointers), std::end(gTileElementTilePointers), nullptr);
+        std::fill(gTileElementTilePointers.begin(), gTileElementTilePointers.end(), nullptr);
 
         // Get the first free map element
-        TileElement* nextFreeTileElement = gTileElements;
+        TileElement* nextFreeTileElement = gTileElements.data();
         for (size_t i = 0; i < RCT1_MAX_MAP_SIZE * RCT1_MAX_MAP_SIZE; i++)
         {
             while (!(nextFreeTileElement++)->IsLastForTile())
                 ;
         }
 
-        TileElement* tileElement = gTileElements;
-        TileElement** tilePointer = gTileElementTilePointers;
+        TileElement* tileElement = gTileElements.data();
 
         // 128 rows of map data from RCT1 map
-        for (int32_t x = 0; x < RCT1_MAX_MAP_SIZE; x++)
+        for (int32_t y = 0; y < RCT1_MAX_MAP_SIZE; y++)
         {
             // Assign the first half of this row
-            for (int32_t y = 0; y < RCT1_MAX_MAP_SIZE; y++)
+            for (int32_t x = 0; x < RCT1_MAX_MAP_SIZE; x++)
             {
-                *tilePointer++ = tileElement;
+                map_set_tile_element({ x, y }, tileElement);
                 while (!(tileElement++)->IsLastForTile())
                     ;
             }
 
             // Fill the rest of the row with blank tiles
-            for (int32_t y = 0; y < RCT1_MAX_MAP_SIZE; y++)
+            for (int32_t x = RCT1_MAX_MAP_SIZE; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
             {
                 nextFreeTileElement->ClearAs(TILE_ELEMENT_TYPE_SURFACE);
                 nextFreeTileElement->SetLastForTile(true);
@@ -2786,12 +2786,12 @@ private:
                 nextFreeTileElement->AsSurface()->SetEdgeStyle(TERRAIN_EDGE_ROCK);
                 nextFreeTileElement->AsSurface()->SetGrassLength(GRASS_LENGTH_CLEAR_0);
                 nextFreeTileElement->AsSurface()->SetOwnership(OWNERSHIP_UNOWNED);
-                *tilePointer++ = nextFreeTileElement++;
+                map_set_tile_element({ x, y }, nextFreeTileElement++);
             }
         }
 
         // 128 extra rows left to fill with blank tiles
-        for (int32_t y = 0; y < 128 * 256; y++)
+        for (int32_t i = 0; i < 128 * 256; i++)
         {
             nextFreeTileElement->ClearAs(TILE_ELEMENT_TYPE_SURFACE);
             nextFreeTileElement->SetLastForTile(true);
@@ -2800,10 +2800,12 @@ private:
             nextFreeTileElement->AsSurface()->SetEdgeStyle(TERRAIN_EDGE_ROCK);
             nextFreeTileElement->AsSurface()->SetGrassLength(GRASS_LENGTH_CLEAR_0);
             nextFreeTileElement->AsSurface()->SetOwnership(OWNERSHIP_UNOWNED);
-            *tilePointer++ = nextFreeTileElement++;
+            auto tilePos = TileCoordsXY{ i % MAXIMUM_MAP_SIZE_TECHNICAL, RCT1_MAX_MAP_SIZE + i / MAXIMUM_MAP_SIZE_TECHNICAL };
+            map_set_tile_element(tilePos, nextFreeTileElement++);
         }
 
         gNextFreeTileElement = nextFreeTileElement;
+        map_rebuild_free_elements();
     }
 
     void FixWalls()
@@ -10,6 +10,9 @@
 #include "SawyerChunkReader.h"
 
 #include "../core/IStream.hpp"
+#include "../core/JobPool.h"
+
+#include <exception>
 
 // malloc is very slow for large allocations in MSVC debug builds as it allocates
 // memory on a special debug heap and then initialises all the memory to 0xCC.
@@ -21,6 +24,10 @@
 // Allow chunks to be uncompressed to a maximum of 16 MiB
 constexpr size_t MAX_UNCOMPRESSED_CHUNK_SIZE = 16 * 1024 * 1024;
 
+// Longest RLE runs and literals, the decoder copies them in blocks of 16 bytes when there is room for all of them.
+constexpr size_t MaxRunLength = 129;
+constexpr size_t MaxLiteralLength = 128;
+
 constexpr const char* EXCEPTION_MSG_CORRUPT_CHUNK_SIZE = "Corrupt chunk size.";
 constexpr const char* EXCEPTION_MSG_CORRUPT_RLE = "Corrupt RLE compression data.";
 constexpr const char* EXCEPTION_MSG_DESTINATION_TOO_SMALL = "Chunk data larger than allocated destination capacity.";
@@ -66,35 +73,26 @@ std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunk()
     uint64_t originalPosition = _stream->GetPosition();
     try
     {
-        auto header = _stream->ReadValue<sawyercoding_chunk_header>();
-        if (header.length >= MAX_UNCOMPRESSED_CHUNK_SIZE)
-            throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+        auto header = ReadChunkHeader();
+        auto encodedData = ReadEncodedData(header, _encodedData);
 
-        switch (header.encoding)
+        auto buffer = static_cast<uint8_t*>(AllocateLargeTempBuffer());
+        size_t uncompressedLength;
+        try
         {
-            case CHUNK_ENCODING_NONE:
-            case CHUNK_ENCODING_RLE:
-            case CHUNK_ENCODING_RLECOMPRESSED:
-            case CHUNK_ENCODING_ROTATE:
+            uncompressedLength = DecodeChunk(buffer, MAX_UNCOMPRESSED_CHUNK_SIZE, encodedData, header);
+            if (uncompressedLength == 0)
             {
-                std::unique_ptr<uint8_t[]> compressedData(new uint8_t[header.length]);
-                if (_stream->TryRead(compressedData.get(), header.length) != header.length)
-                {
-                    throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
-                }
-
-                auto buffer = static_cast<uint8_t*>(AllocateLargeTempBuffer());
-                size_t uncompressedLength = DecodeChunk(buffer, MAX_UNCOMPRESSED_CHUNK_SIZE, compressedData.get(), header);
-                if (uncompressedLength == 0)
-                {
-                    throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
-                }
-                buffer = static_cast<uint8_t*>(FinaliseLargeTempBuffer(buffer, uncompressedLength));
-                return std::make_shared<SawyerChunk>(static_cast<SAWYER_ENCODING>(header.encoding), buffer, uncompressedLength);
+                throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
             }
-            default:
-                throw SawyerChunkException(EXCEPTION_MSG_INVALID_CHUNK_ENCODING);
         }
+        catch (const std::exception&)
+        {
+            FreeLargeTempBuffer(buffer);
+            throw;
+        }
+        buffer = static_cast<uint8_t*>(FinaliseLargeTempBuffer(buffer, uncompressedLength));
+        return std::make_shared<SawyerChunk>(static_cast<SAWYER_ENCODING>(header.encoding), buffer, uncompressedLength);
     }
     catch (const std::exception&)
     {
@@ -143,22 +141,148 @@ std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunkTrack()
 
 void SawyerChunkReader::ReadChunk(void* dst, size_t length)
 {
-    auto chunk = ReadChunk();
-    auto chunkData = static_cast<const uint8_t*>(chunk->GetData());
-    auto chunkLength = chunk->GetLength();
-    if (chunkLength > length)
+    uint64_t originalPosition = _stream->GetPosition();
+    try
+    {
+        auto header = ReadChunkHeader();
+        auto encodedData = ReadEncodedData(header, _encodedData);
+        DecodeChunkInto(dst, length, encodedData, header);
+    }
+    catch (const std::exception&)
+    {
+        // Rewind stream back to original position
+        _stream->SetPosition(originalPosition);
+        throw;
+    }
+}
+
+static JobPool& GetDecodeJobPool()
+{
+    static JobPool jobPool;
+    return jobPool;
+}
+
+void SawyerChunkReader::ReadChunks(const std::vector<Destination>& destinations)
+{
+    uint64_t originalPosition = _stream->GetPosition();
+    try
+    {
+        // The chunks follow each other, so all of them are read before any is decoded.
+        std::vector<sawyercoding_chunk_header> headers(destinations.size());
+        std::vector<const uint8_t*> encodedData(destinations.size());
+        std::vector<std::vector<uint8_t>> buffers(destinations.size());
+        for (size_t i = 0; i < destinations.size(); i++)
+        {
+            headers[i] = ReadChunkHeader();
+            encodedData[i] = ReadEncodedData(headers[i], buffers[i]);
+        }
+
+        std::vector<std::exception_ptr> exceptions(destinations.size());
+        GetDecodeJobPool().ParallelFor(destinations.size(), [&](size_t i) {
+            try
+            {
+                DecodeChunkInto(destinations[i].Data, destinations[i].Length, encodedData[i], headers[i]);
+            }
+            catch (const std::exception&)
+            {
+                exceptions[i] = std::current_exception();
+            }
+        });
+        for (const auto& exception : exceptions)
+        {
+            if (exception != nullptr)
+            {
+                std::rethrow_exception(exception);
+            }
+        }
+    }
+    catch (const std::exception&)
+    {
+        // Rewind stream back to original position
+        _stream->SetPosition(originalPosition);
+        throw;
+    }
+}
+
+sawyercoding_chunk_header SawyerChunkReader::ReadChunkHeader()
+{
+    auto header = _stream->ReadValue<sawyercoding_chunk_header>();
+    if (header.length >= MAX_UNCOMPRESSED_CHUNK_SIZE)
+        throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+
+    switch (header.encoding)
+    {
+        case CHUNK_ENCODING_NONE:
+        case CHUNK_ENCODING_RLE:
+        case CHUNK_ENCODING_RLECOMPRESSED:
+        case CHUNK_ENCODING_ROTATE:
+            return header;
+        default:
+            throw SawyerChunkException(EXCEPTION_MSG_INVALID_CHUNK_ENCODING);
+    }
+}
+
+/**
+ * Returns the encoded data of the chunk. Streams in memory return it directly, otherwise it is read into buffer.
+ */
+const uint8_t* SawyerChunkReader::ReadEncodedData(const sawyercoding_chunk_header& header, std::vector<uint8_t>& buffer)
+{
+    auto data = static_cast<const uint8_t*>(_stream->GetData());
+    if (data != nullptr)
+    {
+        auto position = _stream->GetPosition();
+        if (position + header.length > _stream->GetLength())
+        {
+            throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+        }
+        _stream->Seek(header.length, OpenRCT2::STREAM_SEEK_CURRENT);
+        return data + position;
+    }
+
+    buffer.resize(header.length);
+    if (_stream->TryRead(buffer.data(), header.length) != header.length)
+    {
+        throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+    }
+    return buffer.data();
+}
+
+/**
+ * Decodes the chunk straight into dst. Chunks larger than length are decoded into a temporary buffer first and cut
+ * off, chunks smaller than length are padded with zero.
+ */
+void SawyerChunkReader::DecodeChunkInto(void* dst, size_t length, const uint8_t* src, const sawyercoding_chunk_header& header)
+{
+    size_t chunkLength;
+    try
     {
-        std::memcpy(dst, chunkData, length);
+        chunkLength = DecodeChunk(dst, length, src, header);
     }
-    else
+    catch (const SawyerChunkException&)
     {
-        std::memcpy(dst, chunkData, chunkLength);
-        auto remainingLength = length - chunkLength;
-        if (remainingLength > 0)
+        // Either larger than dst or corrupt, decoding it again tells which.
+        auto buffer = AllocateLargeTempBuffer();
+        try
+        {
+            chunkLength = DecodeChunk(buffer, MAX_UNCOMPRESSED_CHUNK_SIZE, src, header);
+        }
+        catch (const std::exception&)
         {
-            auto offset = static_cast<uint8_t*>(dst) + chunkLength;
-            std::fill_n(offset, remainingLength, 0x00);
+            FreeLargeTempBuffer(buffer);
+            throw;
         }
+        chunkLength = std::min(chunkLength, length);
+        std::memcpy(dst, buffer, chunkLength);
+        FreeLargeTempBuffer(buffer);
+    }
+
+    if (chunkLength == 0)
+    {
+        throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
+    }
+    if (chunkLength < length)
+    {
+        std::fill_n(static_cast<uint8_t*>(dst) + chunkLength, length - chunkLength, 0x00);
     }
 }
 
@@ -221,7 +345,19 @@ size_t SawyerChunkReader::DecodeChunkRLE(void* dst, size_t dstCapacity, const vo
                 throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
             }
 
-            std::fill_n(dst8, count, src8[i]);
+            if (static_cast<size_t>(dstEnd - dst8) >= MaxRunLength + 15)
+            {
+                // Fixed size blocks compile to single vector stores, what they write past the run is overwritten by
+                // the next one or ends up past the returned length.
+                for (size_t n = 0; n < count; n += 16)
+                {
+                    std::memset(dst8 + n, src8[i], 16);
+                }
+            }
+            else
+            {
+                std::fill_n(dst8, count, src8[i]);
+            }
             dst8 += count;
         }
         else
@@ -239,7 +375,17 @@ size_t SawyerChunkReader::DecodeChunkRLE(void* dst, size_t dstCapacity, const vo
                 throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
             }
 
-            std::memcpy(dst8, src8 + i + 1, rleCodeByte + 1);
+            if (static_cast<size_t>(dstEnd - dst8) >= MaxLiteralLength && srcLength - (i + 1) >= MaxLiteralLength)
+            {
+                for (size_t n = 0; n < static_cast<size_t>(rleCodeByte) + 1; n += 16)
+                {
+                    std::memcpy(dst8 + n, src8 + i + 1 + n, 16);
+                }
+            }
+            else
+            {
+                std::memcpy(dst8, src8 + i + 1, rleCodeByte + 1);
+            }
             dst8 += rleCodeByte + 1;
             i += rleCodeByte + 1;
         }
@@ -256,19 +402,41 @@ size_t SawyerChunkReader::DecodeChunkRepeat(void* dst, size_t dstCapacity, const
     {
         if (src8[i] == 0xFF)
         {
+            if (i + 1 >= srcLength)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+            }
+            if (dst8 >= dstEnd)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
+            }
             *dst8++ = src8[++i];
         }
         else
         {
             size_t count = (src8[i] & 7) + 1;
-            const uint8_t* copySrc = dst8 + static_cast<int32_t>(src8[i] >> 3) - 32;
+            auto copyOffset = 32 - static_cast<size_t>(src8[i] >> 3);
 
-            if (dst8 + count >= dstEnd || copySrc + count >= dstEnd)
+            // Copies from data already written, which may be the caller's buffer.
+            if (copyOffset > static_cast<size_t>(dst8 - static_cast<uint8_t*>(dst)))
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+            }
+            if (dst8 + count > dstEnd)
             {
                 throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
             }
+            const uint8_t* copySrc = dst8 - copyOffset;
 
-            std::memcpy(dst8, copySrc, count);
+            if (dst8 + 8 <= dstEnd)
+            {
+                // The encoder never repeats bytes past the copy, only the first count bytes have to be right.
+                std::memmove(dst8, copySrc, 8);
+            }
+            else
+            {
+                std::memcpy(dst8, copySrc, count);
+            }
             dst8 += count;
         }
     }
@@ -282,14 +450,7 @@ size_t SawyerChunkReader::DecodeChunkRotate(void* dst, size_t dstCapacity, const
         throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
     }
 
-    auto src8 = static_cast<const uint8_t*>(src);
-    auto dst8 = static_cast<uint8_t*>(dst);
-    uint8_t code = 1;
-    for (size_t i = 0; i < srcLength; i++)
-    {
-        dst8[i] = ror8(src8[i], code);
-        code = (code + 2) % 8;
-    }
+    gSawyerCoding->DecodeRotate(static_cast<const uint8_t*>(src), static_cast<uint8_t*>(dst), srcLength);
     return srcLength;
 }
 
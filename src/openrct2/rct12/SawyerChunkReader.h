@@ -14,6 +14,7 @@
 #include "SawyerChunk.h"
 
 #include <memory>
+#include <vector>
 
 namespace OpenRCT2
 {
@@ -28,8 +29,16 @@ class SawyerChunkReader final
 {
 private:
     OpenRCT2::IStream* const _stream = nullptr;
+    // Holds the encoded data of a chunk for streams that can not return their data directly.
+    std::vector<uint8_t> _encodedData;
 
 public:
+    struct Destination
+    {
+        void* Data;
+        size_t Length;
+    };
+
     explicit SawyerChunkReader(OpenRCT2::IStream* stream);
 
     /**
@@ -58,6 +67,13 @@ public:
      */
     void ReadChunk(void* dst, size_t length);
 
+    /**
+     * Reads the next chunks from the stream into the given buffers, the same
+     * as calling ReadChunk(dst, length) for each of them. The chunks are
+     * decoded at the same time.
+     */
+    void ReadChunks(const std::vector<Destination>& destinations);
+
     /**
      * Reads the next chunk from the stream into a buffer returned as the
      * specified type. If the chunk is smaller than the size of the type
@@ -71,6 +87,10 @@ public:
     }
 
 private:
+    sawyercoding_chunk_header ReadChunkHeader();
+    const uint8_t* ReadEncodedData(const sawyercoding_chunk_header& header, std::vector<uint8_t>& buffer);
+
+    static void DecodeChunkInto(void* dst, size_t length, const uint8_t* src, const sawyercoding_chunk_header& header);
     static size_t DecodeChunk(void* dst, size_t dstCapacity, const void* src, const sawyercoding_chunk_header& header);
     static size_t DecodeChunkRLERepeat(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
     static size_t DecodeChunkRLE(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
@@ -15,8 +15,10 @@
 #include "../OpenRCT2.h"
 #include "../common.h"
 #include "../config/Config.h"
+#include "../core/File.h"
 #include "../core/FileStream.h"
 #include "../core/IStream.hpp"
+#include "../core/MemoryStream.h"
 #include "../core/String.hpp"
 #include "../interface/Viewport.h"
 #include "../interface/Window.h"
@@ -46,10 +48,14 @@
 #include "../world/MapAnimation.h"
 #include "../world/Park.h"
 #include "../world/Sprite.h"
+#include "../world/Surface.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstring>
+#include <deque>
 #include <functional>
+#include <future>
 #include <iterator>
 #include <optional>
 
@@ -102,7 +108,11 @@ void S6Exporter::Save(OpenRCT2::IStream* stream, bool isScenario)
     }
 
     // 2: Write packed objects
-    if (_s6.header.num_packed_objects > 0)
+    if (!_packedObjects.empty())
+    {
+        stream->Write(_packedObjects.data(), _packedObjects.size());
+    }
+    else if (_s6.header.num_packed_objects > 0)
     {
         auto& objRepo = OpenRCT2::GetContext()->GetObjectRepository();
         objRepo.WritePackedObjects(stream, ExportObjectsList);
@@ -135,6 +145,18 @@ void S6Exporter::Save(OpenRCT2::IStream* stream, bool isScenario)
         chunkWriter.WriteChunk(&_s6.next_free_tile_element_pointer_index, 0x2E8570, SAWYER_ENCODING::RLECOMPRESSED);
     }
 
+    // 7+: Extended map chunks for maps too large for the classic chunks
+    if (_extendedMap.magic_number == S6_EXTENDED_MAP_MAGIC_NUMBER)
+    {
+        chunkWriter.WriteChunk(&_extendedMap, SAWYER_ENCODING::RLECOMPRESSED);
+        for (size_t i = 0; i < _extendedMapElements.size(); i += S6_EXTENDED_MAP_ELEMENTS_PER_CHUNK)
+        {
+            auto count = std::min<size_t>(_extendedMapElements.size() - i, S6_EXTENDED_MAP_ELEMENTS_PER_CHUNK);
+            chunkWriter.WriteChunk(&_extendedMapElements[i], count * sizeof(RCT12TileElement), SAWYER_ENCODING::RLECOMPRESSED);
+        }
+        chunkWriter.WriteChunk(_extendedMapLocations.get(), SAWYER_ENCODING::RLECOMPRESSED);
+    }
+
     // Determine number of bytes written
     size_t fileSize = stream->GetLength();
 
@@ -149,6 +171,18 @@ void S6Exporter::Save(OpenRCT2::IStream* stream, bool isScenario)
     stream->WriteValue(checksum);
 }
 
+void S6Exporter::PackObjects()
+{
+    if (ExportObjectsList.empty())
+        return;
+
+    OpenRCT2::MemoryStream ms;
+    auto& objRepo = OpenRCT2::GetContext()->GetObjectRepository();
+    objRepo.WritePackedObjects(&ms, ExportObjectsList);
+    auto data = static_cast<const uint8_t*>(ms.GetData());
+    _packedObjects.assign(data, data + ms.GetLength());
+}
+
 void S6Exporter::Export()
 {
     int32_t regular_cycle = check_for_sprite_list_cycles(false);
@@ -429,6 +463,7 @@ void S6Exporter::Export()
     }
 
     scenario_fix_ghosts(&_s6);
+    ExportExtendedMap();
     game_convert_strings_to_rct2(&_s6);
 
     ExportUserStrings();
@@ -1096,6 +1131,11 @@ void S6Exporter::ExportSpriteVehicle(RCT2SpriteVehicle* dst, const Vehicle* src)
     dst->target_seat_rotation = src->target_seat_rotation;
 }
 
+static rct12_xyzd8 ExportPathfindLocation(const TileCoordsXYZD& src)
+{
+    return { static_cast<uint8_t>(src.x), static_cast<uint8_t>(src.y), static_cast<uint8_t>(src.z), src.direction };
+}
+
 void S6Exporter::ExportSpritePeep(RCT2SpritePeep* dst, const Peep* src)
 {
     ExportSpriteCommonProperties(dst, static_cast<const SpriteBase*>(src));
@@ -1217,10 +1257,10 @@ void S6Exporter::ExportSpritePeep(RCT2SpritePeep* dst, const Peep* src)
     dst->peep_is_lost_countdown = src->GuestIsLostCountdown;
     dst->photo1_ride_ref = OpenRCT2RideIdToRCT12RideId(src->Photo1RideRef);
     dst->peep_flags = src->PeepFlags;
-    dst->pathfind_goal = src->PathfindGoal;
+    dst->pathfind_goal = ExportPathfindLocation(src->PathfindGoal);
     for (size_t i = 0; i < std::size(src->PathfindHistory); i++)
     {
-        dst->pathfind_history[i] = src->PathfindHistory[i];
+        dst->pathfind_history[i] = ExportPathfindLocation(src->PathfindHistory[i]);
     }
     dst->no_action_frame_num = src->WalkingFrameNum;
     dst->litter_count = src->LitterCount;
@@ -1414,10 +1454,7 @@ void S6Exporter::ExportMapAnimations()
 
 void S6Exporter::ExportTileElements()
 {
-    for (uint32_t index = 0; index < RCT2_MAX_TILE_ELEMENTS; index++)
-    {
-        auto src = &gTileElements[index];
-        auto dst = &_s6.tile_elements[index];
+    auto exportElement = [this](RCT12TileElement* dst, TileElement* src) {
         if (src->base_height == MAX_ELEMENT_HEIGHT)
         {
             std::memcpy(dst, src, sizeof(*dst));
@@ -1431,8 +1468,181 @@ void S6Exporter::ExportTileElements()
             else
                 ExportTileElement(dst, src);
         }
+    };
+
+    // The park files store the elements tile by tile in rows, the rest of the list is left empty.
+    uint32_t index = 0;
+    _extendedMapElements.clear();
+    if (gMapSizeTechnical > MAXIMUM_MAP_SIZE_TECHNICAL)
+    {
+        // The map does not fit the park file chunks, all tiles go into the extended map chunks and the park file
+        // chunks get an empty map.
+        for (int32_t y = 0; y < gMapSizeTechnical; y++)
+        {
+            for (int32_t x = 0; x < gMapSizeTechnical; x++)
+            {
+                auto src = map_get_first_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
+                if (src == nullptr)
+                    continue;
+                do
+                {
+                    exportElement(&_extendedMapElements.emplace_back(), src);
+                } while (!(src++)->IsLastForTile());
+            }
+        }
+
+        TileElement surfaceElement{};
+        surfaceElement.ClearAs(TILE_ELEMENT_TYPE_SURFACE);
+        surfaceElement.SetLastForTile(true);
+        surfaceElement.base_height = 14;
+        surfaceElement.clearance_height = 14;
+        surfaceElement.AsSurface()->SetEdgeStyle(TERRAIN_EDGE_ROCK);
+        for (; index < MAX_TILE_TILE_ELEMENT_POINTERS; index++)
+        {
+            exportElement(&_s6.tile_elements[index], &surfaceElement);
+        }
+    }
+    else
+    {
+        for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+        {
+            for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+            {
+                auto src = map_get_first_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
+                if (src == nullptr)
+                    continue;
+                do
+                {
+                    if (index >= RCT2_MAX_TILE_ELEMENTS)
+                    {
+                        throw std::runtime_error("Too many map elements for the RCT2 format.");
+                    }
+                    exportElement(&_s6.tile_elements[index++], src);
+                } while (!(src++)->IsLastForTile());
+            }
+        }
+    }
+    TileElement emptyElement{};
+    for (; index < RCT2_MAX_TILE_ELEMENTS; index++)
+    {
+        exportElement(&_s6.tile_elements[index], &emptyElement);
     }
     _s6.next_free_tile_element_pointer_index = gNextFreeTileElementPointerIndex;
+    if (!_extendedMapElements.empty())
+    {
+        _s6.next_free_tile_element_pointer_index = MAX_TILE_TILE_ELEMENT_POINTERS;
+    }
+}
+
+void S6Exporter::ExportExtendedMap()
+{
+    _extendedMap = {};
+    _extendedMapLocations = nullptr;
+    if (_extendedMapElements.empty())
+        return;
+
+    auto numElements = scenario_remove_ghost_elements(&_s6, _extendedMapElements.data(), gMapSizeTechnical);
+    _extendedMapElements.resize(numElements);
+
+    _extendedMap.magic_number = S6_EXTENDED_MAP_MAGIC_NUMBER;
+    _extendedMap.map_size = static_cast<uint16_t>(gMapSize);
+    _extendedMap.map_size_technical = static_cast<uint16_t>(gMapSizeTechnical);
+    _extendedMap.grass_and_scenery_tilepos = gGrassSceneryTileLoopPosition;
+    _extendedMap.num_tile_elements = static_cast<uint32_t>(numElements);
+
+    // The park file chunks describe the empty classic sized map they hold
+    _s6.map_size = MAXIMUM_MAP_SIZE_TECHNICAL;
+    _s6.map_size_units = MAXIMUM_MAP_SIZE_TECHNICAL * COORDS_XY_STEP - COORDS_XY_STEP;
+    _s6.map_size_minus_2 = MAXIMUM_MAP_SIZE_TECHNICAL * COORDS_XY_STEP - 2;
+    _s6.map_max_xy = MAXIMUM_MAP_SIZE_TECHNICAL * COORDS_XY_STEP - 33;
+    _s6.grass_and_scenery_tilepos = static_cast<uint16_t>(gGrassSceneryTileLoopPosition);
+
+    ExportExtendedMapLocations();
+}
+
+void S6Exporter::ExportExtendedMapLocations()
+{
+    // Every location not set below stays undefined
+    _extendedMapLocations = std::make_unique<rct_s6_extended_locations>();
+    std::memset(_extendedMapLocations.get(), 0xFF, sizeof(rct_s6_extended_locations));
+
+    auto exportLocation = [](rct_s6_extended_xy& dst, int32_t x, int32_t y) {
+        dst = { static_cast<uint16_t>(x), static_cast<uint16_t>(y) };
+    };
+
+    for (int32_t index = 0; index < RCT12_MAX_RIDES_IN_PARK; index++)
+    {
+        const auto* src = get_ride(index);
+        if (src == nullptr || src->type == RIDE_TYPE_NULL)
+            continue;
+
+        auto& dst = _extendedMapLocations->rides[index];
+        if (!src->overall_view.isNull())
+        {
+            auto tileLoc = TileCoordsXY(src->overall_view);
+            exportLocation(dst.overall_view, tileLoc.x, tileLoc.y);
+        }
+        for (int32_t i = 0; i < RCT12_MAX_STATIONS_PER_RIDE; i++)
+        {
+            if (!src->stations[i].Start.isNull())
+            {
+                auto tileStartLoc = TileCoordsXY(src->stations[i].Start);
+                exportLocation(dst.station_starts[i], tileStartLoc.x, tileStartLoc.y);
+            }
+            auto entrance = ride_get_entrance_location(src, i);
+            if (!entrance.isNull())
+            {
+                exportLocation(dst.entrances[i], entrance.x, entrance.y);
+            }
+            auto exit = ride_get_exit_location(src, i);
+            if (!exit.isNull())
+            {
+                exportLocation(dst.exits[i], exit.x, exit.y);
+            }
+        }
+        exportLocation(dst.boat_hire_return_position, src->boat_hire_return_position.x, src->boat_hire_return_position.y);
+        if (!src->CurTestTrackLocation.isNull())
+        {
+            exportLocation(dst.cur_test_track_location, src->CurTestTrackLocation.x, src->CurTestTrackLocation.y);
+        }
+        for (size_t i = 0; i < std::size(dst.chairlift_bullwheel_location); i++)
+        {
+            exportLocation(
+                dst.chairlift_bullwheel_location[i], src->ChairliftBullwheelLocation[i].x,
+                src->ChairliftBullwheelLocation[i].y);
+        }
+    }
+
+    for (BannerIndex i = 0; i < RCT2_MAX_BANNERS_IN_PARK; i++)
+    {
+        auto src = GetBanner(i);
+        if (!src->IsNull())
+        {
+            exportLocation(_extendedMapLocations->banners[i], src->position.x, src->position.y);
+        }
+    }
+
+    for (int32_t i = 0; i < RCT2_MAX_SPRITES; i++)
+    {
+        auto& dst = _extendedMapLocations->sprites[i];
+        auto* entity = GetEntity(i);
+        if (auto* vehicle = entity->As<Vehicle>(); vehicle != nullptr)
+        {
+            if (!vehicle->BoatLocation.isNull())
+            {
+                exportLocation(
+                    dst.locations[0], vehicle->BoatLocation.x / COORDS_XY_STEP, vehicle->BoatLocation.y / COORDS_XY_STEP);
+            }
+        }
+        else if (auto* peep = entity->As<Peep>(); peep != nullptr)
+        {
+            exportLocation(dst.locations[0], peep->PathfindGoal.x, peep->PathfindGoal.y);
+            for (size_t j = 0; j < std::size(peep->PathfindHistory); j++)
+            {
+                exportLocation(dst.locations[j + 1], peep->PathfindHistory[j].x, peep->PathfindHistory[j].y);
+            }
+        }
+    }
 }
 
 void S6Exporter::ExportTileElement(RCT12TileElement* dst, TileElement* src)
@@ -1681,6 +1891,42 @@ enum : uint32_t
     S6_SAVE_FLAG_AUTOMATIC = 1u << 31,
 };
 
+/**
+ * Exports the current park, the export holds everything the file is written from.
+ */
+static std::unique_ptr<S6Exporter> scenario_save_export(int32_t flags)
+{
+    if (!(flags & S6_SAVE_FLAG_AUTOMATIC))
+    {
+        window_close_construction_windows();
+    }
+
+    map_reorganise_elements();
+    viewport_set_saved_view();
+
+    auto s6exporter = std::make_unique<S6Exporter>();
+    if (flags & S6_SAVE_FLAG_EXPORT)
+    {
+        auto& objManager = OpenRCT2::GetContext()->GetObjectManager();
+        s6exporter->ExportObjectsList = objManager.GetPackableObjects();
+    }
+    s6exporter->RemoveTracklessRides = true;
+    s6exporter->Export();
+    return s6exporter;
+}
+
+static void scenario_save_write(S6Exporter& s6exporter, const utf8* path, int32_t flags)
+{
+    if (flags & S6_SAVE_FLAG_SCENARIO)
+    {
+        s6exporter.SaveScenario(path);
+    }
+    else
+    {
+        s6exporter.SaveGame(path);
+    }
+}
+
 /**
  *
  *  rct2: 0x006754F5
@@ -1697,40 +1943,20 @@ int32_t scenario_save(const utf8* path, int32_t flags)
         log_verbose("scenario_save(%s, SAVED GAME)", path);
     }
 
-    if (!(flags & S6_SAVE_FLAG_AUTOMATIC))
-    {
-        window_close_construction_windows();
-    }
-
-    map_reorganise_elements();
-    viewport_set_saved_view();
+    // A background save may still be writing the same file.
+    scenario_save_wait();
 
     bool result = false;
-    auto s6exporter = new S6Exporter();
     try
     {
-        if (flags & S6_SAVE_FLAG_EXPORT)
-        {
-            auto& objManager = OpenRCT2::GetContext()->GetObjectManager();
-            s6exporter->ExportObjectsList = objManager.GetPackableObjects();
-        }
-        s6exporter->RemoveTracklessRides = true;
-        s6exporter->Export();
-        if (flags & S6_SAVE_FLAG_SCENARIO)
-        {
-            s6exporter->SaveScenario(path);
-        }
-        else
-        {
-            s6exporter->SaveGame(path);
-        }
+        auto s6exporter = scenario_save_export(flags);
+        scenario_save_write(*s6exporter, path, flags);
         result = true;
     }
     catch (const std::exception& e)
     {
         log_error("Unable to save park: '%s'", e.what());
     }
-    delete s6exporter;
 
     gfx_invalidate_screen();
 
@@ -1740,3 +1966,107 @@ int32_t scenario_save(const utf8* path, int32_t flags)
     }
     return result;
 }
+
+struct BackgroundSave
+{
+    std::shared_future<bool> Result;
+    std::function<void(bool)> Callback;
+    int32_t Flags;
+};
+
+// Saves that are still being written, oldest first. Only used from the main thread.
+static std::deque<BackgroundSave> _backgroundSaves;
+
+void scenario_save_async(const utf8* path, int32_t flags, std::function<void(bool)> callback)
+{
+    log_verbose("scenario_save_async(%s, %s)", path, (flags & S6_SAVE_FLAG_SCENARIO) ? "SCENARIO" : "SAVED GAME");
+
+    auto startTime = std::chrono::steady_clock::now();
+    std::unique_ptr<S6Exporter> s6exporter;
+    try
+    {
+        s6exporter = scenario_save_export(flags);
+        s6exporter->PackObjects();
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to save park: '%s'", e.what());
+        gfx_invalidate_screen();
+        if (callback)
+            callback(false);
+        return;
+    }
+    gfx_invalidate_screen();
+    std::chrono::duration<double, std::milli> exportTime = std::chrono::steady_clock::now() - startTime;
+    log_verbose("Exported park in %.2f ms, writing %s in the background", exportTime.count(), path);
+
+    // Saves to the same file have to be written in order, each one waits for the one before.
+    std::shared_future<bool> previous;
+    if (!_backgroundSaves.empty())
+    {
+        previous = _backgroundSaves.back().Result;
+    }
+    auto result = std::async(
+        std::launch::async,
+        [s6exporter = std::move(s6exporter), previous, path = std::string(path), flags]() -> bool {
+            if (previous.valid())
+            {
+                previous.wait();
+            }
+
+            // The save is written next to the file first, so the previous save is kept if writing fails part-way.
+            auto tempPath = path + ".tmp";
+            try
+            {
+                scenario_save_write(*s6exporter, tempPath.c_str(), flags);
+                if (!File::Replace(tempPath, path))
+                {
+                    throw IOException("Unable to replace " + path);
+                }
+                return true;
+            }
+            catch (const std::exception& e)
+            {
+                log_error("Unable to save park: '%s'", e.what());
+                if (File::Exists(tempPath))
+                {
+                    File::Delete(tempPath);
+                }
+                return false;
+            }
+        });
+    _backgroundSaves.push_back({ result.share(), callback, flags });
+}
+
+void scenario_save_update()
+{
+    while (!_backgroundSaves.empty())
+    {
+        auto& save = _backgroundSaves.front();
+        if (save.Result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            break;
+
+        auto result = save.Result.get();
+        auto callback = std::move(save.Callback);
+        auto flags = save.Flags;
+        _backgroundSaves.pop_front();
+
+        if (result && !(flags & S6_SAVE_FLAG_AUTOMATIC))
+        {
+            gScreenAge = 0;
+        }
+        if (callback)
+        {
+            callback(result);
+        }
+    }
+}
+
+void scenario_save_wait()
+{
+    for (const auto& save : _backgroundSaves)
+    {
+        save.Result.wait();
+    }
+    scenario_save_update();
+}
@@ -13,6 +13,7 @@
 #include "../object/ObjectList.h"
 #include "../scenario/Scenario.h"
 
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -43,6 +44,11 @@ public:
     void SaveScenario(const utf8* path);
     void SaveScenario(OpenRCT2::IStream* stream);
     void Export();
+
+    /**
+     * Writes the packed objects into memory, saving no longer needs the object repository afterwards.
+     */
+    void PackObjects();
     void ExportParkName();
     void ExportRides();
     void ExportRide(rct2_ride* dst, const Ride* src);
@@ -57,6 +63,10 @@ public:
 private:
     rct_s6_data _s6{};
     std::vector<std::string> _userStrings;
+    std::vector<uint8_t> _packedObjects;
+    rct_s6_extended_map_header _extendedMap{};
+    std::vector<RCT12TileElement> _extendedMapElements;
+    std::unique_ptr<rct_s6_extended_locations> _extendedMapLocations;
 
     void Save(OpenRCT2::IStream* stream, bool isScenario);
     static uint32_t GetLoanHash(money32 initialCash, money32 bankLoan, uint32_t maxBankLoan);
@@ -75,6 +85,8 @@ private:
 
     void ExportTileElements();
     void ExportTileElement(RCT12TileElement* dst, TileElement* src);
+    void ExportExtendedMap();
+    void ExportExtendedMapLocations();
 
     std::optional<uint16_t> AllocateUserString(const std::string_view& value);
     void ExportUserStrings();
@@ -16,6 +16,8 @@
 #include "../config/Config.h"
 #include "../core/Console.hpp"
 #include "../core/FileStream.h"
+#include "../core/MemoryMappedFile.h"
+#include "../core/MemoryStream.h"
 #include "../core/IStream.hpp"
 #include "../core/Path.hpp"
 #include "../core/Random.hpp"
@@ -55,6 +57,8 @@
 #include "../world/Surface.h"
 
 #include <algorithm>
+#include <memory>
+#include <vector>
 
 /**
  * Class to import RollerCoaster Tycoon 2 scenarios (*.SC6) and saved games (*.SV6).
@@ -68,6 +72,9 @@ private:
     rct_s6_data _s6{};
     uint8_t _gameVersion = 0;
     bool _isSV7 = false;
+    rct_s6_extended_map_header _extendedMap{};
+    std::vector<RCT12TileElement> _extendedMapElements;
+    std::unique_ptr<rct_s6_extended_locations> _extendedMapLocations;
 
 public:
     S6Importer(IObjectRepository& objectRepository)
@@ -94,20 +101,42 @@ public:
 
     ParkLoadResult LoadSavedGame(const utf8* path, bool skipObjectCheck = false) override
     {
-        auto fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_OPEN);
-        auto result = LoadFromStream(&fs, false, skipObjectCheck);
+        auto result = LoadFromFile(path, false, skipObjectCheck);
         _s6Path = path;
         return result;
     }
 
     ParkLoadResult LoadScenario(const utf8* path, bool skipObjectCheck = false) override
     {
-        auto fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_OPEN);
-        auto result = LoadFromStream(&fs, true, skipObjectCheck);
+        auto result = LoadFromFile(path, true, skipObjectCheck);
         _s6Path = path;
         return result;
     }
 
+    /**
+     * Reads the file through a mapping if possible, so the chunks are decoded straight from the mapped pages.
+     */
+    ParkLoadResult LoadFromFile(const utf8* path, bool isScenario, bool skipObjectCheck)
+    {
+        std::unique_ptr<OpenRCT2::MemoryMappedFile> mapping;
+        try
+        {
+            mapping = std::make_unique<OpenRCT2::MemoryMappedFile>(path);
+        }
+        catch (const std::exception& e)
+        {
+            log_verbose("Unable to map '%s', reading it instead: %s", path, e.what());
+        }
+
+        if (mapping != nullptr && mapping->GetData() != nullptr)
+        {
+            auto ms = OpenRCT2::MemoryStream(mapping->GetData(), mapping->GetLength());
+            return LoadFromStream(&ms, isScenario, skipObjectCheck);
+        }
+        auto fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_OPEN);
+        return LoadFromStream(&fs, isScenario, skipObjectCheck);
+    }
+
     ParkLoadResult LoadFromStream(
         OpenRCT2::IStream* stream, bool isScenario, [[maybe_unused]] bool skipObjectCheck = false,
         const utf8* path = String::Empty) override
@@ -157,31 +186,101 @@ public:
 
         if (isScenario)
         {
-            chunkReader.ReadChunk(&_s6.objects, sizeof(_s6.objects));
-            chunkReader.ReadChunk(&_s6.elapsed_months, 16);
-            chunkReader.ReadChunk(&_s6.tile_elements, sizeof(_s6.tile_elements));
-            chunkReader.ReadChunk(&_s6.next_free_tile_element_pointer_index, 2560076);
-            chunkReader.ReadChunk(&_s6.guests_in_park, 4);
-            chunkReader.ReadChunk(&_s6.last_guests_in_park, 8);
-            chunkReader.ReadChunk(&_s6.park_rating, 2);
-            chunkReader.ReadChunk(&_s6.active_research_types, 1082);
-            chunkReader.ReadChunk(&_s6.current_expenditure, 16);
-            chunkReader.ReadChunk(&_s6.park_value, 4);
-            chunkReader.ReadChunk(&_s6.completed_company_value, 483816);
+            chunkReader.ReadChunks({
+                { &_s6.objects, sizeof(_s6.objects) },
+                { &_s6.elapsed_months, 16 },
+                { &_s6.tile_elements, sizeof(_s6.tile_elements) },
+                { &_s6.next_free_tile_element_pointer_index, 2560076 },
+                { &_s6.guests_in_park, 4 },
+                { &_s6.last_guests_in_park, 8 },
+                { &_s6.park_rating, 2 },
+                { &_s6.active_research_types, 1082 },
+                { &_s6.current_expenditure, 16 },
+                { &_s6.park_value, 4 },
+                { &_s6.completed_company_value, 483816 },
+            });
         }
         else
         {
-            chunkReader.ReadChunk(&_s6.objects, sizeof(_s6.objects));
-            chunkReader.ReadChunk(&_s6.elapsed_months, 16);
-            chunkReader.ReadChunk(&_s6.tile_elements, sizeof(_s6.tile_elements));
-            chunkReader.ReadChunk(&_s6.next_free_tile_element_pointer_index, 3048816);
+            chunkReader.ReadChunks({
+                { &_s6.objects, sizeof(_s6.objects) },
+                { &_s6.elapsed_months, 16 },
+                { &_s6.tile_elements, sizeof(_s6.tile_elements) },
+                { &_s6.next_free_tile_element_pointer_index, 3048816 },
+            });
         }
+        ReadExtendedMap(chunkReader, stream);
 
         _s6Path = path;
 
         return ParkLoadResult(GetRequiredObjects());
     }
 
+    /**
+     * Reads the chunks that follow the park file chunks of maps too large for the classic map size.
+     */
+    void ReadExtendedMap(SawyerChunkReader& chunkReader, OpenRCT2::IStream* stream)
+    {
+        _extendedMap = {};
+        _extendedMapElements.clear();
+        _extendedMapLocations = nullptr;
+
+        // Only the checksum follows the park file chunks of classic maps, the network map data is followed by more.
+        auto position = stream->GetPosition();
+        if (stream->GetLength() - position <= sizeof(uint32_t))
+            return;
+
+        rct_s6_extended_map_header header{};
+        try
+        {
+            chunkReader.ReadChunk(&header, sizeof(header));
+        }
+        catch (const std::exception& e)
+        {
+            log_verbose("Ignoring data after the park file chunks: %s", e.what());
+            return;
+        }
+        if (header.magic_number != S6_EXTENDED_MAP_MAGIC_NUMBER)
+        {
+            log_verbose("Ignoring data after the park file chunks.");
+            stream->SetPosition(position);
+            return;
+        }
+
+        int32_t mapSizeTechnical = header.map_size_technical;
+        if (header.map_size > MAXIMUM_MAP_SIZE_EXTENDED || mapSizeTechnical <= MAXIMUM_MAP_SIZE_TECHNICAL
+            || mapSizeTechnical != map_get_size_technical(header.map_size)
+            || header.num_tile_elements < static_cast<uint32_t>(mapSizeTechnical * mapSizeTechnical))
+        {
+            throw std::runtime_error("Invalid extended map header.");
+        }
+
+        std::vector<RCT12TileElement> elements(header.num_tile_elements);
+        for (size_t i = 0; i < elements.size(); i += S6_EXTENDED_MAP_ELEMENTS_PER_CHUNK)
+        {
+            auto count = std::min<size_t>(elements.size() - i, S6_EXTENDED_MAP_ELEMENTS_PER_CHUNK);
+            chunkReader.ReadChunk(&elements[i], count * sizeof(RCT12TileElement));
+        }
+        auto numTiles = std::count_if(
+            elements.begin(), elements.end(), [](const RCT12TileElement& element) { return element.IsLastForTile(); });
+        if (numTiles < mapSizeTechnical * mapSizeTechnical)
+        {
+            throw std::runtime_error("Extended map is missing tiles.");
+        }
+
+        auto locations = std::make_unique<rct_s6_extended_locations>();
+        chunkReader.ReadChunk(locations.get(), sizeof(rct_s6_extended_locations));
+
+        _extendedMap = header;
+        _extendedMapElements = std::move(elements);
+        _extendedMapLocations = std::move(locations);
+    }
+
+    bool HasExtendedMap() const
+    {
+        return _extendedMap.magic_number == S6_EXTENDED_MAP_MAGIC_NUMBER;
+    }
+
     bool GetDetails(scenario_index_entry* dst) override
     {
         *dst = {};
@@ -346,6 +445,13 @@ public:
         gMapSizeMinus2 = _s6.map_size_minus_2;
         gMapSize = _s6.map_size;
         gMapSizeMaxXY = _s6.map_max_xy;
+        if (HasExtendedMap())
+        {
+            gMapSize = _extendedMap.map_size;
+            gMapSizeUnits = gMapSize * COORDS_XY_STEP - COORDS_XY_STEP;
+            gMapSizeMinus2 = gMapSize * COORDS_XY_STEP - 2;
+            gMapSizeMaxXY = gMapSize * COORDS_XY_STEP - 33;
+        }
         gSamePriceThroughoutPark = _s6.same_price_throughout
             | (static_cast<uint64_t>(_s6.same_price_throughout_extended) << 32);
         _suggestedGuestMaximum = _s6.suggested_max_guests;
@@ -388,6 +494,7 @@ public:
         gCurrentRealTimeTicks = 0;
 
         ImportRides();
+        ImportExtendedMapLocations();
 
         gSavedAge = _s6.saved_age;
         gSavedView = ScreenCoordsXY{ _s6.saved_view_x, _s6.saved_view_y };
@@ -398,6 +505,10 @@ public:
         ImportRideMeasurements();
         gNextGuestNumber = _s6.next_guest_index;
         gGrassSceneryTileLoopPosition = _s6.grass_and_scenery_tilepos;
+        if (HasExtendedMap())
+        {
+            gGrassSceneryTileLoopPosition = _extendedMap.grass_and_scenery_tilepos;
+        }
         std::memcpy(gStaffPatrolAreas, _s6.patrol_areas, sizeof(_s6.patrol_areas));
         std::memcpy(gStaffModes, _s6.staff_modes, sizeof(_s6.staff_modes));
         // unk_13CA73E
@@ -488,6 +599,94 @@ public:
         research_determine_first_of_type();
     }
 
+    /**
+     * Replaces the locations the park file chunks truncate to the classic map with the ones of the extended map.
+     */
+    void ImportExtendedMapLocations()
+    {
+        if (!HasExtendedMap())
+            return;
+
+        auto isDefined = [](const rct_s6_extended_xy& src) {
+            return src.x != RCT12_EXTENDED_XY_UNDEFINED && src.y != RCT12_EXTENDED_XY_UNDEFINED;
+        };
+
+        for (uint8_t index = 0; index < RCT12_MAX_RIDES_IN_PARK; index++)
+        {
+            auto* dst = get_ride(index);
+            if (dst == nullptr || dst->type == RIDE_TYPE_NULL)
+                continue;
+
+            const auto& src = _extendedMapLocations->rides[index];
+            if (isDefined(src.overall_view))
+            {
+                dst->overall_view = TileCoordsXY{ src.overall_view.x, src.overall_view.y }.ToCoordsXY();
+            }
+            for (int32_t i = 0; i < RCT12_MAX_STATIONS_PER_RIDE; i++)
+            {
+                if (isDefined(src.station_starts[i]))
+                {
+                    dst->stations[i].Start = TileCoordsXY{ src.station_starts[i].x, src.station_starts[i].y }.ToCoordsXY();
+                }
+                auto height = _s6.rides[index].station_heights[i];
+                if (isDefined(src.entrances[i]))
+                {
+                    ride_set_entrance_location(dst, i, { src.entrances[i].x, src.entrances[i].y, height, 0 });
+                }
+                if (isDefined(src.exits[i]))
+                {
+                    ride_set_exit_location(dst, i, { src.exits[i].x, src.exits[i].y, height, 0 });
+                }
+            }
+            dst->boat_hire_return_position = { src.boat_hire_return_position.x, src.boat_hire_return_position.y };
+            if (isDefined(src.cur_test_track_location) && !dst->CurTestTrackLocation.isNull())
+            {
+                dst->CurTestTrackLocation.x = src.cur_test_track_location.x;
+                dst->CurTestTrackLocation.y = src.cur_test_track_location.y;
+            }
+            for (size_t i = 0; i < std::size(src.chairlift_bullwheel_location); i++)
+            {
+                dst->ChairliftBullwheelLocation[i].x = src.chairlift_bullwheel_location[i].x;
+                dst->ChairliftBullwheelLocation[i].y = src.chairlift_bullwheel_location[i].y;
+            }
+        }
+
+        for (BannerIndex i = 0; i < RCT2_MAX_BANNERS_IN_PARK; i++)
+        {
+            auto* dst = GetBanner(i);
+            const auto& src = _extendedMapLocations->banners[i];
+            if (!dst->IsNull() && isDefined(src))
+            {
+                dst->position = { src.x, src.y };
+            }
+        }
+
+        for (int32_t i = 0; i < RCT2_MAX_SPRITES; i++)
+        {
+            auto* entity = GetEntity(i);
+            const auto& src = _extendedMapLocations->sprites[i];
+            if (auto* vehicle = entity->As<Vehicle>(); vehicle != nullptr)
+            {
+                if (!vehicle->BoatLocation.isNull() && isDefined(src.locations[0]))
+                {
+                    vehicle->BoatLocation = TileCoordsXY{ src.locations[0].x, src.locations[0].y }.ToCoordsXY();
+                }
+            }
+            else if (auto* peep = entity->As<Peep>(); peep != nullptr)
+            {
+                auto importLocation = [](TileCoordsXYZD& dst, const rct_s6_extended_xy& location) {
+                    dst.x = location.x;
+                    dst.y = location.y;
+                };
+                importLocation(peep->PathfindGoal, src.locations[0]);
+                for (size_t j = 0; j < std::size(peep->PathfindHistory); j++)
+                {
+                    importLocation(peep->PathfindHistory[j], src.locations[j + 1]);
+                }
+            }
+        }
+    }
+
     void ImportRides()
     {
         for (uint8_t index = 0; index < RCT12_MAX_RIDES_IN_PARK; index++)
@@ -965,7 +1164,7 @@ public:
 
     void Initialise()
     {
-        OpenRCT2::GetContext()->GetGameState()->InitAll(_s6.map_size);
+        OpenRCT2::GetContext()->GetGameState()->InitAll(HasExtendedMap() ? _extendedMap.map_size : _s6.map_size);
     }
 
     /**
@@ -1036,29 +1235,44 @@ public:
 
     void ImportTileElements()
     {
-        for (uint32_t index = 0; index < RCT2_MAX_TILE_ELEMENTS; index++)
+        if (HasExtendedMap())
         {
-            auto src = &_s6.tile_elements[index];
-            auto dst = &gTileElements[index];
-            if (src->base_height == RCT12_MAX_ELEMENT_HEIGHT)
-            {
-                std::memcpy(dst, src, sizeof(*src));
-            }
-            else
+            map_resize_storage(static_cast<uint32_t>(_extendedMapElements.size()));
+            for (size_t index = 0; index < _extendedMapElements.size(); index++)
             {
-                auto tileElementType = static_cast<RCT12TileElementType>(src->GetType());
-                // Todo: replace with setting invisibility bit
-                if (tileElementType == RCT12TileElementType::Corrupt
-                    || tileElementType == RCT12TileElementType::EightCarsCorrupt14
-                    || tileElementType == RCT12TileElementType::EightCarsCorrupt15)
-                    std::memcpy(dst, src, sizeof(*src));
-                else
-                    ImportTileElement(dst, src);
+                ImportTileElementOrCopy(&gTileElements[index], &_extendedMapElements[index]);
             }
+            gNextFreeTileElementPointerIndex = static_cast<uint32_t>(_extendedMapElements.size());
+            return;
+        }
+
+        map_resize_storage(RCT2_MAX_TILE_ELEMENTS);
+        for (uint32_t index = 0; index < RCT2_MAX_TILE_ELEMENTS; index++)
+        {
+            ImportTileElementOrCopy(&gTileElements[index], &_s6.tile_elements[index]);
         }
         gNextFreeTileElementPointerIndex = _s6.next_free_tile_element_pointer_index;
     }
 
+    void ImportTileElementOrCopy(TileElement* dst, const RCT12TileElement* src)
+    {
+        if (src->base_height == RCT12_MAX_ELEMENT_HEIGHT)
+        {
+            std::memcpy(dst, src, sizeof(*src));
+        }
+        else
+        {
+            auto tileElementType = static_cast<RCT12TileElementType>(src->GetType());
+            // Todo: replace with setting invisibility bit
+            if (tileElementType == RCT12TileElementType::Corrupt
+                || tileElementType == RCT12TileElementType::EightCarsCorrupt14
+                || tileElementType == RCT12TileElementType::EightCarsCorrupt15)
+                std::memcpy(dst, src, sizeof(*src));
+            else
+                ImportTileElement(dst, src);
+        }
+    }
+
     void ImportTileElement(TileElement* dst, const RCT12TileElement* src)
     {
         // Todo: allow for changing defition of OpenRCT2 tile element types - replace with a map
@@ -1421,6 +1635,11 @@ public:
         dst->target_seat_rotation = src->target_seat_rotation;
     }
 
+    static TileCoordsXYZD ImportPathfindLocation(const rct12_xyzd8& src)
+    {
+        return { src.x, src.y, src.z, src.direction };
+    }
+
     void ImportSpritePeep(Peep* dst, const RCT2SpritePeep* src)
     {
         ImportSpriteCommonProperties(static_cast<SpriteBase*>(dst), src);
@@ -1505,10 +1724,10 @@ public:
         dst->GuestIsLostCountdown = src->peep_is_lost_countdown;
         dst->Photo1RideRef = RCT12RideIdToOpenRCT2RideId(src->photo1_ride_ref);
         dst->PeepFlags = src->peep_flags;
-        dst->PathfindGoal = src->pathfind_goal;
+        dst->PathfindGoal = ImportPathfindLocation(src->pathfind_goal);
         for (size_t i = 0; i < std::size(src->pathfind_history); i++)
         {
-            dst->PathfindHistory[i] = src->pathfind_history[i];
+            dst->PathfindHistory[i] = ImportPathfindLocation(src->pathfind_history[i]);
         }
         dst->WalkingFrameNum = src->no_action_frame_num;
         dst->LitterCount = src->litter_count;
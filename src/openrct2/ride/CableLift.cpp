@@ -231,12 +231,12 @@ bool Vehicle::CableLiftUpdateTrackMotionForwards()
     if (curRide == nullptr)
         return false;
 
-    for (; remaining_distance >= 13962; _vehicleUnkF64E10++)
+    for (; remaining_distance >= 13962; gVehicleMotion.UnkF64E10++)
     {
         uint8_t trackType = GetTrackType();
         if (trackType == TrackElemType::CableLiftHill && track_progress == 160)
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_1;
+            gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_1;
         }
 
         uint16_t trackProgress = track_progress + 1;
@@ -270,17 +270,17 @@ bool Vehicle::CableLiftUpdateTrackMotionForwards()
 
         uint8_t bx = 0;
         unk.z += RideTypeDescriptors[curRide->type].Heights.VehicleZOffset;
-        if (unk.x != unk_F64E20.x)
+        if (unk.x != gVehicleMotion.UnkF64E20.x)
             bx |= (1 << 0);
-        if (unk.y != unk_F64E20.y)
+        if (unk.y != gVehicleMotion.UnkF64E20.y)
             bx |= (1 << 1);
-        if (unk.z != unk_F64E20.z)
+        if (unk.z != gVehicleMotion.UnkF64E20.z)
             bx |= (1 << 2);
 
         remaining_distance -= dword_9A2930[bx];
-        unk_F64E20.x = unk.x;
-        unk_F64E20.y = unk.y;
-        unk_F64E20.z = unk.z;
+        gVehicleMotion.UnkF64E20.x = unk.x;
+        gVehicleMotion.UnkF64E20.y = unk.y;
+        gVehicleMotion.UnkF64E20.z = unk.z;
 
         sprite_direction = moveInfo->direction;
         bank_rotation = moveInfo->bank_rotation;
@@ -300,7 +300,7 @@ bool Vehicle::CableLiftUpdateTrackMotionBackwards()
     if (curRide == nullptr)
         return false;
 
-    for (; remaining_distance < 0; _vehicleUnkF64E10++)
+    for (; remaining_distance < 0; gVehicleMotion.UnkF64E10++)
     {
         uint16_t trackProgress = track_progress - 1;
 
@@ -324,7 +324,7 @@ bool Vehicle::CableLiftUpdateTrackMotionBackwards()
 
             if (output.begin_element->AsTrack()->GetTrackType() == TrackElemType::EndStation)
             {
-                _vehicleMotionTrackFlags = VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+                gVehicleMotion.TrackFlags = VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
             }
 
             uint16_t trackTotalProgress = GetTrackProgress();
@@ -336,17 +336,17 @@ bool Vehicle::CableLiftUpdateTrackMotionBackwards()
 
         uint8_t bx = 0;
         unk.z += RideTypeDescriptors[curRide->type].Heights.VehicleZOffset;
-        if (unk.x != unk_F64E20.x)
+        if (unk.x != gVehicleMotion.UnkF64E20.x)
             bx |= (1 << 0);
-        if (unk.y != unk_F64E20.y)
+        if (unk.y != gVehicleMotion.UnkF64E20.y)
             bx |= (1 << 1);
-        if (unk.z != unk_F64E20.z)
+        if (unk.z != gVehicleMotion.UnkF64E20.z)
             bx |= (1 << 2);
 
         remaining_distance += dword_9A2930[bx];
-        unk_F64E20.x = unk.x;
-        unk_F64E20.y = unk.y;
-        unk_F64E20.z = unk.z;
+        gVehicleMotion.UnkF64E20.x = unk.x;
+        gVehicleMotion.UnkF64E20.y = unk.y;
+        gVehicleMotion.UnkF64E20.z = unk.z;
 
         sprite_direction = moveInfo->direction;
         bank_rotation = moveInfo->bank_rotation;
@@ -366,14 +366,14 @@ bool Vehicle::CableLiftUpdateTrackMotionBackwards()
  */
 int32_t Vehicle::CableLiftUpdateTrackMotion()
 {
-    _vehicleF64E2C = 0;
-    gCurrentVehicle = this;
-    _vehicleMotionTrackFlags = 0;
-    _vehicleStationIndex = STATION_INDEX_NULL;
+    gVehicleMotion.F64E2C = 0;
+    gVehicleMotion.CurrentVehicle = this;
+    gVehicleMotion.TrackFlags = 0;
+    gVehicleMotion.Station = STATION_INDEX_NULL;
 
     velocity += acceleration;
-    _vehicleVelocityF64E08 = velocity;
-    _vehicleVelocityF64E0C = (velocity / 1024) * 42;
+    gVehicleMotion.VelocityF64E08 = velocity;
+    gVehicleMotion.VelocityF64E0C = (velocity / 1024) * 42;
 
     Vehicle* frontVehicle = this;
     if (velocity < 0)
@@ -381,19 +381,19 @@ int32_t Vehicle::CableLiftUpdateTrackMotion()
         frontVehicle = TrainTail();
     }
 
-    _vehicleFrontVehicle = frontVehicle;
+    gVehicleMotion.FrontVehicle = frontVehicle;
 
     for (Vehicle* vehicle = frontVehicle; vehicle != nullptr;)
     {
         vehicle->acceleration = dword_9A2970[vehicle->vehicle_sprite_type];
-        _vehicleUnkF64E10 = 1;
-        vehicle->remaining_distance += _vehicleVelocityF64E0C;
+        gVehicleMotion.UnkF64E10 = 1;
+        vehicle->remaining_distance += gVehicleMotion.VelocityF64E0C;
 
         if (vehicle->remaining_distance < 0 || vehicle->remaining_distance >= 13962)
         {
-            unk_F64E20.x = vehicle->x;
-            unk_F64E20.y = vehicle->y;
-            unk_F64E20.z = vehicle->z;
+            gVehicleMotion.UnkF64E20.x = vehicle->x;
+            gVehicleMotion.UnkF64E20.y = vehicle->y;
+            gVehicleMotion.UnkF64E20.z = vehicle->z;
             vehicle->Invalidate();
 
             while (true)
@@ -406,11 +406,11 @@ int32_t Vehicle::CableLiftUpdateTrackMotion()
                     }
                     else
                     {
-                        _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-                        _vehicleVelocityF64E0C -= vehicle->remaining_distance - 13962;
+                        gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+                        gVehicleMotion.VelocityF64E0C -= vehicle->remaining_distance - 13962;
                         vehicle->remaining_distance = 13962;
                         vehicle->acceleration += dword_9A2970[vehicle->vehicle_sprite_type];
-                        _vehicleUnkF64E10++;
+                        gVehicleMotion.UnkF64E10++;
                         continue;
                     }
                 }
@@ -422,20 +422,20 @@ int32_t Vehicle::CableLiftUpdateTrackMotion()
                     }
                     else
                     {
-                        _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-                        _vehicleVelocityF64E0C -= vehicle->remaining_distance + 1;
+                        gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+                        gVehicleMotion.VelocityF64E0C -= vehicle->remaining_distance + 1;
                         vehicle->remaining_distance = -1;
                         vehicle->acceleration += dword_9A2970[vehicle->vehicle_sprite_type];
-                        _vehicleUnkF64E10++;
+                        gVehicleMotion.UnkF64E10++;
                     }
                 }
             }
-            vehicle->MoveTo(unk_F64E20);
+            vehicle->MoveTo(gVehicleMotion.UnkF64E20);
 
             vehicle->Invalidate();
         }
-        vehicle->acceleration /= _vehicleUnkF64E10;
-        if (_vehicleVelocityF64E08 >= 0)
+        vehicle->acceleration /= gVehicleMotion.UnkF64E10;
+        if (gVehicleMotion.VelocityF64E08 >= 0)
         {
             vehicle = GetEntity<Vehicle>(vehicle->next_vehicle_on_train);
         }
@@ -473,5 +473,5 @@ int32_t Vehicle::CableLiftUpdateTrackMotion()
     newAcceleration -= edx / massTotal;
 
     acceleration = newAcceleration;
-    return _vehicleMotionTrackFlags;
+    return gVehicleMotion.TrackFlags;
 }
@@ -51,6 +51,7 @@
 #include "../world/Map.h"
 #include "../world/MapAnimation.h"
 #include "../world/Park.h"
+#include "../world/ParkAggregates.h"
 #include "../world/Scenery.h"
 #include "../world/Sprite.h"
 #include "CableLift.h"
@@ -477,17 +478,17 @@ bool ride_try_get_origin_element(const Ride* ride, CoordsXYE* output)
     return resultTileElement != nullptr;
 }
 
-/**
- *
- * rct2: 0x006C6096
- * Gets the next track block coordinates from the
- * coordinates of the first of element of a track block.
- * Use track_block_get_next if you are unsure if you are
- * on the first element of a track block
- */
-bool track_block_get_next_from_zero(
-    const CoordsXYZ& startPos, Ride* ride, uint8_t direction_start, CoordsXYE* output, int32_t* z, int32_t* direction,
-    bool isGhost)
+// The track walks below read the tiles of the snapshot instead of the map if one is given.
+static TileElement* track_get_first_element_at(const TileElementSnapshot* tiles, const CoordsXY& loc)
+{
+    if (tiles != nullptr)
+        return map_snapshot_get_first_element_at(*tiles, TileCoordsXY{ loc });
+    return map_get_first_element_at(loc);
+}
+
+static bool track_block_get_next_from_zero(
+    const TileElementSnapshot* tiles, const CoordsXYZ& startPos, Ride* ride, uint8_t direction_start, CoordsXYE* output,
+    int32_t* z, int32_t* direction, bool isGhost)
 {
     auto trackPos = startPos;
 
@@ -496,7 +497,7 @@ bool track_block_get_next_from_zero(
         trackPos += CoordsDirectionDelta[direction_start];
     }
 
-    TileElement* tileElement = map_get_first_element_at(trackPos);
+    TileElement* tileElement = track_get_first_element_at(tiles, trackPos);
     if (tileElement == nullptr)
     {
         output->element = nullptr;
@@ -555,9 +556,21 @@ bool track_block_get_next_from_zero(
 
 /**
  *
- *  rct2: 0x006C60C2
+ * rct2: 0x006C6096
+ * Gets the next track block coordinates from the
+ * coordinates of the first of element of a track block.
+ * Use track_block_get_next if you are unsure if you are
+ * on the first element of a track block
  */
-bool track_block_get_next(CoordsXYE* input, CoordsXYE* output, int32_t* z, int32_t* direction)
+bool track_block_get_next_from_zero(
+    const CoordsXYZ& startPos, Ride* ride, uint8_t direction_start, CoordsXYE* output, int32_t* z, int32_t* direction,
+    bool isGhost)
+{
+    return track_block_get_next_from_zero(nullptr, startPos, ride, direction_start, output, z, direction, isGhost);
+}
+
+static bool track_block_get_next(
+    const TileElementSnapshot* tiles, Ride* ride, CoordsXYE* input, CoordsXYE* output, int32_t* z, int32_t* direction)
 {
     if (input == nullptr || input->element == nullptr)
         return false;
@@ -566,9 +579,7 @@ bool track_block_get_next(CoordsXYE* input, CoordsXYE* output, int32_t* z, int32
     if (inputElement == nullptr)
         return false;
 
-    auto rideIndex = inputElement->GetRideIndex();
-    auto ride = get_ride(rideIndex);
-    if (ride == nullptr)
+    if (ride == nullptr || inputElement->GetRideIndex() != ride->id)
         return false;
 
     auto trackBlock = get_track_def_from_ride(ride, inputElement->GetTrackType());
@@ -599,19 +610,30 @@ bool track_block_get_next(CoordsXYE* input, CoordsXYE* output, int32_t* z, int32
     uint8_t directionStart = ((trackCoordinate->rotation_end + rotation) & TILE_ELEMENT_DIRECTION_MASK)
         | (trackCoordinate->rotation_end & TRACK_BLOCK_2);
 
-    return track_block_get_next_from_zero({ coords, OriginZ }, ride, directionStart, output, z, direction, false);
+    return track_block_get_next_from_zero(tiles, { coords, OriginZ }, ride, directionStart, output, z, direction, false);
 }
 
 /**
- * Returns the begin position / direction and end position / direction of the
- * track piece that proceeds the given location. Gets the previous track block
- * coordinates from the coordinates of the first of element of a track block.
- * Use track_block_get_previous if you are unsure if you are on the first
- * element of a track block
- *  rct2: 0x006C63D6
+ *
+ *  rct2: 0x006C60C2
  */
-bool track_block_get_previous_from_zero(
-    const CoordsXYZ& startPos, Ride* ride, uint8_t direction, track_begin_end* outTrackBeginEnd)
+bool track_block_get_next(CoordsXYE* input, CoordsXYE* output, int32_t* z, int32_t* direction)
+{
+    if (input == nullptr || input->element == nullptr || input->element->AsTrack() == nullptr)
+        return false;
+
+    auto ride = get_ride(input->element->AsTrack()->GetRideIndex());
+    return track_block_get_next(nullptr, ride, input, output, z, direction);
+}
+
+bool track_block_get_next(const TileElementSnapshot& tiles, Ride* ride, CoordsXYE* input, CoordsXYE* output)
+{
+    return track_block_get_next(&tiles, ride, input, output, nullptr, nullptr);
+}
+
+static bool track_block_get_previous_from_zero(
+    const TileElementSnapshot* tiles, const CoordsXYZ& startPos, Ride* ride, uint8_t direction,
+    track_begin_end* outTrackBeginEnd)
 {
     uint8_t directionStart = direction;
     direction = direction_reverse(direction);
@@ -622,7 +644,7 @@ bool track_block_get_previous_from_zero(
         trackPos += CoordsDirectionDelta[direction];
     }
 
-    TileElement* tileElement = map_get_first_element_at(trackPos);
+    TileElement* tileElement = track_get_first_element_at(tiles, trackPos);
     if (tileElement == nullptr)
     {
         outTrackBeginEnd->end_x = trackPos.x;
@@ -698,14 +720,21 @@ bool track_block_get_previous_from_zero(
 }
 
 /**
- *
- *  rct2: 0x006C6402
- *
- * @remarks outTrackBeginEnd.begin_x and outTrackBeginEnd.begin_y will be in the
- * higher two bytes of ecx and edx where as outTrackBeginEnd.end_x and
- * outTrackBeginEnd.end_y will be in the lower two bytes (cx and dx).
+ * Returns the begin position / direction and end position / direction of the
+ * track piece that proceeds the given location. Gets the previous track block
+ * coordinates from the coordinates of the first of element of a track block.
+ * Use track_block_get_previous if you are unsure if you are on the first
+ * element of a track block
+ *  rct2: 0x006C63D6
  */
-bool track_block_get_previous(const CoordsXYE& trackPos, track_begin_end* outTrackBeginEnd)
+bool track_block_get_previous_from_zero(
+    const CoordsXYZ& startPos, Ride* ride, uint8_t direction, track_begin_end* outTrackBeginEnd)
+{
+    return track_block_get_previous_from_zero(nullptr, startPos, ride, direction, outTrackBeginEnd);
+}
+
+static bool track_block_get_previous(
+    const TileElementSnapshot* tiles, Ride* ride, const CoordsXYE& trackPos, track_begin_end* outTrackBeginEnd)
 {
     if (trackPos.element == nullptr)
         return false;
@@ -714,9 +743,7 @@ bool track_block_get_previous(const CoordsXYE& trackPos, track_begin_end* outTra
     if (trackElement == nullptr)
         return false;
 
-    auto rideIndex = trackElement->GetRideIndex();
-    auto ride = get_ride(rideIndex);
-    if (ride == nullptr)
+    if (ride == nullptr || trackElement->GetRideIndex() != ride->id)
         return false;
 
     auto trackBlock = get_track_def_from_ride(ride, trackElement->GetTrackType());
@@ -742,7 +769,30 @@ bool track_block_get_previous(const CoordsXYE& trackPos, track_begin_end* outTra
     rotation = ((trackCoordinate->rotation_begin + rotation) & TILE_ELEMENT_DIRECTION_MASK)
         | (trackCoordinate->rotation_begin & TRACK_BLOCK_2);
 
-    return track_block_get_previous_from_zero({ coords, z }, ride, rotation, outTrackBeginEnd);
+    return track_block_get_previous_from_zero(tiles, { coords, z }, ride, rotation, outTrackBeginEnd);
+}
+
+/**
+ *
+ *  rct2: 0x006C6402
+ *
+ * @remarks outTrackBeginEnd.begin_x and outTrackBeginEnd.begin_y will be in the
+ * higher two bytes of ecx and edx where as outTrackBeginEnd.end_x and
+ * outTrackBeginEnd.end_y will be in the lower two bytes (cx and dx).
+ */
+bool track_block_get_previous(const CoordsXYE& trackPos, track_begin_end* outTrackBeginEnd)
+{
+    if (trackPos.element == nullptr || trackPos.element->AsTrack() == nullptr)
+        return false;
+
+    auto ride = get_ride(trackPos.element->AsTrack()->GetRideIndex());
+    return track_block_get_previous(nullptr, ride, trackPos, outTrackBeginEnd);
+}
+
+bool track_block_get_previous(
+    const TileElementSnapshot& tiles, Ride* ride, const CoordsXYE& trackPos, track_begin_end* outTrackBeginEnd)
+{
+    return track_block_get_previous(&tiles, ride, trackPos, outTrackBeginEnd);
 }
 
 /**
@@ -1148,10 +1198,12 @@ void ride_remove_peeps(Ride* ride)
             }
 
             peep->State = PeepState::Falling;
+            sprite_checksum_invalidate(peep);
             peep->SwitchToSpecialSprite(0);
 
             peep->Happiness = std::min(peep->Happiness, peep->HappinessTarget) / 2;
             peep->HappinessTarget = peep->Happiness;
+            park_aggregates_update_guest(peep);
             peep->WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_STATS;
         }
     }
@@ -1163,9 +1215,9 @@ void ride_remove_peeps(Ride* ride)
 
 void ride_clear_blocked_tiles(Ride* ride)
 {
-    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    for (int32_t y = 0; y < gMapSizeTechnical; y++)
     {
-        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        for (int32_t x = 0; x < gMapSizeTechnical; x++)
         {
             auto element = map_get_first_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
             if (element != nullptr)
@@ -5778,6 +5830,93 @@ void increment_turn_count_4_plus_elements(Ride* ride, uint8_t type)
     *turn_count |= value;
 }
 
+void ride_measure_turns(Ride* ride, uint16_t trackFlags)
+{
+    uint32_t testingFlags = ride->testing_flags;
+    if (testingFlags & RIDE_TESTING_TURN_LEFT && trackFlags & TRACK_ELEM_FLAG_TURN_LEFT)
+    {
+        // 0x800 as this is masked to CURRENT_TURN_COUNT_MASK
+        ride->turn_count_default += 0x800;
+    }
+    else if (testingFlags & RIDE_TESTING_TURN_RIGHT && trackFlags & TRACK_ELEM_FLAG_TURN_RIGHT)
+    {
+        // 0x800 as this is masked to CURRENT_TURN_COUNT_MASK
+        ride->turn_count_default += 0x800;
+    }
+    else if (testingFlags & RIDE_TESTING_TURN_RIGHT || testingFlags & RIDE_TESTING_TURN_LEFT)
+    {
+        ride->testing_flags &= ~(
+            RIDE_TESTING_TURN_LEFT | RIDE_TESTING_TURN_RIGHT | RIDE_TESTING_TURN_BANKED | RIDE_TESTING_TURN_SLOPED);
+
+        uint8_t turnType = 1;
+        if (!(testingFlags & RIDE_TESTING_TURN_BANKED))
+        {
+            turnType = 2;
+            if (!(testingFlags & RIDE_TESTING_TURN_SLOPED))
+            {
+                turnType = 0;
+            }
+        }
+        switch (ride->turn_count_default >> 11)
+        {
+            case 0:
+                increment_turn_count_1_element(ride, turnType);
+                break;
+            case 1:
+                increment_turn_count_2_elements(ride, turnType);
+                break;
+            case 2:
+                increment_turn_count_3_elements(ride, turnType);
+                break;
+            default:
+                increment_turn_count_4_plus_elements(ride, turnType);
+                break;
+        }
+    }
+    else
+    {
+        if (trackFlags & TRACK_ELEM_FLAG_TURN_LEFT)
+        {
+            ride->testing_flags |= RIDE_TESTING_TURN_LEFT;
+            ride->turn_count_default &= ~CURRENT_TURN_COUNT_MASK;
+
+            if (trackFlags & TRACK_ELEM_FLAG_TURN_BANKED)
+            {
+                ride->testing_flags |= RIDE_TESTING_TURN_BANKED;
+            }
+            if (trackFlags & TRACK_ELEM_FLAG_TURN_SLOPED)
+            {
+                ride->testing_flags |= RIDE_TESTING_TURN_SLOPED;
+            }
+        }
+
+        if (trackFlags & TRACK_ELEM_FLAG_TURN_RIGHT)
+        {
+            ride->testing_flags |= RIDE_TESTING_TURN_RIGHT;
+            ride->turn_count_default &= ~CURRENT_TURN_COUNT_MASK;
+
+            if (trackFlags & TRACK_ELEM_FLAG_TURN_BANKED)
+            {
+                ride->testing_flags |= RIDE_TESTING_TURN_BANKED;
+            }
+            if (trackFlags & TRACK_ELEM_FLAG_TURN_SLOPED)
+            {
+                ride->testing_flags |= RIDE_TESTING_TURN_SLOPED;
+            }
+        }
+    }
+
+    if (trackFlags & TRACK_ELEM_FLAG_HELIX)
+    {
+        uint8_t helixes = ride_get_helix_sections(ride);
+        if (helixes != MAX_HELICES)
+            helixes++;
+
+        ride->special_track_elements &= ~0x1F;
+        ride->special_track_elements |= helixes;
+    }
+}
+
 int32_t get_turn_count_1_element(Ride* ride, uint8_t type)
 {
     uint16_t* turn_count;
@@ -7489,9 +7628,9 @@ void determine_ride_entrance_and_exit_locations()
             // Search the map to find it. Skip the outer ring of invisible tiles.
             bool alreadyFoundEntrance = false;
             bool alreadyFoundExit = false;
-            for (uint8_t x = 1; x < MAXIMUM_MAP_SIZE_TECHNICAL - 1; x++)
+            for (int32_t x = 1; x < gMapSizeTechnical - 1; x++)
             {
-                for (uint8_t y = 1; y < MAXIMUM_MAP_SIZE_TECHNICAL - 1; y++)
+                for (int32_t y = 1; y < gMapSizeTechnical - 1; y++)
                 {
                     TileElement* tileElement = map_get_first_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
 
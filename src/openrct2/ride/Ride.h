@@ -1163,6 +1163,11 @@ void increment_turn_count_1_element(Ride* ride, uint8_t type);
 void increment_turn_count_2_elements(Ride* ride, uint8_t type);
 void increment_turn_count_3_elements(Ride* ride, uint8_t type);
 void increment_turn_count_4_plus_elements(Ride* ride, uint8_t type);
+/**
+ * Counts the turn and helix sections of a ride test, the track flags are the ones of each track piece in the order the
+ * train travels them.
+ */
+void ride_measure_turns(Ride* ride, uint16_t trackFlags);
 int32_t get_turn_count_1_element(Ride* ride, uint8_t type);
 int32_t get_turn_count_2_elements(Ride* ride, uint8_t type);
 int32_t get_turn_count_3_elements(Ride* ride, uint8_t type);
@@ -1184,6 +1189,14 @@ bool track_block_get_previous(const CoordsXYE& trackPos, track_begin_end* outTra
 bool track_block_get_previous_from_zero(
     const CoordsXYZ& startPos, Ride* ride, uint8_t direction, track_begin_end* outTrackBeginEnd);
 
+/**
+ * Walk the track of the given ride on the tiles of the snapshot instead of the map, the track element must belong to the
+ * ride.
+ */
+bool track_block_get_next(const TileElementSnapshot& tiles, Ride* ride, CoordsXYE* input, CoordsXYE* output);
+bool track_block_get_previous(
+    const TileElementSnapshot& tiles, Ride* ride, const CoordsXYE& trackPos, track_begin_end* outTrackBeginEnd);
+
 void ride_get_start_of_track(CoordsXYE* output);
 
 void window_ride_construction_update_active_elements();
@@ -0,0 +1,508 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "RideRatingService.h"
+
+#include "../core/JobPool.h"
+#include "../localisation/Date.h"
+#include "../object/Object.h"
+#include "../rct12/RCT12.h"
+#include "../world/Surface.h"
+#include "RideData.h"
+#include "Track.h"
+#include "TrackData.h"
+#include "TrackDesign.h"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
+// The scenery score counts the scenery up to this many tiles away from the station, the proximity scores only look at
+// the tiles next to the track.
+static constexpr int32_t SceneryScoreRadius = 5;
+static constexpr int32_t ProximityRadius = 1;
+
+// Designs are built in the middle of a map of their own, on flat land at the height new maps start with.
+static constexpr int32_t DesignOriginTile = MAXIMUM_MAP_SIZE_TECHNICAL / 2;
+static constexpr int32_t DesignLandHeight = 14;
+
+static std::unique_ptr<JobPool> _ratingJobs;
+
+using RatingTileSet = std::unordered_set<uint32_t>;
+
+static void ride_rating_add_area(RatingTileSet& tiles, const TileCoordsXY& centre, int32_t radius)
+{
+    for (int32_t y = std::max(centre.y - radius, 0); y <= std::min(centre.y + radius, MAXIMUM_MAP_SIZE_EXTENDED - 1); y++)
+    {
+        for (int32_t x = std::max(centre.x - radius, 0); x <= std::min(centre.x + radius, MAXIMUM_MAP_SIZE_EXTENDED - 1); x++)
+        {
+            tiles.insert(static_cast<uint32_t>(y * MAXIMUM_MAP_SIZE_EXTENDED + x));
+        }
+    }
+}
+
+static void ride_rating_add_station_areas(RatingTileSet& tiles, const Ride& ride)
+{
+    for (const auto& station : ride.stations)
+    {
+        if (!station.Start.isNull())
+        {
+            ride_rating_add_area(tiles, TileCoordsXY{ station.Start }, SceneryScoreRadius);
+        }
+    }
+    if (ride.type == RIDE_TYPE_MAZE && !ride.stations[0].Entrance.isNull())
+    {
+        auto entrance = TileCoordsXY{ ride.stations[0].Entrance.x, ride.stations[0].Entrance.y };
+        ride_rating_add_area(tiles, entrance, SceneryScoreRadius);
+    }
+}
+
+/**
+ * Copies what the rating calculation reads, the measurements of the last test and the ride settings.
+ */
+static void ride_rating_copy_inputs(const Ride& ride, Ride& snapshot)
+{
+    snapshot.id = ride.id;
+    snapshot.type = ride.type;
+    snapshot.subtype = ride.subtype;
+    snapshot.mode = ride.mode;
+    snapshot.status = ride.status;
+    snapshot.depart_flags = ride.depart_flags;
+    snapshot.num_stations = ride.num_stations;
+    snapshot.num_vehicles = ride.num_vehicles;
+    snapshot.num_cars_per_train = ride.num_cars_per_train;
+    snapshot.min_waiting_time = ride.min_waiting_time;
+    snapshot.max_waiting_time = ride.max_waiting_time;
+    snapshot.operation_option = ride.operation_option;
+    snapshot.special_track_elements = ride.special_track_elements;
+    snapshot.max_speed = ride.max_speed;
+    snapshot.average_speed = ride.average_speed;
+    snapshot.max_positive_vertical_g = ride.max_positive_vertical_g;
+    snapshot.max_negative_vertical_g = ride.max_negative_vertical_g;
+    snapshot.max_lateral_g = ride.max_lateral_g;
+    snapshot.turn_count_default = ride.turn_count_default;
+    snapshot.turn_count_banked = ride.turn_count_banked;
+    snapshot.turn_count_sloped = ride.turn_count_sloped;
+    snapshot.drops = ride.drops;
+    snapshot.highest_drop_height = ride.highest_drop_height;
+    snapshot.sheltered_length = ride.sheltered_length;
+    snapshot.var_11C = ride.var_11C;
+    snapshot.num_sheltered_sections = ride.num_sheltered_sections;
+    snapshot.maze_tiles = ride.maze_tiles;
+    snapshot.build_date = ride.build_date;
+    snapshot.upkeep_cost = ride.upkeep_cost;
+    snapshot.lift_hill_speed = ride.lift_hill_speed;
+    snapshot.lifecycle_flags = ride.lifecycle_flags;
+    snapshot.total_air_time = ride.total_air_time;
+    snapshot.num_circuits = ride.num_circuits;
+    std::copy(std::begin(ride.stations), std::end(ride.stations), std::begin(snapshot.stations));
+    snapshot.inversions = ride.inversions;
+    snapshot.holes = ride.holes;
+    snapshot.sheltered_eighths = ride.sheltered_eighths;
+    snapshot.ratings = { RIDE_RATING_UNDEFINED, RIDE_RATING_UNDEFINED, RIDE_RATING_UNDEFINED };
+}
+
+std::vector<RideRatingRequest> ride_rating_requests_create(const std::vector<ride_id_t>& rideIds)
+{
+    std::vector<RideRatingRequest> requests;
+    std::unordered_map<ride_id_t, size_t> requestIndices;
+    for (auto rideId : rideIds)
+    {
+        auto ride = get_ride(rideId);
+        if (ride == nullptr || ride->status == RIDE_STATUS_CLOSED || requestIndices.count(rideId) != 0)
+            continue;
+
+        RideRatingRequest request;
+        request.RideSnapshot = std::make_unique<Ride>();
+        ride_rating_copy_inputs(*ride, *request.RideSnapshot);
+        requestIndices.emplace(rideId, requests.size());
+        requests.push_back(std::move(request));
+    }
+    if (requests.empty())
+        return requests;
+
+    std::vector<RatingTileSet> rideTiles(requests.size());
+    tile_element_iterator it;
+    tile_element_iterator_begin(&it);
+    do
+    {
+        if (it.element->GetType() != TILE_ELEMENT_TYPE_TRACK)
+            continue;
+
+        auto found = requestIndices.find(it.element->AsTrack()->GetRideIndex());
+        if (found != requestIndices.end())
+        {
+            ride_rating_add_area(rideTiles[found->second], { it.x, it.y }, ProximityRadius);
+        }
+    } while (tile_element_iterator_next(&it));
+
+    for (size_t i = 0; i < requests.size(); i++)
+    {
+        auto& request = requests[i];
+        auto& tiles = rideTiles[i];
+        ride_rating_add_station_areas(tiles, *request.RideSnapshot);
+        for (auto key : tiles)
+        {
+            auto tilePos = TileCoordsXY{ static_cast<int32_t>(key % MAXIMUM_MAP_SIZE_EXTENDED),
+                                         static_cast<int32_t>(key / MAXIMUM_MAP_SIZE_EXTENDED) };
+            map_snapshot_add_tile(request.Tiles, tilePos);
+        }
+    }
+    return requests;
+}
+
+/**
+ * Calls func for every track piece of the design with its type, position and direction, as track_design_place_ride
+ * lays them out.
+ */
+template<typename TFunc> static void ride_rating_design_walk(const TrackDesign& td, const CoordsXYZ& origin, TFunc func)
+{
+    auto newCoords = origin;
+    uint8_t rotation = 0;
+    for (const auto& track : td.track_elements)
+    {
+        auto trackType = track.type;
+        if (trackType == TrackElemType::InvertedUp90ToFlatQuarterLoopAlias)
+        {
+            trackType = TrackElemType::MultiDimInvertedUp90ToFlatQuarterLoop;
+        }
+
+        func(track, trackType, newCoords, rotation);
+
+        const rct_track_coordinates* trackCoordinates = &TrackCoordinates[trackType];
+        auto offsetAndRotatedTrack = CoordsXY{ newCoords }
+            + CoordsXY{ trackCoordinates->x, trackCoordinates->y }.Rotate(rotation);
+
+        newCoords = { offsetAndRotatedTrack, newCoords.z - trackCoordinates->z_begin + trackCoordinates->z_end };
+        rotation = (rotation + trackCoordinates->rotation_end - trackCoordinates->rotation_begin) & 3;
+        if (trackCoordinates->rotation_end & (1 << 2))
+        {
+            rotation |= (1 << 2);
+        }
+        else
+        {
+            newCoords += CoordsDirectionDelta[rotation];
+        }
+    }
+}
+
+/**
+ * What the vehicles note of the special track pieces during a test, a water splash is assumed to be fast enough.
+ */
+static void ride_rating_design_measure_special_element(Ride& ride, track_type_t trackType)
+{
+    if (ride.type == RIDE_TYPE_WATER_COASTER && trackType >= TrackElemType::FlatCovered
+        && trackType <= TrackElemType::RightQuarterTurn3TilesCovered)
+    {
+        ride.special_track_elements |= RIDE_ELEMENT_TUNNEL_SPLASH_OR_RAPIDS;
+    }
+
+    switch (trackType)
+    {
+        case TrackElemType::Rapids:
+        case TrackElemType::SpinningTunnel:
+        case TrackElemType::Watersplash:
+            ride.special_track_elements |= RIDE_ELEMENT_TUNNEL_SPLASH_OR_RAPIDS;
+            break;
+        case TrackElemType::Waterfall:
+        case TrackElemType::LogFlumeReverser:
+            ride.special_track_elements |= RIDE_ELEMENT_REVERSER_OR_WATERFALL;
+            break;
+        case TrackElemType::Whirlpool:
+            ride.special_track_elements |= RIDE_ELEMENT_WHIRLPOOL;
+            break;
+    }
+}
+
+using RatingDesignTiles = std::unordered_map<uint32_t, std::vector<TileElement>>;
+
+static void ride_rating_design_add_element(RatingDesignTiles& tiles, const TileCoordsXY& tilePos, const TileElement& element)
+{
+    auto key = static_cast<uint32_t>(tilePos.y * MAXIMUM_MAP_SIZE_EXTENDED + tilePos.x);
+    tiles[key].push_back(element);
+}
+
+static void ride_rating_design_place_track(const TrackDesign& td, Ride& ride, RatingDesignTiles& tiles)
+{
+    const rct_preview_track** trackBlockArray = ride_type_has_flag(td.type, RIDE_TYPE_FLAG_HAS_TRACK) ? TrackBlocks
+                                                                                                      : FlatRideTrackBlocks;
+    const auto& heights = RideTypeDescriptors[td.type].Heights;
+    auto origin = CoordsXYZ{ TileCoordsXY{ DesignOriginTile, DesignOriginTile }.ToCoordsXY(), 0 };
+
+    // Move the track up or down so its lowest block sits on the land.
+    int32_t lowestZ = std::numeric_limits<int32_t>::max();
+    ride_rating_design_walk(
+        td, origin, [&](const TrackDesignTrackElement&, track_type_t trackType, const CoordsXYZ& pos, uint8_t) {
+            for (const rct_preview_track* trackBlock = trackBlockArray[trackType]; trackBlock->index != 0xFF; trackBlock++)
+            {
+                lowestZ = std::min<int32_t>(lowestZ, pos.z - TrackCoordinates[trackType].z_begin + trackBlock->z);
+            }
+        });
+    if (lowestZ == std::numeric_limits<int32_t>::max())
+        return;
+    origin.z = floor2(DesignLandHeight * COORDS_Z_STEP - lowestZ + COORDS_Z_STEP - 1, COORDS_Z_STEP);
+
+    uint8_t numStations = 0;
+    bool hasEndStation = false;
+    ride_rating_design_walk(
+        td, origin,
+        [&](const TrackDesignTrackElement& track, track_type_t trackType, const CoordsXYZ& pos, uint8_t rotation) {
+            for (const rct_preview_track* trackBlock = trackBlockArray[trackType]; trackBlock->index != 0xFF; trackBlock++)
+            {
+                auto blockPos = CoordsXY{ pos } + CoordsXY{ trackBlock->x, trackBlock->y }.Rotate(rotation);
+                int32_t baseZ = floor2(pos.z - TrackCoordinates[trackType].z_begin + trackBlock->z, COORDS_Z_STEP);
+                int32_t clearanceZ = trackBlock->var_07;
+                if (trackBlock->flags & RCT_PREVIEW_TRACK_FLAG_IS_VERTICAL && heights.ClearanceHeight > 24)
+                {
+                    clearanceZ += 24;
+                }
+                else
+                {
+                    clearanceZ += heights.ClearanceHeight;
+                }
+                clearanceZ = floor2(clearanceZ, COORDS_Z_STEP) + baseZ;
+
+                TileElement element{};
+                element.ClearAs(TILE_ELEMENT_TYPE_TRACK);
+                element.SetBaseZ(baseZ);
+                element.SetClearanceZ(clearanceZ);
+                element.SetDirection(rotation & 3);
+                element.SetOccupiedQuadrants(trackBlock->var_08.Rotate(rotation & 3).GetBaseQuarterOccupied());
+
+                auto trackElement = element.AsTrack();
+                trackElement->SetTrackType(trackType);
+                trackElement->SetSequenceIndex(trackBlock->index);
+                trackElement->SetRideIndex(ride.id);
+                trackElement->SetColourScheme((track.flags >> 4) & 0x3);
+                trackElement->SetHasChain(track.flags & RCT12_TRACK_ELEMENT_TYPE_FLAG_CHAIN_LIFT);
+                trackElement->SetInverted(track.flags & TD6_TRACK_ELEMENT_FLAG_INVERTED);
+                if (TrackTypeHasSpeedSetting(trackType))
+                {
+                    trackElement->SetBrakeBoosterSpeed((track.flags & 0x0F) * 2);
+                }
+                else
+                {
+                    trackElement->SetSeatRotation(track.flags & 0x0F);
+                }
+
+                // The whole design is one station, the ratings only need to find the station the track starts from.
+                if (track_type_is_station(trackType))
+                {
+                    trackElement->SetStationIndex(0);
+                    if (trackBlock->index == 0 && (ride.stations[0].Start.isNull() || !hasEndStation))
+                    {
+                        ride.stations[0].Start = blockPos;
+                        ride.stations[0].Height = baseZ / COORDS_Z_STEP;
+                        hasEndStation = trackType == TrackElemType::EndStation;
+                    }
+                }
+                ride_rating_design_add_element(tiles, TileCoordsXY{ blockPos }, element);
+            }
+
+            if (trackType == TrackElemType::BeginStation && numStations < MAX_STATIONS)
+            {
+                numStations++;
+            }
+            ride_measure_turns(&ride, TrackFlags[trackType]);
+            ride_rating_design_measure_special_element(ride, trackType);
+        });
+
+    // The train runs back into the station, that ends a turn that is still being counted.
+    ride_measure_turns(&ride, 0);
+    ride.num_stations = std::max<uint8_t>(numStations, 1);
+
+    for (const auto& entrance : td.entrance_elements)
+    {
+        auto entrancePos = TileCoordsXYZD{ CoordsXY{ origin } + CoordsXY{ entrance.x, entrance.y },
+                                           origin.z / COORDS_Z_STEP + entrance.z, entrance.direction };
+        auto& location = entrance.isExit ? ride.stations[0].Exit : ride.stations[0].Entrance;
+        if (location.isNull())
+        {
+            location = entrancePos;
+        }
+    }
+}
+
+static void ride_rating_design_place_maze(const TrackDesign& td, Ride& ride, RatingDesignTiles& tiles)
+{
+    const auto& heights = RideTypeDescriptors[td.type].Heights;
+    for (const auto& mazeElement : td.maze_elements)
+    {
+        auto tilePos = TileCoordsXY{ DesignOriginTile + mazeElement.x, DesignOriginTile + mazeElement.y };
+        switch (mazeElement.type)
+        {
+            case MAZE_ELEMENT_TYPE_ENTRANCE:
+                ride.stations[0].Entrance = TileCoordsXYZD{ tilePos, DesignLandHeight, mazeElement.direction };
+                break;
+            case MAZE_ELEMENT_TYPE_EXIT:
+                ride.stations[0].Exit = TileCoordsXYZD{ tilePos, DesignLandHeight, mazeElement.direction };
+                break;
+            default:
+            {
+                TileElement element{};
+                element.ClearAs(TILE_ELEMENT_TYPE_TRACK);
+                element.SetBaseZ(DesignLandHeight * COORDS_Z_STEP);
+                element.SetClearanceZ((DesignLandHeight * COORDS_Z_STEP) + heights.ClearanceHeight);
+                element.SetOccupiedQuadrants(0xF);
+
+                auto trackElement = element.AsTrack();
+                trackElement->SetTrackType(TrackElemType::Maze);
+                trackElement->SetRideIndex(ride.id);
+                trackElement->SetMazeEntry(mazeElement.maze_entry);
+                ride_rating_design_add_element(tiles, tilePos, element);
+
+                if (ride.stations[0].Start.isNull())
+                {
+                    ride.stations[0].Start = tilePos.ToCoordsXY();
+                    ride.stations[0].Height = DesignLandHeight;
+                }
+                if (ride.maze_tiles != std::numeric_limits<uint16_t>::max())
+                {
+                    ride.maze_tiles++;
+                }
+                break;
+            }
+        }
+    }
+    ride.num_stations = 1;
+}
+
+RideRatingRequest ride_rating_request_create(const TrackDesign& td)
+{
+    RideRatingRequest request;
+    request.RideSnapshot = std::make_unique<Ride>();
+    auto& ride = *request.RideSnapshot;
+    if (td.type >= RIDE_TYPE_COUNT)
+        return request;
+
+    ObjectType entryType;
+    ObjectEntryIndex entryIndex;
+    if (!find_object_in_entry_group(&td.vehicle_object, &entryType, &entryIndex))
+    {
+        entryIndex = RIDE_ENTRY_INDEX_NULL;
+    }
+
+    ride.id = 0;
+    ride.type = td.type;
+    ride.subtype = entryIndex;
+    ride.mode = td.ride_mode;
+    ride.status = RIDE_STATUS_OPEN;
+    ride.lifecycle_flags = RIDE_LIFECYCLE_TESTED;
+    ride.build_date = gDateMonthsElapsed;
+    ride.depart_flags = td.depart_flags;
+    ride.num_vehicles = td.number_of_trains;
+    ride.num_cars_per_train = td.number_of_cars_per_train;
+    ride.min_waiting_time = td.min_waiting_time;
+    ride.max_waiting_time = td.max_waiting_time;
+    ride.operation_option = td.operation_setting;
+    ride.lift_hill_speed = td.lift_hill_speed;
+    ride.num_circuits = td.num_circuits;
+    ride.ratings = { RIDE_RATING_UNDEFINED, RIDE_RATING_UNDEFINED, RIDE_RATING_UNDEFINED };
+    for (auto& station : ride.stations)
+    {
+        station.Start.setNull();
+        station.Entrance.setNull();
+        station.Exit.setNull();
+    }
+
+    // The statistics are stored in coarser units than the vehicles measure them in, see TrackDesign::CreateTrackDesign.
+    ride.max_speed = td.max_speed * 65536;
+    ride.average_speed = td.average_speed * 65536;
+    ride.max_positive_vertical_g = td.max_positive_vertical_g * 32;
+    ride.max_negative_vertical_g = td.max_negative_vertical_g * 32;
+    ride.max_lateral_g = td.max_lateral_g * 32;
+    ride.inversions = td.inversions & 0x1F;
+    ride.sheltered_eighths = td.inversions >> 5;
+    ride.holes = td.holes;
+    ride.drops = td.drops;
+    ride.highest_drop_height = td.highest_drop_height;
+    ride.total_air_time = td.total_air_time * 1024 / 123;
+
+    // Only the length and the average speed are saved, the time a train takes follows from them. A segment time unit
+    // is 32 ticks in which a train at speed v travels v * 42 / 1024 length units per tick.
+    int32_t rideLength = std::min<int32_t>(td.ride_length, std::numeric_limits<int16_t>::max());
+    ride.stations[0].SegmentLength = rideLength << 16;
+    if (td.average_speed > 0)
+    {
+        ride.stations[0].SegmentTime = static_cast<uint16_t>(
+            std::min<int32_t>((rideLength * 32) / (td.average_speed * 42), std::numeric_limits<uint16_t>::max()));
+    }
+    ride.sheltered_length = (ride.stations[0].SegmentLength / 8) * std::min<uint8_t>(ride.sheltered_eighths, 7);
+
+    RatingDesignTiles tiles;
+    if (td.type == RIDE_TYPE_MAZE)
+    {
+        ride_rating_design_place_maze(td, ride, tiles);
+    }
+    else
+    {
+        ride_rating_design_place_track(td, ride, tiles);
+    }
+
+    // Every tile that is read gets the land, tiles without it read as outside of the map.
+    RatingTileSet landTiles;
+    for (const auto& tile : tiles)
+    {
+        auto tilePos = TileCoordsXY{ static_cast<int32_t>(tile.first % MAXIMUM_MAP_SIZE_EXTENDED),
+                                     static_cast<int32_t>(tile.first / MAXIMUM_MAP_SIZE_EXTENDED) };
+        ride_rating_add_area(landTiles, tilePos, ProximityRadius);
+    }
+    ride_rating_add_station_areas(landTiles, ride);
+
+    for (auto key : landTiles)
+    {
+        TileElement surface{};
+        surface.ClearAs(TILE_ELEMENT_TYPE_SURFACE);
+        surface.base_height = DesignLandHeight;
+        surface.clearance_height = DesignLandHeight;
+        surface.AsSurface()->SetSlope(TILE_ELEMENT_SLOPE_FLAT);
+        surface.AsSurface()->SetSurfaceStyle(TERRAIN_GRASS);
+        surface.AsSurface()->SetEdgeStyle(TERRAIN_EDGE_ROCK);
+
+        std::vector<TileElement> elements{ surface };
+        auto found = tiles.find(key);
+        if (found != tiles.end())
+        {
+            elements.insert(elements.end(), found->second.begin(), found->second.end());
+        }
+        elements.back().SetLastForTile(true);
+
+        auto tilePos = TileCoordsXY{ static_cast<int32_t>(key % MAXIMUM_MAP_SIZE_EXTENDED),
+                                     static_cast<int32_t>(key / MAXIMUM_MAP_SIZE_EXTENDED) };
+        map_snapshot_add_tile(request.Tiles, tilePos, elements);
+    }
+    return request;
+}
+
+void ride_rating_request_run(RideRatingRequest& request)
+{
+    if (request.RideSnapshot == nullptr || request.RideSnapshot->type >= RIDE_TYPE_COUNT)
+        return;
+
+    auto& ride = *request.RideSnapshot;
+    RideRatingCalculationData data{};
+    data.Tiles = &request.Tiles;
+
+    // The proximity walks visit every track element once in each direction, the other states run once.
+    auto maxSteps = static_cast<uint32_t>(request.Tiles.Elements.size() * 2 + 16);
+    request.Rated = ride_ratings_calculate_ride(ride, data, maxSteps);
+
+    request.Ratings = ride.ratings;
+    request.UpkeepCost = ride.upkeep_cost;
+}
+
+void ride_ratings_rate_batch(std::vector<RideRatingRequest>& requests)
+{
+    if (_ratingJobs == nullptr)
+    {
+        _ratingJobs = std::make_unique<JobPool>();
+    }
+    _ratingJobs->ParallelFor(requests.size(), [&requests](size_t i) { ride_rating_request_run(requests[i]); });
+}
@@ -0,0 +1,56 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../world/Map.h"
+#include "Ride.h"
+#include "RideRatings.h"
+
+#include <memory>
+#include <vector>
+
+struct TrackDesign;
+
+/**
+ * A ride to rate away from the game state, with a copy of its rating inputs and of the tiles the calculation reads.
+ * The game is not changed by rating it, the results are only stored in the request.
+ */
+struct RideRatingRequest
+{
+    std::unique_ptr<Ride> RideSnapshot;
+    TileElementSnapshot Tiles;
+
+    bool Rated = false;
+    RatingTuple Ratings = { RIDE_RATING_UNDEFINED, RIDE_RATING_UNDEFINED, RIDE_RATING_UNDEFINED };
+    money16 UpkeepCost = MONEY16_UNDEFINED;
+};
+
+/**
+ * Copies the given rides of the park and the tiles around their track with a single scan of the map. Must be called
+ * on the main thread. Rides that do not exist are left out, as are closed rides which the game does not rate either.
+ */
+std::vector<RideRatingRequest> ride_rating_requests_create(const std::vector<ride_id_t>& rideIds);
+
+/**
+ * Builds the ride of the design on a flat piece of land of its own. The statistics the vehicles measure are taken from
+ * the ones stored in the design, so the result is an estimate. The vehicle object of the design has to be loaded.
+ */
+RideRatingRequest ride_rating_request_create(const TrackDesign& td);
+
+/**
+ * Rates the request on the calling thread, any thread can rate a different request at the same time.
+ */
+void ride_rating_request_run(RideRatingRequest& request);
+
+/**
+ * Rates all requests on worker threads and returns once they are done.
+ */
+void ride_ratings_rate_batch(std::vector<RideRatingRequest>& requests);
@@ -67,9 +67,7 @@ using namespace OpenRCT2::Drawing;
 
 struct map_backup
 {
-    TileElement tile_elements[MAX_TILE_ELEMENTS];
-    TileElement* tile_pointers[MAX_TILE_TILE_ELEMENT_POINTERS];
-    TileElement* next_free_tile_element;
+    TileElementStorage tile_storage;
     uint16_t map_size_units;
     uint16_t map_size_units_minus_2;
     uint16_t map_size;
@@ -363,9 +361,9 @@ rct_string_id TrackDesign::CreateTrackDesignMaze(const Ride& ride)
     // x is defined here as we can start the search
     // on tile start_x, start_y but then the next row
     // must restart on 0
-    for (int32_t y = startLoc.y, x = startLoc.x; y < MAXIMUM_MAP_SIZE_BIG; y += COORDS_XY_STEP)
+    for (int32_t y = startLoc.y, x = startLoc.x; y < map_get_size_big(); y += COORDS_XY_STEP)
     {
-        for (; x < MAXIMUM_MAP_SIZE_BIG; x += COORDS_XY_STEP)
+        for (; x < map_get_size_big(); x += COORDS_XY_STEP)
         {
             auto tileElement = map_get_first_element_at({ x, y });
             do
@@ -469,9 +467,9 @@ rct_string_id TrackDesign::CreateTrackDesignMaze(const Ride& ride)
 CoordsXYE TrackDesign::MazeGetFirstElement(const Ride& ride)
 {
     CoordsXYE tile{};
-    for (tile.y = 0; tile.y < MAXIMUM_MAP_SIZE_BIG; tile.y += COORDS_XY_STEP)
+    for (tile.y = 0; tile.y < map_get_size_big(); tile.y += COORDS_XY_STEP)
     {
-        for (tile.x = 0; tile.x < MAXIMUM_MAP_SIZE_BIG; tile.x += COORDS_XY_STEP)
+        for (tile.x = 0; tile.x < map_get_size_big(); tile.x += COORDS_XY_STEP)
         {
             tile.element = map_get_first_element_at({ tile.x, tile.y });
             do
@@ -2102,7 +2100,7 @@ void track_design_draw_preview(TrackDesign* td6, uint8_t* pixels)
 
 /**
  * Create a backup of the map as it will be cleared for drawing the track
- * design preview.
+ * design preview. The tile storage is moved into the backup rather than copied.
  *  rct2: 0x006D1C68
  */
 static std::unique_ptr<map_backup> track_design_preview_backup_map()
@@ -2110,9 +2108,7 @@ static std::unique_ptr<map_backup> track_design_preview_backup_map()
     auto backup = std::make_unique<map_backup>();
     if (backup != nullptr)
     {
-        std::memcpy(backup->tile_elements, gTileElements, sizeof(backup->tile_elements));
-        std::memcpy(backup->tile_pointers, gTileElementTilePointers, sizeof(backup->tile_pointers));
-        backup->next_free_tile_element = gNextFreeTileElement;
+        map_swap_storage(backup->tile_storage);
         backup->map_size_units = gMapSizeUnits;
         backup->map_size_units_minus_2 = gMapSizeMinus2;
         backup->map_size = gMapSize;
@@ -2127,9 +2123,7 @@ static std::unique_ptr<map_backup> track_design_preview_backup_map()
  */
 static void track_design_preview_restore_map(map_backup* backup)
 {
-    std::memcpy(gTileElements, backup->tile_elements, sizeof(backup->tile_elements));
-    std::memcpy(gTileElementTilePointers, backup->tile_pointers, sizeof(backup->tile_pointers));
-    gNextFreeTileElement = backup->next_free_tile_element;
+    map_swap_storage(backup->tile_storage);
     gMapSizeUnits = backup->map_size_units;
     gMapSizeMinus2 = backup->map_size_units_minus_2;
     gMapSize = backup->map_size;
@@ -2147,7 +2141,9 @@ static void track_design_preview_clear_map()
     gMapSizeUnits = 255 * COORDS_XY_STEP;
     gMapSizeMinus2 = (264 * 32) - 2;
     gMapSize = 256;
+    gMapSizeTechnical = MAXIMUM_MAP_SIZE_TECHNICAL;
 
+    map_resize_storage(MAX_TILE_TILE_ELEMENT_POINTERS * 2);
     for (int32_t i = 0; i < MAX_TILE_TILE_ELEMENT_POINTERS; i++)
     {
         TileElement* tile_element = &gTileElements[i];
@@ -17,6 +17,7 @@
 #include "../audio/AudioMixer.h"
 #include "../audio/audio.h"
 #include "../config/Config.h"
+#include "../core/JobPool.h"
 #include "../core/Memory.hpp"
 #include "../interface/Viewport.h"
 #include "../localisation/Localisation.h"
@@ -44,7 +45,9 @@
 #include "VehicleSubpositionData.h"
 
 #include <algorithm>
+#include <exception>
 #include <iterator>
+#include <memory>
 
 static bool vehicle_boat_is_location_accessible(const CoordsXYZ& location);
 
@@ -55,17 +58,134 @@ constexpr int16_t VEHICLE_MAX_SPIN_SPEED_WATER_RIDE = 512;
 constexpr int16_t VEHICLE_MIN_SPIN_SPEED_WATER_RIDE = -VEHICLE_MAX_SPIN_SPEED_WATER_RIDE;
 constexpr int16_t VEHICLE_STOPPING_SPIN_SPEED = 600;
 
-Vehicle* gCurrentVehicle;
+thread_local VehicleMotionContext gVehicleMotion;
+VehicleMotionStats gVehicleMotionStats;
 
-static uint8_t _vehicleBreakdown;
-StationIndex _vehicleStationIndex;
-uint32_t _vehicleMotionTrackFlags;
-int32_t _vehicleVelocityF64E08;
-int32_t _vehicleVelocityF64E0C;
-int32_t _vehicleUnkF64E10;
-uint8_t _vehicleF64E2C;
-Vehicle* _vehicleFrontVehicle;
-CoordsXYZ unk_F64E20;
+struct ViewportInvalidation
+{
+    rct_viewport* Viewport;
+    int32_t Left;
+    int32_t Top;
+    int32_t Right;
+    int32_t Bottom;
+};
+
+/**
+ * What a train updated ahead of the ordered commit changed outside of the cars of its ride, and the copies needed to put
+ * it back when the train has to be updated in order after all.
+ */
+struct VehicleMotionJournal
+{
+    // Sprites moved without updating the spatial index, with the location they are indexed at.
+    std::vector<std::pair<SpriteBase*, CoordsXY>> SpatialMoves;
+    std::vector<ViewportInvalidation> ViewportInvalidations;
+    std::vector<std::pair<OpenRCT2::Audio::SoundId, CoordsXYZ>> Sounds;
+    std::vector<Vehicle*> WindowInvalidations;
+    std::vector<const SpriteBase*> ChecksumInvalidations;
+
+    std::vector<std::pair<Vehicle*, Vehicle>> SavedCars;
+    std::vector<std::pair<TileElement*, TileElement>> SavedElements;
+
+    void Clear()
+    {
+        SpatialMoves.clear();
+        ViewportInvalidations.clear();
+        Sounds.clear();
+        WindowInvalidations.clear();
+        ChecksumInvalidations.clear();
+        SavedCars.clear();
+        SavedElements.clear();
+    }
+};
+
+// Thrown on the worker threads when the train being updated ahead reaches state shared between rides.
+class VehicleMotionSerialRequired : public std::exception
+{
+};
+
+// Set on the threads updating trains ahead of the ordered commit.
+static thread_local VehicleMotionJournal* _vehicleMotionJournal = nullptr;
+
+bool vehicle_motion_is_speculative()
+{
+    return _vehicleMotionJournal != nullptr;
+}
+
+void vehicle_motion_require_serial()
+{
+    if (_vehicleMotionJournal != nullptr)
+    {
+        throw VehicleMotionSerialRequired();
+    }
+}
+
+bool vehicle_motion_defer_spatial_move(SpriteBase* sprite)
+{
+    if (_vehicleMotionJournal == nullptr)
+        return false;
+
+    auto& moves = _vehicleMotionJournal->SpatialMoves;
+    auto isSprite = [sprite](const std::pair<SpriteBase*, CoordsXY>& move) { return move.first == sprite; };
+    if (std::none_of(moves.begin(), moves.end(), isSprite))
+    {
+        moves.emplace_back(sprite, CoordsXY{ sprite->x, sprite->y });
+    }
+    return true;
+}
+
+bool vehicle_motion_defer_checksum_invalidate(const SpriteBase* sprite)
+{
+    if (_vehicleMotionJournal == nullptr)
+        return false;
+
+    _vehicleMotionJournal->ChecksumInvalidations.push_back(sprite);
+    return true;
+}
+
+bool vehicle_motion_defer_viewport_invalidate(rct_viewport* viewport, int32_t left, int32_t top, int32_t right, int32_t bottom)
+{
+    if (_vehicleMotionJournal == nullptr)
+        return false;
+
+    _vehicleMotionJournal->ViewportInvalidations.push_back({ viewport, left, top, right, bottom });
+    return true;
+}
+
+bool vehicle_motion_defer_sound(OpenRCT2::Audio::SoundId soundId, const CoordsXYZ& loc)
+{
+    if (_vehicleMotionJournal == nullptr)
+        return false;
+
+    _vehicleMotionJournal->Sounds.emplace_back(soundId, loc);
+    return true;
+}
+
+/**
+ * Keeps a copy of a car outside of the train being updated ahead before it is changed.
+ */
+static void vehicle_motion_save_car(Vehicle* car)
+{
+    if (_vehicleMotionJournal == nullptr)
+        return;
+
+    auto& cars = _vehicleMotionJournal->SavedCars;
+    auto isCar = [car](const std::pair<Vehicle*, Vehicle>& savedCar) { return savedCar.first == car; };
+    if (std::none_of(cars.begin(), cars.end(), isCar))
+    {
+        cars.emplace_back(car, *car);
+    }
+}
+
+/**
+ * Keeps a copy of a track element of the ride before a train updated ahead changes it.
+ */
+static void vehicle_motion_save_element(TileElement* tileElement)
+{
+    if (_vehicleMotionJournal != nullptr)
+    {
+        _vehicleMotionJournal->SavedElements.emplace_back(tileElement, *tileElement);
+    }
+}
 
 // clang-format off
 static constexpr const OpenRCT2::Audio::SoundId byte_9A3A14[] = { OpenRCT2::Audio::SoundId::Scream8,
@@ -1350,6 +1470,187 @@ void vehicle_sounds_update()
     }
 }
 
+struct VehicleMotionTrain
+{
+    Vehicle* Head;
+    bool Speculated;
+    bool Aborted;
+    VehicleMotionJournal Journal;
+};
+
+// Kept between ticks so the journals do not allocate again.
+static std::vector<VehicleMotionTrain> _motionTrains;
+// Indices into _motionTrains grouped by ride, in train order within each ride, and the range of every ride.
+static std::vector<size_t> _motionTrainsByRide;
+static std::vector<std::pair<size_t, size_t>> _motionRides;
+static std::unique_ptr<JobPool> _motionJobs;
+
+/**
+ * Whether the train can be updated ahead of the trains before it. Only travelling trains are, boat hire boats look for
+ * the boats of other rides through the spatial index and mini golf moves the guests.
+ */
+static bool vehicle_motion_can_run_ahead(const Vehicle* head)
+{
+    if (head->ride_subtype == RIDE_ENTRY_INDEX_NULL || head->status != Vehicle::Status::Travelling
+        || head->HasUpdateFlag(VEHICLE_UPDATE_FLAG_TESTING))
+    {
+        return false;
+    }
+
+    auto curRide = head->GetRide();
+    if (curRide == nullptr || curRide->mode == RideMode::BoatHire)
+        return false;
+
+    for (auto car = head; car != nullptr; car = GetEntity<Vehicle>(car->next_vehicle_on_train))
+    {
+        auto vehicleEntry = car->Entry();
+        if (vehicleEntry == nullptr
+            || (vehicleEntry->flags & (VEHICLE_ENTRY_FLAG_BOAT_HIRE_COLLISION_DETECTION | VEHICLE_ENTRY_FLAG_MINI_GOLF)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Updates the trains of one ride in order on a worker thread until one of them cannot be updated ahead, that one and
+ * the ones after it are left for the ordered commit.
+ */
+static void vehicle_motion_update_ride(const std::pair<size_t, size_t>& rideTrains)
+{
+    for (size_t i = rideTrains.first; i < rideTrains.second; i++)
+    {
+        auto& train = _motionTrains[_motionTrainsByRide[i]];
+        if (!vehicle_motion_can_run_ahead(train.Head))
+            return;
+
+        auto& journal = train.Journal;
+        for (auto car = train.Head; car != nullptr; car = GetEntity<Vehicle>(car->next_vehicle_on_train))
+        {
+            journal.SavedCars.emplace_back(car, *car);
+        }
+
+        _vehicleMotionJournal = &journal;
+        try
+        {
+            train.Head->Update();
+            train.Speculated = true;
+        }
+        catch (const VehicleMotionSerialRequired&)
+        {
+            train.Aborted = true;
+        }
+        _vehicleMotionJournal = nullptr;
+
+        if (train.Aborted)
+        {
+            for (auto it = journal.SavedElements.rbegin(); it != journal.SavedElements.rend(); it++)
+            {
+                *it->first = it->second;
+            }
+            for (auto& [car, savedCar] : journal.SavedCars)
+            {
+                *car = savedCar;
+            }
+            return;
+        }
+    }
+}
+
+static void vehicle_motion_commit(const VehicleMotionJournal& journal)
+{
+    for (const auto& [sprite, oldLoc] : journal.SpatialMoves)
+    {
+        sprite_spatial_move_from(sprite, oldLoc);
+    }
+    for (const auto& invalidation : journal.ViewportInvalidations)
+    {
+        viewport_invalidate(
+            invalidation.Viewport, invalidation.Left, invalidation.Top, invalidation.Right, invalidation.Bottom);
+    }
+    for (const auto& [soundId, loc] : journal.Sounds)
+    {
+        OpenRCT2::Audio::Play3D(soundId, loc);
+    }
+    for (auto vehicle : journal.WindowInvalidations)
+    {
+        auto intent = Intent(INTENT_ACTION_INVALIDATE_VEHICLE_WINDOW);
+        intent.putExtra(INTENT_EXTRA_VEHICLE, vehicle);
+        context_broadcast_intent(&intent);
+    }
+    for (auto sprite : journal.ChecksumInvalidations)
+    {
+        sprite_checksum_invalidate(sprite);
+    }
+}
+
+static void vehicle_update_all_parallel()
+{
+    if (_motionJobs == nullptr)
+    {
+        _motionJobs = std::make_unique<JobPool>();
+    }
+
+    size_t trainCount = 0;
+    for (auto vehicle : EntityList<Vehicle>(EntityListId::TrainHead))
+    {
+        if (trainCount == _motionTrains.size())
+        {
+            _motionTrains.emplace_back();
+        }
+        auto& train = _motionTrains[trainCount++];
+        train.Head = vehicle;
+        train.Speculated = false;
+        train.Aborted = false;
+        train.Journal.Clear();
+    }
+
+    _motionTrainsByRide.resize(trainCount);
+    for (size_t i = 0; i < trainCount; i++)
+    {
+        _motionTrainsByRide[i] = i;
+    }
+    std::stable_sort(_motionTrainsByRide.begin(), _motionTrainsByRide.end(), [](size_t a, size_t b) {
+        return _motionTrains[a].Head->ride < _motionTrains[b].Head->ride;
+    });
+    _motionRides.clear();
+    for (size_t i = 0; i < trainCount; i++)
+    {
+        if (i == 0 || _motionTrains[_motionTrainsByRide[i]].Head->ride != _motionTrains[_motionTrainsByRide[i - 1]].Head->ride)
+        {
+            _motionRides.emplace_back(i, i);
+        }
+        _motionRides.back().second = i + 1;
+    }
+
+    // The trains only change their own ride while they run ahead, a train never sees one of another ride.
+    _motionJobs->ParallelFor(_motionRides.size(), [](size_t i) -> void { vehicle_motion_update_ride(_motionRides[i]); });
+
+    for (size_t i = 0; i < trainCount; i++)
+    {
+        auto& train = _motionTrains[i];
+        gVehicleMotionStats.Trains++;
+        if (train.Speculated || train.Aborted)
+        {
+            gVehicleMotionStats.Speculated++;
+        }
+
+        if (train.Speculated)
+        {
+            vehicle_motion_commit(train.Journal);
+        }
+        else
+        {
+            if (train.Aborted)
+            {
+                gVehicleMotionStats.Aborted++;
+            }
+            train.Head->Update();
+        }
+    }
+}
+
 /**
  *
  *  rct2: 0x006D4204
@@ -1362,8 +1663,15 @@ void vehicle_update_all()
     if ((gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) && gS6Info.editor_step != EDITOR_STEP_ROLLERCOASTER_DESIGNER)
         return;
 
+    if (gConfigGeneral.parallel_ride_motion)
+    {
+        vehicle_update_all_parallel();
+        return;
+    }
+
     for (auto vehicle : EntityList<Vehicle>(EntityListId::TrainHead))
     {
+        gVehicleMotionStats.Trains++;
         vehicle->Update();
     }
 }
@@ -1664,78 +1972,7 @@ void Vehicle::UpdateMeasurements()
         uint16_t trackFlags = TrackFlags[trackElemType];
 
         uint32_t testingFlags = curRide->testing_flags;
-        if (testingFlags & RIDE_TESTING_TURN_LEFT && trackFlags & TRACK_ELEM_FLAG_TURN_LEFT)
-        {
-            // 0x800 as this is masked to CURRENT_TURN_COUNT_MASK
-            curRide->turn_count_default += 0x800;
-        }
-        else if (testingFlags & RIDE_TESTING_TURN_RIGHT && trackFlags & TRACK_ELEM_FLAG_TURN_RIGHT)
-        {
-            // 0x800 as this is masked to CURRENT_TURN_COUNT_MASK
-            curRide->turn_count_default += 0x800;
-        }
-        else if (testingFlags & RIDE_TESTING_TURN_RIGHT || testingFlags & RIDE_TESTING_TURN_LEFT)
-        {
-            curRide->testing_flags &= ~(
-                RIDE_TESTING_TURN_LEFT | RIDE_TESTING_TURN_RIGHT | RIDE_TESTING_TURN_BANKED | RIDE_TESTING_TURN_SLOPED);
-
-            uint8_t turnType = 1;
-            if (!(testingFlags & RIDE_TESTING_TURN_BANKED))
-            {
-                turnType = 2;
-                if (!(testingFlags & RIDE_TESTING_TURN_SLOPED))
-                {
-                    turnType = 0;
-                }
-            }
-            switch (curRide->turn_count_default >> 11)
-            {
-                case 0:
-                    increment_turn_count_1_element(curRide, turnType);
-                    break;
-                case 1:
-                    increment_turn_count_2_elements(curRide, turnType);
-                    break;
-                case 2:
-                    increment_turn_count_3_elements(curRide, turnType);
-                    break;
-                default:
-                    increment_turn_count_4_plus_elements(curRide, turnType);
-                    break;
-            }
-        }
-        else
-        {
-            if (trackFlags & TRACK_ELEM_FLAG_TURN_LEFT)
-            {
-                curRide->testing_flags |= RIDE_TESTING_TURN_LEFT;
-                curRide->turn_count_default &= ~CURRENT_TURN_COUNT_MASK;
-
-                if (trackFlags & TRACK_ELEM_FLAG_TURN_BANKED)
-                {
-                    curRide->testing_flags |= RIDE_TESTING_TURN_BANKED;
-                }
-                if (trackFlags & TRACK_ELEM_FLAG_TURN_SLOPED)
-                {
-                    curRide->testing_flags |= RIDE_TESTING_TURN_SLOPED;
-                }
-            }
-
-            if (trackFlags & TRACK_ELEM_FLAG_TURN_RIGHT)
-            {
-                curRide->testing_flags |= RIDE_TESTING_TURN_RIGHT;
-                curRide->turn_count_default &= ~CURRENT_TURN_COUNT_MASK;
-
-                if (trackFlags & TRACK_ELEM_FLAG_TURN_BANKED)
-                {
-                    curRide->testing_flags |= RIDE_TESTING_TURN_BANKED;
-                }
-                if (trackFlags & TRACK_ELEM_FLAG_TURN_SLOPED)
-                {
-                    curRide->testing_flags |= RIDE_TESTING_TURN_SLOPED;
-                }
-            }
-        }
+        ride_measure_turns(curRide, trackFlags);
 
         if (testingFlags & RIDE_TESTING_DROP_DOWN)
         {
@@ -1816,16 +2053,6 @@ void Vehicle::UpdateMeasurements()
                     curRide->inversions++;
             }
         }
-
-        if (trackFlags & TRACK_ELEM_FLAG_HELIX)
-        {
-            uint8_t helixes = ride_get_helix_sections(curRide);
-            if (helixes != MAX_HELICES)
-                helixes++;
-
-            curRide->special_track_elements &= ~0x1F;
-            curRide->special_track_elements |= helixes;
-        }
     }
 
     if (ride_get_entrance_location(curRide, curRide->current_test_station).isNull())
@@ -1985,10 +2212,10 @@ void Vehicle::Update()
     if (HasUpdateFlag(VEHICLE_UPDATE_FLAG_TESTING))
         UpdateMeasurements();
 
-    _vehicleBreakdown = 255;
+    gVehicleMotion.Breakdown = 255;
     if (curRide->lifecycle_flags & (RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN))
     {
-        _vehicleBreakdown = curRide->breakdown_reason_pending;
+        gVehicleMotion.Breakdown = curRide->breakdown_reason_pending;
         auto vehicleEntry = &rideEntry->vehicles[vehicle_type];
         if ((vehicleEntry->flags & VEHICLE_ENTRY_FLAG_POWERED) && curRide->breakdown_reason_pending == BREAKDOWN_SAFETY_CUT_OUT)
         {
@@ -3350,7 +3577,7 @@ void Vehicle::UpdateDeparting()
                 acceleration = 15539;
                 if (velocity != 0)
                 {
-                    if (_vehicleBreakdown == BREAKDOWN_SAFETY_CUT_OUT)
+                    if (gVehicleMotion.Breakdown == BREAKDOWN_SAFETY_CUT_OUT)
                     {
                         SetUpdateFlag(VEHICLE_UPDATE_FLAG_ZERO_VELOCITY);
                         ClearUpdateFlag(VEHICLE_UPDATE_FLAG_COLLISION_DISABLED);
@@ -3368,7 +3595,7 @@ void Vehicle::UpdateDeparting()
                 acceleration = -15539;
                 if (velocity != 0)
                 {
-                    if (_vehicleBreakdown == BREAKDOWN_SAFETY_CUT_OUT)
+                    if (gVehicleMotion.Breakdown == BREAKDOWN_SAFETY_CUT_OUT)
                     {
                         SetUpdateFlag(VEHICLE_UPDATE_FLAG_ZERO_VELOCITY);
                         ClearUpdateFlag(VEHICLE_UPDATE_FLAG_COLLISION_DISABLED);
@@ -3395,7 +3622,7 @@ void Vehicle::UpdateDeparting()
 
         if (shouldLaunch)
         {
-            if (!(curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_3) || _vehicleStationIndex != current_station)
+            if (!(curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_3) || gVehicleMotion.Station != current_station)
             {
                 FinishDeparting();
                 return;
@@ -3499,6 +3726,7 @@ void Vehicle::CheckIfMissing()
     if (lost_time_out <= limit)
         return;
 
+    vehicle_motion_require_serial();
     curRide->lifecycle_flags |= RIDE_LIFECYCLE_HAS_STALLED_VEHICLE;
 
     if (gConfigNotifications.ride_stalled_vehicles)
@@ -3537,6 +3765,9 @@ void Vehicle::SimulateCrash() const
  */
 void Vehicle::UpdateCollisionSetup()
 {
+    // Crashes change the ride, the guests and the park rating.
+    vehicle_motion_require_serial();
+
     auto curRide = GetRide();
     if (curRide == nullptr)
         return;
@@ -3632,6 +3863,8 @@ static constexpr const CoordsXY stru_9A3AC4[] = {
  */
 void Vehicle::UpdateCrashSetup()
 {
+    vehicle_motion_require_serial();
+
     auto curRide = GetRide();
     if (curRide != nullptr && curRide->status == RIDE_STATUS_SIMULATING)
     {
@@ -3709,7 +3942,7 @@ void Vehicle::UpdateTravelling()
     CheckIfMissing();
 
     auto curRide = GetRide();
-    if (curRide == nullptr || (_vehicleBreakdown == 0 && curRide->mode == RideMode::RotatingLift))
+    if (curRide == nullptr || (gVehicleMotion.Breakdown == 0 && curRide->mode == RideMode::RotatingLift))
         return;
 
     if (sub_state == 2)
@@ -3828,7 +4061,7 @@ void Vehicle::UpdateTravelling()
                     {
                         acceleration = -15539;
 
-                        if (_vehicleBreakdown == 0)
+                        if (gVehicleMotion.Breakdown == 0)
                         {
                             sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
                             SetUpdateFlag(VEHICLE_UPDATE_FLAG_ZERO_VELOCITY);
@@ -3845,7 +4078,7 @@ void Vehicle::UpdateTravelling()
                 acceleration = 15539;
                 if (velocity != 0)
                 {
-                    if (_vehicleBreakdown == 0)
+                    if (gVehicleMotion.Breakdown == 0)
                     {
                         SetUpdateFlag(VEHICLE_UPDATE_FLAG_ZERO_VELOCITY);
                         sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
@@ -3871,7 +4104,7 @@ void Vehicle::UpdateTravelling()
         return;
 
     SetState(Vehicle::Status::Arriving);
-    current_station = _vehicleStationIndex;
+    current_station = gVehicleMotion.Station;
     var_C0 = 0;
     if (velocity < 0)
         sub_state = 1;
@@ -4281,7 +4514,7 @@ void Vehicle::UpdateTravellingCableLift()
     if (sub_state == 2)
         return;
 
-    if (curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_3 && current_station == _vehicleStationIndex)
+    if (curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_3 && current_station == gVehicleMotion.Station)
         return;
 
     sub_state = 2;
@@ -4330,8 +4563,8 @@ void Vehicle::TryReconnectBoatToTrack(const CoordsXY& currentBoatLocation, const
 
         track_progress = 0;
         SetState(Vehicle::Status::Travelling, sub_state);
-        unk_F64E20.x = currentBoatLocation.x;
-        unk_F64E20.y = currentBoatLocation.y;
+        gVehicleMotion.UnkF64E20.x = currentBoatLocation.x;
+        gVehicleMotion.UnkF64E20.y = currentBoatLocation.y;
     }
 }
 
@@ -4341,10 +4574,10 @@ void Vehicle::TryReconnectBoatToTrack(const CoordsXY& currentBoatLocation, const
  */
 void Vehicle::UpdateMotionBoatHire()
 {
-    _vehicleMotionTrackFlags = 0;
+    gVehicleMotion.TrackFlags = 0;
     velocity += acceleration;
-    _vehicleVelocityF64E08 = velocity;
-    _vehicleVelocityF64E0C = (velocity >> 10) * 42;
+    gVehicleMotion.VelocityF64E08 = velocity;
+    gVehicleMotion.VelocityF64E0C = (velocity >> 10) * 42;
 
     auto vehicleEntry = Entry();
     if (vehicleEntry == nullptr)
@@ -4356,15 +4589,15 @@ void Vehicle::UpdateMotionBoatHire()
         UpdateAdditionalAnimation();
     }
 
-    _vehicleUnkF64E10 = 1;
+    gVehicleMotion.UnkF64E10 = 1;
     acceleration = 0;
-    remaining_distance += _vehicleVelocityF64E0C;
+    remaining_distance += gVehicleMotion.VelocityF64E0C;
     if (remaining_distance >= 0x368A)
     {
         sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
-        unk_F64E20.x = x;
-        unk_F64E20.y = y;
-        unk_F64E20.z = z;
+        gVehicleMotion.UnkF64E20.x = x;
+        gVehicleMotion.UnkF64E20.y = y;
+        gVehicleMotion.UnkF64E20.z = z;
         Invalidate();
 
         for (;;)
@@ -4531,7 +4764,7 @@ void Vehicle::UpdateMotionBoatHire()
                             TryReconnectBoatToTrack(loc2, flooredLocation);
                             break;
                         }
-                        loc2 = unk_F64E20;
+                        loc2 = gVehicleMotion.UnkF64E20;
                         if (tilePart <= COORDS_XY_HALF_TILE)
                         {
                             loc2.y += 1;
@@ -4550,7 +4783,7 @@ void Vehicle::UpdateMotionBoatHire()
                             TryReconnectBoatToTrack(loc2, flooredLocation);
                             break;
                         }
-                        loc2 = unk_F64E20;
+                        loc2 = gVehicleMotion.UnkF64E20;
                         if (tilePart <= COORDS_XY_HALF_TILE)
                         {
                             loc2.x += 1;
@@ -4565,8 +4798,8 @@ void Vehicle::UpdateMotionBoatHire()
                     remaining_distance = 0;
                     if (!UpdateMotionCollisionDetection({ loc2, z }, nullptr))
                     {
-                        unk_F64E20.x = loc2.x;
-                        unk_F64E20.y = loc2.y;
+                        gVehicleMotion.UnkF64E20.x = loc2.x;
+                        gVehicleMotion.UnkF64E20.y = loc2.y;
                     }
                     break;
                 }
@@ -4574,16 +4807,16 @@ void Vehicle::UpdateMotionBoatHire()
             }
 
             remaining_distance -= Unk9A36C4[edi].distance;
-            unk_F64E20.x = loc2.x;
-            unk_F64E20.y = loc2.y;
+            gVehicleMotion.UnkF64E20.x = loc2.x;
+            gVehicleMotion.UnkF64E20.y = loc2.y;
             if (remaining_distance < 0x368A)
             {
                 break;
             }
-            _vehicleUnkF64E10++;
+            gVehicleMotion.UnkF64E10++;
         }
 
-        MoveTo(unk_F64E20);
+        MoveTo(gVehicleMotion.UnkF64E20);
         Invalidate();
     }
 
@@ -4616,8 +4849,8 @@ void Vehicle::UpdateMotionBoatHire()
         }
         acceleration = ecx;
     }
-    // eax = _vehicleMotionTrackFlags;
-    // ebx = _vehicleStationIndex;
+    // eax = gVehicleMotion.TrackFlags;
+    // ebx = gVehicleMotion.Station;
 }
 
 /**
@@ -4805,7 +5038,7 @@ void Vehicle::UpdateSwinging()
  */
 void Vehicle::UpdateFerrisWheelRotating()
 {
-    if (_vehicleBreakdown == 0)
+    if (gVehicleMotion.Breakdown == 0)
         return;
 
     auto curRide = GetRide();
@@ -4897,7 +5130,7 @@ void Vehicle::UpdateFerrisWheelRotating()
  */
 void Vehicle::UpdateSimulatorOperating()
 {
-    if (_vehicleBreakdown == 0)
+    if (gVehicleMotion.Breakdown == 0)
         return;
 
     assert(current_time >= -1);
@@ -4923,7 +5156,7 @@ void Vehicle::UpdateSimulatorOperating()
  */
 void Vehicle::UpdateRotating()
 {
-    if (_vehicleBreakdown == 0)
+    if (gVehicleMotion.Breakdown == 0)
         return;
 
     auto curRide = GetRide();
@@ -4951,7 +5184,7 @@ void Vehicle::UpdateRotating()
     }
 
     int32_t time = current_time;
-    if (_vehicleBreakdown == BREAKDOWN_CONTROL_FAILURE)
+    if (gVehicleMotion.Breakdown == BREAKDOWN_CONTROL_FAILURE)
     {
         time += (curRide->breakdown_sound_modifier >> 6) + 1;
     }
@@ -4970,7 +5203,7 @@ void Vehicle::UpdateRotating()
 
     current_time = -1;
     var_CE++;
-    if (_vehicleBreakdown != BREAKDOWN_CONTROL_FAILURE)
+    if (gVehicleMotion.Breakdown != BREAKDOWN_CONTROL_FAILURE)
     {
         bool shouldStop = true;
         if (curRide->status != RIDE_STATUS_CLOSED)
@@ -5014,7 +5247,7 @@ void Vehicle::UpdateRotating()
  */
 void Vehicle::UpdateSpaceRingsOperating()
 {
-    if (_vehicleBreakdown == 0)
+    if (gVehicleMotion.Breakdown == 0)
         return;
 
     uint8_t spriteType = SpaceRingsTimeToSpriteMap[current_time + 1];
@@ -5040,7 +5273,7 @@ void Vehicle::UpdateSpaceRingsOperating()
  */
 void Vehicle::UpdateHauntedHouseOperating()
 {
-    if (_vehicleBreakdown == 0)
+    if (gVehicleMotion.Breakdown == 0)
         return;
 
     if (vehicle_sprite_type != 0)
@@ -5094,7 +5327,7 @@ void Vehicle::UpdateHauntedHouseOperating()
  */
 void Vehicle::UpdateCrookedHouseOperating()
 {
-    if (_vehicleBreakdown == 0)
+    if (gVehicleMotion.Breakdown == 0)
         return;
 
     // Originally used an array of size 1 at 0x009A0AC4 and passed the sub state into it.
@@ -5114,7 +5347,7 @@ void Vehicle::UpdateCrookedHouseOperating()
  */
 void Vehicle::UpdateTopSpinOperating()
 {
-    if (_vehicleBreakdown == 0)
+    if (gVehicleMotion.Breakdown == 0)
         return;
 
     const top_spin_time_to_sprite_map* sprite_map = TopSpinTimeToSpriteMaps[sub_state];
@@ -5148,7 +5381,7 @@ void Vehicle::UpdateShowingFilm()
 {
     int32_t currentTime, totalTime;
 
-    if (_vehicleBreakdown == 0)
+    if (gVehicleMotion.Breakdown == 0)
         return;
 
     totalTime = RideFilmLength[sub_state];
@@ -5170,7 +5403,7 @@ void Vehicle::UpdateShowingFilm()
  */
 void Vehicle::UpdateDoingCircusShow()
 {
-    if (_vehicleBreakdown == 0)
+    if (gVehicleMotion.Breakdown == 0)
         return;
 
     int32_t currentTime = current_time + 1;
@@ -6302,11 +6535,11 @@ int32_t Vehicle::IsUsedInPairs() const
  */
 int32_t Vehicle::UpdateMotionDodgems()
 {
-    _vehicleMotionTrackFlags = 0;
+    gVehicleMotion.TrackFlags = 0;
 
     auto curRide = GetRide();
     if (curRide == nullptr)
-        return _vehicleMotionTrackFlags;
+        return gVehicleMotion.TrackFlags;
 
     int32_t nextVelocity = velocity + acceleration;
     if (curRide->lifecycle_flags & (RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN)
@@ -6316,9 +6549,9 @@ int32_t Vehicle::UpdateMotionDodgems()
     }
     velocity = nextVelocity;
 
-    _vehicleVelocityF64E08 = nextVelocity;
-    _vehicleVelocityF64E0C = (nextVelocity / 1024) * 42;
-    _vehicleUnkF64E10 = 1;
+    gVehicleMotion.VelocityF64E08 = nextVelocity;
+    gVehicleMotion.VelocityF64E0C = (nextVelocity / 1024) * 42;
+    gVehicleMotion.UnkF64E10 = 1;
 
     acceleration = 0;
     if (!(curRide->lifecycle_flags & (RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN))
@@ -6372,14 +6605,14 @@ int32_t Vehicle::UpdateMotionDodgems()
         }
     }
 
-    remaining_distance += _vehicleVelocityF64E0C;
+    remaining_distance += gVehicleMotion.VelocityF64E0C;
 
     if (remaining_distance >= 13962)
     {
         sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
-        unk_F64E20.x = x;
-        unk_F64E20.y = y;
-        unk_F64E20.z = z;
+        gVehicleMotion.UnkF64E20.x = x;
+        gVehicleMotion.UnkF64E20.y = y;
+        gVehicleMotion.UnkF64E20.z = z;
 
         Invalidate();
 
@@ -6389,7 +6622,7 @@ int32_t Vehicle::UpdateMotionDodgems()
             uint8_t direction = sprite_direction;
             direction |= var_35 & 1;
 
-            CoordsXY location = unk_F64E20;
+            CoordsXY location = gVehicleMotion.UnkF64E20;
             location.x += Unk9A36C4[direction].x;
             location.y += Unk9A36C4[direction].y;
 
@@ -6397,13 +6630,13 @@ int32_t Vehicle::UpdateMotionDodgems()
                 break;
 
             remaining_distance -= Unk9A36C4[direction].distance;
-            unk_F64E20.x = location.x;
-            unk_F64E20.y = location.y;
+            gVehicleMotion.UnkF64E20.x = location.x;
+            gVehicleMotion.UnkF64E20.y = location.y;
             if (remaining_distance < 13962)
             {
                 break;
             }
-            _vehicleUnkF64E10++;
+            gVehicleMotion.UnkF64E10++;
         }
 
         if (remaining_distance >= 13962)
@@ -6435,7 +6668,7 @@ int32_t Vehicle::UpdateMotionDodgems()
             }
         }
 
-        MoveTo(unk_F64E20);
+        MoveTo(gVehicleMotion.UnkF64E20);
         Invalidate();
     }
 
@@ -6456,7 +6689,7 @@ int32_t Vehicle::UpdateMotionDodgems()
     if (!(vehicleEntry->flags & VEHICLE_ENTRY_FLAG_POWERED))
     {
         acceleration = -eax;
-        return _vehicleMotionTrackFlags;
+        return gVehicleMotion.TrackFlags;
     }
 
     int32_t ebx = (speed * mass) >> 2;
@@ -6470,7 +6703,7 @@ int32_t Vehicle::UpdateMotionDodgems()
     _eax /= ebx;
 
     acceleration = _eax - eax;
-    return _vehicleMotionTrackFlags;
+    return gVehicleMotion.TrackFlags;
 }
 
 /**
@@ -6574,7 +6807,7 @@ void Vehicle::UpdateTrackMotionUpStopCheck() const
 
             if (vehicle_sprite_type != 8)
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_DERAILED;
+                gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_DERAILED;
             }
         }
     }
@@ -6603,7 +6836,7 @@ void Vehicle::UpdateTrackMotionUpStopCheck() const
 
             if (vehicle_sprite_type != 8 && vehicle_sprite_type != 55)
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_DERAILED;
+                gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_DERAILED;
             }
         }
     }
@@ -6643,7 +6876,7 @@ void Vehicle::ApplyNonStopBlockBrake()
 void Vehicle::ApplyStopBlockBrake()
 {
     // Slow it down till completely stop the car
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_BLOCK_BRAKE;
+    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_BLOCK_BRAKE;
     acceleration = 0;
     // If the this is slow enough, stop it. If not, slow it down
     if (velocity <= 0x20000)
@@ -6673,7 +6906,7 @@ void Vehicle::CheckAndApplyBlockSectionStopSite()
     // Is chair lift type
     if (vehicleEntry->flags & VEHICLE_ENTRY_FLAG_CHAIRLIFT)
     {
-        velocity = _vehicleBreakdown == 0 ? 0 : curRide->speed << 16;
+        velocity = gVehicleMotion.Breakdown == 0 ? 0 : curRide->speed << 16;
         acceleration = 0;
     }
 
@@ -6697,7 +6930,7 @@ void Vehicle::CheckAndApplyBlockSectionStopSite()
             break;
         case TrackElemType::EndStation:
             if (trackElement->AsTrack()->BlockBrakeClosed())
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_BLOCK_BRAKE;
+                gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_BLOCK_BRAKE;
 
             break;
         case TrackElemType::Up25ToFlat:
@@ -6745,8 +6978,8 @@ void Vehicle::UpdateVelocity()
     }
     velocity = nextVelocity;
 
-    _vehicleVelocityF64E08 = nextVelocity;
-    _vehicleVelocityF64E0C = (nextVelocity >> 10) * 42;
+    gVehicleMotion.VelocityF64E08 = nextVelocity;
+    gVehicleMotion.VelocityF64E0C = (nextVelocity >> 10) * 42;
 }
 
 static void block_brakes_open_previous_section(Ride& ride, const CoordsXYZ& vehicleTrackLocation, TileElement* tileElement)
@@ -6797,6 +7030,7 @@ static void block_brakes_open_previous_section(Ride& ride, const CoordsXYZ& vehi
     {
         return;
     }
+    vehicle_motion_save_element(reinterpret_cast<TileElement*>(trackElement));
     trackElement->SetBlockBrakeClosed(false);
     map_invalidate_element(location, reinterpret_cast<TileElement*>(trackElement));
 
@@ -6936,7 +7170,7 @@ int32_t Vehicle::GetSwingAmount() const
  */
 void Vehicle::UpdateSwingingCar()
 {
-    int32_t dword_F64E08 = abs(_vehicleVelocityF64E08);
+    int32_t dword_F64E08 = abs(gVehicleMotion.VelocityF64E08);
     SwingSpeed += (-SwingPosition) >> 6;
     int32_t swingAmount = GetSwingAmount();
     if (swingAmount < 0)
@@ -7133,7 +7367,7 @@ void Vehicle::UpdateSpinningCar()
     }
     int32_t spinningInertia = vehicleEntry->spinning_inertia;
     int32_t trackType = GetTrackType();
-    int32_t dword_F64E08 = _vehicleVelocityF64E08;
+    int32_t dword_F64E08 = gVehicleMotion.VelocityF64E08;
     int32_t spinSpeed;
     // An L spin adds to the spin speed, R does the opposite
     // The number indicates how much right shift of the velocity will become spin
@@ -7269,7 +7503,7 @@ void Vehicle::UpdateAdditionalAnimation()
     switch (vehicleEntry->animation)
     {
         case VEHICLE_ENTRY_ANIMATION_MINITURE_RAILWAY_LOCOMOTIVE: // loc_6D652B
-            *curVar_C8 += _vehicleVelocityF64E08;
+            *curVar_C8 += gVehicleMotion.VelocityF64E08;
             al = (*curVar_C8 >> 20) & 3;
             if (animation_frame != al)
             {
@@ -7309,7 +7543,7 @@ void Vehicle::UpdateAdditionalAnimation()
             }
             break;
         case VEHICLE_ENTRY_ANIMATION_SWAN: // loc_6D6424
-            *curVar_C8 += _vehicleVelocityF64E08;
+            *curVar_C8 += gVehicleMotion.VelocityF64E08;
             al = (*curVar_C8 >> 18) & 2;
             if (animation_frame != al)
             {
@@ -7318,7 +7552,7 @@ void Vehicle::UpdateAdditionalAnimation()
             }
             break;
         case VEHICLE_ENTRY_ANIMATION_CANOES: // loc_6D6482
-            *curVar_C8 += _vehicleVelocityF64E08;
+            *curVar_C8 += gVehicleMotion.VelocityF64E08;
             eax = ((*curVar_C8 >> 13) & 0xFF) * 6;
             ah = (eax >> 8) & 0xFF;
             if (animation_frame != ah)
@@ -7328,7 +7562,7 @@ void Vehicle::UpdateAdditionalAnimation()
             }
             break;
         case VEHICLE_ENTRY_ANIMATION_ROW_BOATS: // loc_6D64F7
-            *curVar_C8 += _vehicleVelocityF64E08;
+            *curVar_C8 += gVehicleMotion.VelocityF64E08;
             eax = ((*curVar_C8 >> 13) & 0xFF) * 7;
             ah = (eax >> 8) & 0xFF;
             if (animation_frame != ah)
@@ -7338,7 +7572,7 @@ void Vehicle::UpdateAdditionalAnimation()
             }
             break;
         case VEHICLE_ENTRY_ANIMATION_WATER_TRICYCLES: // loc_6D6453
-            *curVar_C8 += _vehicleVelocityF64E08;
+            *curVar_C8 += gVehicleMotion.VelocityF64E08;
             al = (*curVar_C8 >> 19) & 1;
             if (animation_frame != al)
             {
@@ -7360,7 +7594,7 @@ void Vehicle::UpdateAdditionalAnimation()
             }
             break;
         case VEHICLE_ENTRY_ANIMATION_HELICARS: // loc_6D63F5
-            *curVar_C8 += _vehicleVelocityF64E08;
+            *curVar_C8 += gVehicleMotion.VelocityF64E08;
             al = (*curVar_C8 >> 18) & 3;
             if (animation_frame != al)
             {
@@ -7371,7 +7605,7 @@ void Vehicle::UpdateAdditionalAnimation()
         case VEHICLE_ENTRY_ANIMATION_MONORAIL_CYCLES: // loc_6D64B6
             if (num_peeps != 0)
             {
-                *curVar_C8 += _vehicleVelocityF64E08;
+                *curVar_C8 += gVehicleMotion.VelocityF64E08;
                 eax = ((*curVar_C8 >> 13) & 0xFF) << 2;
                 ah = (eax >> 8) & 0xFF;
                 if (animation_frame != ah)
@@ -7451,6 +7685,9 @@ static void AnimateSceneryDoor(const CoordsXYZD& doorLocation, const CoordsXYZ&
         return;
     }
 
+    // Doors can be shared by the tracks of several rides.
+    vehicle_motion_require_serial();
+
     if (!isLastVehicle && (door->GetAnimationFrame() == 0))
     {
         door->SetAnimationIsBackwards(isBackwards);
@@ -7521,6 +7758,7 @@ void Vehicle::UpdateGoKartAttemptSwitchLanes()
  */
 static void trigger_on_ride_photo(const CoordsXYZ& loc, TileElement* tileElement)
 {
+    vehicle_motion_require_serial();
     tileElement->AsTrack()->SetPhotoTimeout();
 
     map_animation_create(MAP_ANIMATION_TYPE_TRACK_ONRIDEPHOTO, { loc, tileElement->GetBaseZ() });
@@ -7545,12 +7783,12 @@ void Vehicle::UpdateSceneryDoorBackwards() const
 
 static void vehicle_update_play_water_splash_sound()
 {
-    if (_vehicleVelocityF64E08 <= BLOCK_BRAKE_BASE_SPEED)
+    if (gVehicleMotion.VelocityF64E08 <= BLOCK_BRAKE_BASE_SPEED)
     {
         return;
     }
 
-    OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::WaterSplash, { unk_F64E20.x, unk_F64E20.y, unk_F64E20.z });
+    OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::WaterSplash, gVehicleMotion.UnkF64E20);
 }
 
 /**
@@ -7849,7 +8087,7 @@ void Vehicle::Sub6DBF3E()
 {
     rct_ride_entry_vehicle* vehicleEntry = Entry();
 
-    acceleration /= _vehicleUnkF64E10;
+    acceleration /= gVehicleMotion.UnkF64E10;
     if (TrackSubposition == VehicleTrackSubposition::ChairliftGoingBack)
     {
         return;
@@ -7861,7 +8099,7 @@ void Vehicle::Sub6DBF3E()
         return;
     }
 
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_3;
+    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_3;
 
     TileElement* tileElement = nullptr;
     if (map_is_location_valid(TrackLocation))
@@ -7874,12 +8112,12 @@ void Vehicle::Sub6DBF3E()
         return;
     }
 
-    if (_vehicleStationIndex == STATION_INDEX_NULL)
+    if (gVehicleMotion.Station == STATION_INDEX_NULL)
     {
-        _vehicleStationIndex = tileElement->AsTrack()->GetStationIndex();
+        gVehicleMotion.Station = tileElement->AsTrack()->GetStationIndex();
     }
 
-    if (trackType == TrackElemType::TowerBase && this == gCurrentVehicle)
+    if (trackType == TrackElemType::TowerBase && this == gVehicleMotion.CurrentVehicle)
     {
         if (track_progress > 3 && !HasUpdateFlag(VEHICLE_UPDATE_FLAG_REVERSING_SHUTTLE))
         {
@@ -7889,27 +8127,27 @@ void Vehicle::Sub6DBF3E()
             CoordsXYE input = { TrackLocation, tileElement };
             if (!track_block_get_next(&input, &output, &outputZ, &outputDirection))
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_12;
+                gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_12;
             }
         }
 
         if (track_progress <= 3)
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+            gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
         }
     }
 
-    if (trackType != TrackElemType::EndStation || this != gCurrentVehicle)
+    if (trackType != TrackElemType::EndStation || this != gVehicleMotion.CurrentVehicle)
     {
         return;
     }
 
     uint16_t ax = track_progress;
-    if (_vehicleVelocityF64E08 < 0)
+    if (gVehicleMotion.VelocityF64E08 < 0)
     {
         if (ax <= 22)
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+            gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
         }
     }
     else
@@ -7929,7 +8167,7 @@ void Vehicle::Sub6DBF3E()
 
         if (ax > cx)
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+            gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
         }
     }
 }
@@ -7950,15 +8188,16 @@ bool Vehicle::UpdateTrackMotionForwardsGetNewTrack(uint16_t trackType, Ride* cur
         return false;
     }
 
-    if (trackType == TrackElemType::CableLiftHill && this == gCurrentVehicle)
+    if (trackType == TrackElemType::CableLiftHill && this == gVehicleMotion.CurrentVehicle)
     {
-        _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_11;
+        gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_11;
     }
 
     if (tileElement->AsTrack()->IsBlockStart())
     {
         if (next_vehicle_on_train == SPRITE_INDEX_NULL)
         {
+            vehicle_motion_save_element(tileElement);
             tileElement->AsTrack()->SetBlockBrakeClosed(true);
             if (trackType == TrackElemType::BlockBrakes || trackType == TrackElemType::EndStation)
             {
@@ -8139,11 +8378,11 @@ loc_6DAEB9:
             vehicle_type ^= 1;
             vehicleEntry = Entry();
         }
-        if (_vehicleVelocityF64E08 >= 0x40000)
+        if (gVehicleMotion.VelocityF64E08 >= 0x40000)
         {
-            acceleration = -_vehicleVelocityF64E08 * 8;
+            acceleration = -gVehicleMotion.VelocityF64E08 * 8;
         }
-        else if (_vehicleVelocityF64E08 < 0x20000)
+        else if (gVehicleMotion.VelocityF64E08 < 0x20000)
         {
             acceleration = 0x50000;
         }
@@ -8155,15 +8394,15 @@ loc_6DAEB9:
         if (!hasBrakesFailure || curRide->mechanic_status == RIDE_MECHANIC_STATUS_HAS_FIXED_STATION_BRAKES)
         {
             regs.eax = brake_speed << 16;
-            if (regs.eax < _vehicleVelocityF64E08)
+            if (regs.eax < gVehicleMotion.VelocityF64E08)
             {
-                acceleration = -_vehicleVelocityF64E08 * 16;
+                acceleration = -gVehicleMotion.VelocityF64E08 * 16;
             }
             else if (!(gCurrentTicks & 0x0F))
             {
-                if (_vehicleF64E2C == 0)
+                if (gVehicleMotion.F64E2C == 0)
                 {
-                    _vehicleF64E2C++;
+                    gVehicleMotion.F64E2C++;
                     OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::BrakeRelease, { x, y, z });
                 }
             }
@@ -8173,10 +8412,10 @@ loc_6DAEB9:
     {
         regs.eax = get_booster_speed(curRide->type, (brake_speed << 16));
 
-        if (regs.eax > _vehicleVelocityF64E08)
+        if (regs.eax > gVehicleMotion.VelocityF64E08)
         {
             acceleration = RideTypeDescriptors[curRide->type].OperatingSettings.BoosterAcceleration
-                << 16; //_vehicleVelocityF64E08 * 1.2;
+                << 16; //gVehicleMotion.VelocityF64E08 * 1.2;
         }
     }
 
@@ -8193,7 +8432,7 @@ loc_6DAEB9:
             {
                 if (track_progress >= 8)
                 {
-                    acceleration = -_vehicleVelocityF64E08 * 16;
+                    acceleration = -gVehicleMotion.VelocityF64E08 * 16;
                     if (track_progress >= 24)
                     {
                         SetUpdateFlag(VEHICLE_UPDATE_FLAG_ON_BRAKE_FOR_DROP);
@@ -8229,8 +8468,8 @@ loc_6DAEB9:
 
         if (!UpdateTrackMotionForwardsGetNewTrack(trackType, curRide, rideEntry))
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-            _vehicleVelocityF64E0C -= remaining_distance + 1;
+            gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+            gVehicleMotion.VelocityF64E0C -= remaining_distance + 1;
             remaining_distance = -1;
             return false;
         }
@@ -8248,15 +8487,15 @@ loc_6DAEB9:
             + CoordsXYZ{ moveInfo->x, moveInfo->y, moveInfo->z + RideTypeDescriptors[curRide->type].Heights.VehicleZOffset };
 
         regs.ebx = 0;
-        if (loc.x != unk_F64E20.x)
+        if (loc.x != gVehicleMotion.UnkF64E20.x)
         {
             regs.ebx |= 1;
         }
-        if (loc.y != unk_F64E20.y)
+        if (loc.y != gVehicleMotion.UnkF64E20.y)
         {
             regs.ebx |= 2;
         }
-        if (loc.z != unk_F64E20.z)
+        if (loc.z != gVehicleMotion.UnkF64E20.z)
         {
             regs.ebx |= 4;
         }
@@ -8281,7 +8520,7 @@ loc_6DAEB9:
         // loc_6DB8A5
         regs.ebx = dword_9A2930[regs.ebx];
         remaining_distance -= regs.ebx;
-        unk_F64E20 = loc;
+        gVehicleMotion.UnkF64E20 = loc;
         sprite_direction = moveInfo->direction;
         bank_rotation = moveInfo->bank_rotation;
         vehicle_sprite_type = moveInfo->vehicle_sprite_type;
@@ -8296,9 +8535,9 @@ loc_6DAEB9:
         }
 
         // this == frontVehicle
-        if (this == _vehicleFrontVehicle)
+        if (this == gVehicleMotion.FrontVehicle)
         {
-            if (_vehicleVelocityF64E08 >= 0)
+            if (gVehicleMotion.VelocityF64E08 >= 0)
             {
                 otherVehicleIndex = prev_vehicle_on_ride;
                 if (UpdateMotionCollisionDetection(loc, &otherVehicleIndex))
@@ -8317,11 +8556,11 @@ loc_6DAEB9:
 
     regs.ebx = dword_9A2970[regs.ebx];
     acceleration += regs.ebx;
-    _vehicleUnkF64E10++;
+    gVehicleMotion.UnkF64E10++;
     goto loc_6DAEB9;
 
 loc_6DB967:
-    _vehicleVelocityF64E0C -= remaining_distance + 1;
+    gVehicleMotion.VelocityF64E0C -= remaining_distance + 1;
     remaining_distance = -1;
 
     // Might need to be bp rather than this, but hopefully not
@@ -8341,7 +8580,7 @@ loc_6DB967:
         {
             if (!(vehicleEntry->flags & VEHICLE_ENTRY_FLAG_BOAT_HIRE_COLLISION_DETECTION))
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
+                gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
             }
         }
     }
@@ -8352,11 +8591,12 @@ loc_6DB967:
     }
     else
     {
+        vehicle_motion_save_car(head);
         int32_t newHeadVelocity = velocity >> 1;
         velocity = head->velocity >> 1;
         head->velocity = newHeadVelocity;
     }
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_1;
+    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_1;
     return false;
 }
 
@@ -8477,14 +8717,14 @@ bool Vehicle::UpdateTrackMotionBackwardsGetNewTrack(uint16_t trackType, Ride* cu
 
     if (tileElement->AsTrack()->HasChain())
     {
-        if (_vehicleVelocityF64E08 < 0)
+        if (gVehicleMotion.VelocityF64E08 < 0)
         {
             if (next_vehicle_on_train == SPRITE_INDEX_NULL)
             {
                 trackType = tileElement->AsTrack()->GetTrackType();
                 if (!(TrackFlags[trackType] & TRACK_ELEM_FLAG_DOWN))
                 {
-                    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_9;
+                    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_9;
                 }
             }
             SetUpdateFlag(VEHICLE_UPDATE_FLAG_ON_LIFT_HILL);
@@ -8497,9 +8737,9 @@ bool Vehicle::UpdateTrackMotionBackwardsGetNewTrack(uint16_t trackType, Ride* cu
             ClearUpdateFlag(VEHICLE_UPDATE_FLAG_ON_LIFT_HILL);
             if (next_vehicle_on_train == SPRITE_INDEX_NULL)
             {
-                if (_vehicleVelocityF64E08 < 0)
+                if (gVehicleMotion.VelocityF64E08 < 0)
                 {
-                    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_8;
+                    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_8;
                 }
             }
         }
@@ -8534,7 +8774,7 @@ loc_6DBA33:;
     uint16_t trackType = GetTrackType();
     if (trackType == TrackElemType::Flat && curRide->type == RIDE_TYPE_REVERSE_FREEFALL_COASTER)
     {
-        int32_t unkVelocity = _vehicleVelocityF64E08;
+        int32_t unkVelocity = gVehicleMotion.VelocityF64E08;
         if (unkVelocity < -524288)
         {
             unkVelocity = abs(unkVelocity);
@@ -8545,9 +8785,9 @@ loc_6DBA33:;
     if (trackType == TrackElemType::Brakes)
     {
         regs.eax = -(brake_speed << 16);
-        if (regs.eax > _vehicleVelocityF64E08)
+        if (regs.eax > gVehicleMotion.VelocityF64E08)
         {
-            regs.eax = _vehicleVelocityF64E08 * -16;
+            regs.eax = gVehicleMotion.VelocityF64E08 * -16;
             acceleration = regs.eax;
         }
     }
@@ -8556,7 +8796,7 @@ loc_6DBA33:;
     {
         regs.eax = get_booster_speed(curRide->type, (brake_speed << 16));
 
-        if (regs.eax < _vehicleVelocityF64E08)
+        if (regs.eax < gVehicleMotion.VelocityF64E08)
         {
             regs.eax = RideTypeDescriptors[curRide->type].OperatingSettings.BoosterAcceleration << 16;
             acceleration = regs.eax;
@@ -8582,21 +8822,21 @@ loc_6DBA33:;
             + CoordsXYZ{ moveInfo->x, moveInfo->y, moveInfo->z + RideTypeDescriptors[curRide->type].Heights.VehicleZOffset };
 
         regs.ebx = 0;
-        if (loc.x != unk_F64E20.x)
+        if (loc.x != gVehicleMotion.UnkF64E20.x)
         {
             regs.ebx |= 1;
         }
-        if (loc.y != unk_F64E20.y)
+        if (loc.y != gVehicleMotion.UnkF64E20.y)
         {
             regs.ebx |= 2;
         }
-        if (loc.z != unk_F64E20.z)
+        if (loc.z != gVehicleMotion.UnkF64E20.z)
         {
             regs.ebx |= 4;
         }
         remaining_distance += dword_9A2930[regs.ebx];
 
-        unk_F64E20 = loc;
+        gVehicleMotion.UnkF64E20 = loc;
         sprite_direction = moveInfo->direction;
         bank_rotation = moveInfo->bank_rotation;
         regs.ebx = moveInfo->vehicle_sprite_type;
@@ -8609,9 +8849,9 @@ loc_6DBA33:;
             SwingSpeed = 0;
         }
 
-        if (this == _vehicleFrontVehicle)
+        if (this == gVehicleMotion.FrontVehicle)
         {
-            if (_vehicleVelocityF64E08 < 0)
+            if (gVehicleMotion.VelocityF64E08 < 0)
             {
                 otherVehicleIndex = next_vehicle_on_ride;
                 if (UpdateMotionCollisionDetection(loc, &otherVehicleIndex))
@@ -8629,21 +8869,21 @@ loc_6DBA33:;
     }
     regs.ebx = dword_9A2970[regs.ebx];
     acceleration += regs.ebx;
-    _vehicleUnkF64E10++;
+    gVehicleMotion.UnkF64E10++;
     goto loc_6DBA33;
 
 loc_6DBE5E:
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-    _vehicleVelocityF64E0C -= remaining_distance - 0x368A;
+    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+    gVehicleMotion.VelocityF64E0C -= remaining_distance - 0x368A;
     remaining_distance = 0x368A;
     return false;
 
 loc_6DBE7F:
-    _vehicleVelocityF64E0C -= remaining_distance - 0x368A;
+    gVehicleMotion.VelocityF64E0C -= remaining_distance - 0x368A;
     remaining_distance = 0x368A;
 
     Vehicle* v3 = GetEntity<Vehicle>(otherVehicleIndex);
-    Vehicle* v4 = gCurrentVehicle;
+    Vehicle* v4 = gVehicleMotion.CurrentVehicle;
     if (v3 == nullptr)
     {
         return false;
@@ -8655,7 +8895,7 @@ loc_6DBE7F:
         {
             if (!(vehicleEntry->flags & VEHICLE_ENTRY_FLAG_BOAT_HIRE_COLLISION_DETECTION))
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
+                gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
             }
         }
     }
@@ -8663,14 +8903,14 @@ loc_6DBE7F:
     if (vehicleEntry->flags & VEHICLE_ENTRY_FLAG_GO_KART)
     {
         velocity -= velocity >> 2;
-        _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
+        gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
     }
     else
     {
         int32_t v3Velocity = v3->velocity;
         v3->velocity = v4->velocity >> 1;
         v4->velocity = v3Velocity >> 1;
-        _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
+        gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
     }
 
     return false;
@@ -8687,17 +8927,17 @@ void Vehicle::UpdateTrackMotionMiniGolfVehicle(Ride* curRide, rct_ride_entry* ri
     TileElement* tileElement = nullptr;
     CoordsXYZ trackPos;
 
-    _vehicleUnkF64E10 = 1;
+    gVehicleMotion.UnkF64E10 = 1;
     acceleration = dword_9A2970[vehicle_sprite_type];
-    remaining_distance = _vehicleVelocityF64E0C + remaining_distance;
+    remaining_distance = gVehicleMotion.VelocityF64E0C + remaining_distance;
     if (remaining_distance >= 0 && remaining_distance < 0x368A)
     {
         goto loc_6DCE02;
     }
     sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
-    unk_F64E20.x = x;
-    unk_F64E20.y = y;
-    unk_F64E20.z = z;
+    gVehicleMotion.UnkF64E20.x = x;
+    gVehicleMotion.UnkF64E20.y = y;
+    gVehicleMotion.UnkF64E20.z = z;
     Invalidate();
     if (remaining_distance < 0)
         goto loc_6DCA9A;
@@ -8955,7 +9195,7 @@ loc_6DC743:
         remaining_distance = 0;
     }
 
-    unk_F64E20 = trackPos;
+    gVehicleMotion.UnkF64E20 = trackPos;
     sprite_direction = moveInfo->direction;
     bank_rotation = moveInfo->bank_rotation;
     vehicle_sprite_type = moveInfo->vehicle_sprite_type;
@@ -8970,9 +9210,9 @@ loc_6DC743:
         }
     }
 
-    if (this == _vehicleFrontVehicle)
+    if (this == gVehicleMotion.FrontVehicle)
     {
-        if (_vehicleVelocityF64E08 >= 0)
+        if (gVehicleMotion.VelocityF64E08 >= 0)
         {
             otherVehicleIndex = prev_vehicle_on_ride;
             UpdateMotionCollisionDetection(trackPos, &otherVehicleIndex);
@@ -8993,12 +9233,12 @@ loc_6DC99A:
         goto loc_6DCDE4;
     }
     acceleration = dword_9A2970[vehicle_sprite_type];
-    _vehicleUnkF64E10++;
+    gVehicleMotion.UnkF64E10++;
     goto loc_6DC462;
 
 loc_6DC9BC:
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-    _vehicleVelocityF64E0C -= remaining_distance + 1;
+    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+    gVehicleMotion.VelocityF64E0C -= remaining_distance + 1;
     remaining_distance = -1;
     goto loc_6DCD2B;
 
@@ -9046,9 +9286,9 @@ loc_6DCA9A:
         ClearUpdateFlag(VEHICLE_UPDATE_FLAG_ON_LIFT_HILL);
         if (next_vehicle_on_train == SPRITE_INDEX_NULL)
         {
-            if (_vehicleVelocityF64E08 < 0)
+            if (gVehicleMotion.VelocityF64E08 < 0)
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_8;
+                gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_8;
             }
         }
     }
@@ -9070,7 +9310,7 @@ loc_6DCC2C:
         remaining_distance = 0;
     }
 
-    unk_F64E20 = trackPos;
+    gVehicleMotion.UnkF64E20 = trackPos;
     sprite_direction = moveInfo->direction;
     bank_rotation = moveInfo->bank_rotation;
     vehicle_sprite_type = moveInfo->vehicle_sprite_type;
@@ -9085,9 +9325,9 @@ loc_6DCC2C:
         }
     }
 
-    if (this == _vehicleFrontVehicle)
+    if (this == gVehicleMotion.FrontVehicle)
     {
-        if (_vehicleVelocityF64E08 >= 0)
+        if (gVehicleMotion.VelocityF64E08 >= 0)
         {
             otherVehicleIndex = var_44;
             if (UpdateMotionCollisionDetection(trackPos, &otherVehicleIndex))
@@ -9103,17 +9343,17 @@ loc_6DCD2B:
         goto loc_6DCDE4;
     }
     acceleration += dword_9A2970[vehicle_sprite_type];
-    _vehicleUnkF64E10++;
+    gVehicleMotion.UnkF64E10++;
     goto loc_6DCA9A;
 
 loc_6DCD4A:
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-    _vehicleVelocityF64E0C -= remaining_distance - 0x368A;
+    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+    gVehicleMotion.VelocityF64E0C -= remaining_distance - 0x368A;
     remaining_distance = 0x368A;
     goto loc_6DC99A;
 
 loc_6DCD6B:
-    _vehicleVelocityF64E0C -= remaining_distance - 0x368A;
+    gVehicleMotion.VelocityF64E0C -= remaining_distance - 0x368A;
     remaining_distance = 0x368A;
     {
         Vehicle* vEBP = GetEntity<Vehicle>(otherVehicleIndex);
@@ -9121,26 +9361,26 @@ loc_6DCD6B:
         {
             return;
         }
-        Vehicle* vEDI = gCurrentVehicle;
+        Vehicle* vEDI = gVehicleMotion.CurrentVehicle;
         if (abs(vEDI->velocity - vEBP->velocity) > 0xE0000)
         {
             if (!(vehicleEntry->flags & VEHICLE_ENTRY_FLAG_BOAT_HIRE_COLLISION_DETECTION))
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
+                gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
             }
         }
         vEDI->velocity = vEBP->velocity >> 1;
         vEBP->velocity = vEDI->velocity >> 1;
     }
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
+    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
     goto loc_6DC99A;
 
 loc_6DCDE4:
-    MoveTo(unk_F64E20);
+    MoveTo(gVehicleMotion.UnkF64E20);
     Invalidate();
 
 loc_6DCE02:
-    acceleration /= _vehicleUnkF64E10;
+    acceleration /= gVehicleMotion.UnkF64E10;
     if (TrackSubposition == VehicleTrackSubposition::ChairliftGoingBack)
     {
         return;
@@ -9151,17 +9391,17 @@ loc_6DCE02:
         {
             return;
         }
-        _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_3;
+        gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_3;
         if (trackType != TrackElemType::EndStation)
         {
             return;
         }
     }
-    if (this != gCurrentVehicle)
+    if (this != gVehicleMotion.CurrentVehicle)
     {
         return;
     }
-    if (_vehicleVelocityF64E08 < 0)
+    if (gVehicleMotion.VelocityF64E08 < 0)
     {
         if (track_progress > 11)
         {
@@ -9173,7 +9413,7 @@ loc_6DCE02:
         return;
     }
 
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
 
     for (int32_t i = 0; i < MAX_STATIONS; i++)
     {
@@ -9185,7 +9425,7 @@ loc_6DCE02:
         {
             continue;
         }
-        _vehicleStationIndex = i;
+        gVehicleMotion.Station = i;
     }
 }
 
@@ -9218,27 +9458,27 @@ int32_t Vehicle::UpdateTrackMotionMiniGolf(int32_t* outStation)
     rct_ride_entry* rideEntry = GetRideEntry();
     rct_ride_entry_vehicle* vehicleEntry = Entry();
 
-    gCurrentVehicle = this;
-    _vehicleMotionTrackFlags = 0;
+    gVehicleMotion.CurrentVehicle = this;
+    gVehicleMotion.TrackFlags = 0;
     velocity += acceleration;
-    _vehicleVelocityF64E08 = velocity;
-    _vehicleVelocityF64E0C = (velocity >> 10) * 42;
-    _vehicleFrontVehicle = _vehicleVelocityF64E08 < 0 ? TrainTail() : this;
+    gVehicleMotion.VelocityF64E08 = velocity;
+    gVehicleMotion.VelocityF64E0C = (velocity >> 10) * 42;
+    gVehicleMotion.FrontVehicle = gVehicleMotion.VelocityF64E08 < 0 ? TrainTail() : this;
 
-    for (Vehicle* vehicle = _vehicleFrontVehicle; vehicle != nullptr;)
+    for (Vehicle* vehicle = gVehicleMotion.FrontVehicle; vehicle != nullptr;)
     {
         vehicle->UpdateTrackMotionMiniGolfVehicle(curRide, rideEntry, vehicleEntry);
         if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_ON_LIFT_HILL))
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_ON_LIFT_HILL;
+            gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_ON_LIFT_HILL;
         }
-        if (_vehicleVelocityF64E08 >= 0)
+        if (gVehicleMotion.VelocityF64E08 >= 0)
         {
             vehicle = GetEntity<Vehicle>(vehicle->next_vehicle_on_train);
         }
         else
         {
-            if (vehicle == gCurrentVehicle)
+            if (vehicle == gVehicleMotion.CurrentVehicle)
             {
                 break;
             }
@@ -9320,8 +9560,8 @@ loc_6DD069:
     acceleration = newAcceleration;
 
     if (outStation != nullptr)
-        *outStation = _vehicleStationIndex;
-    return _vehicleMotionTrackFlags;
+        *outStation = gVehicleMotion.Station;
+    return gVehicleMotion.TrackFlags;
 }
 
 /**
@@ -9456,23 +9696,23 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
         return UpdateTrackMotionMiniGolf(outStation);
     }
 
-    _vehicleF64E2C = 0;
-    gCurrentVehicle = this;
-    _vehicleMotionTrackFlags = 0;
-    _vehicleStationIndex = STATION_INDEX_NULL;
+    gVehicleMotion.F64E2C = 0;
+    gVehicleMotion.CurrentVehicle = this;
+    gVehicleMotion.TrackFlags = 0;
+    gVehicleMotion.Station = STATION_INDEX_NULL;
 
     UpdateTrackMotionUpStopCheck();
     CheckAndApplyBlockSectionStopSite();
     UpdateVelocity();
 
     Vehicle* vehicle = this;
-    if (_vehicleVelocityF64E08 < 0)
+    if (gVehicleMotion.VelocityF64E08 < 0)
     {
         vehicle = vehicle->TrainTail();
     }
     // This will be the front vehicle even when traveling
     // backwards.
-    _vehicleFrontVehicle = vehicle;
+    gVehicleMotion.FrontVehicle = vehicle;
 
     uint16_t spriteId = vehicle->sprite_index;
     while (spriteId != SPRITE_INDEX_NULL)
@@ -9505,14 +9745,14 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
             car->UpdateAdditionalAnimation();
         }
         car->acceleration = dword_9A2970[car->vehicle_sprite_type];
-        _vehicleUnkF64E10 = 1;
+        gVehicleMotion.UnkF64E10 = 1;
 
-        car->remaining_distance += _vehicleVelocityF64E0C;
+        car->remaining_distance += gVehicleMotion.VelocityF64E0C;
 
         car->sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
-        unk_F64E20.x = car->x;
-        unk_F64E20.y = car->y;
-        unk_F64E20.z = car->z;
+        gVehicleMotion.UnkF64E20.x = car->x;
+        gVehicleMotion.UnkF64E20.y = car->y;
+        gVehicleMotion.UnkF64E20.z = car->z;
         car->Invalidate();
 
         while (true)
@@ -9532,7 +9772,7 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
                     }
                     regs.ebx = dword_9A2970[car->vehicle_sprite_type];
                     car->acceleration += regs.ebx;
-                    _vehicleUnkF64E10++;
+                    gVehicleMotion.UnkF64E10++;
                     continue;
                 }
             }
@@ -9553,12 +9793,12 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
                 }
                 regs.ebx = dword_9A2970[car->vehicle_sprite_type];
                 car->acceleration = regs.ebx;
-                _vehicleUnkF64E10++;
+                gVehicleMotion.UnkF64E10++;
                 continue;
             }
         }
         // loc_6DBF20
-        car->MoveTo(unk_F64E20);
+        car->MoveTo(gVehicleMotion.UnkF64E20);
         car->Invalidate();
 
     loc_6DBF3E:
@@ -9567,15 +9807,15 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
         // loc_6DC0F7
         if (car->HasUpdateFlag(VEHICLE_UPDATE_FLAG_ON_LIFT_HILL))
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_ON_LIFT_HILL;
+            gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_ON_LIFT_HILL;
         }
-        if (_vehicleVelocityF64E08 >= 0)
+        if (gVehicleMotion.VelocityF64E08 >= 0)
         {
             spriteId = car->next_vehicle_on_train;
         }
         else
         {
-            if (car == gCurrentVehicle)
+            if (car == gVehicleMotion.CurrentVehicle)
             {
                 break;
             }
@@ -9583,7 +9823,7 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
         }
     }
     // loc_6DC144
-    vehicle = gCurrentVehicle;
+    vehicle = gVehicleMotion.CurrentVehicle;
 
     vehicleEntry = vehicle->Entry();
     // eax
@@ -9604,7 +9844,7 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
         totalAcceleration += vehicle->acceleration;
     }
 
-    vehicle = gCurrentVehicle;
+    vehicle = gVehicleMotion.CurrentVehicle;
     int32_t newAcceleration = (totalAcceleration / numVehicles) * 21;
     if (newAcceleration < 0)
     {
@@ -9668,8 +9908,8 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
 
     // hook_setreturnregisters(&regs);
     if (outStation != nullptr)
-        *outStation = _vehicleStationIndex;
-    return _vehicleMotionTrackFlags;
+        *outStation = gVehicleMotion.Station;
+    return gVehicleMotion.TrackFlags;
 }
 
 rct_ride_entry* Vehicle::GetRideEntry() const
@@ -9710,6 +9950,12 @@ int32_t Vehicle::NumPeepsUntilTrainTail() const
  */
 void Vehicle::InvalidateWindow()
 {
+    if (_vehicleMotionJournal != nullptr)
+    {
+        _vehicleMotionJournal->WindowInvalidations.push_back(this);
+        return;
+    }
+
     auto intent = Intent(INTENT_ACTION_INVALIDATE_VEHICLE_WINDOW);
     intent.putExtra(INTENT_EXTRA_VEHICLE, this);
     context_broadcast_intent(&intent);
@@ -9769,6 +10015,8 @@ void Vehicle::UpdateCrossings() const
             if (pathElement && curRide != nullptr
                 && RideTypeDescriptors[curRide->type].HasFlag(RIDE_TYPE_FLAG_SUPPORTS_LEVEL_CROSSINGS))
             {
+                // Guests and other rides use the same footpaths.
+                vehicle_motion_require_serial();
                 if (!playedClaxon && !pathElement->IsBlockedByVehicle())
                 {
                     Claxon();
@@ -9836,6 +10084,7 @@ void Vehicle::UpdateCrossings() const
             auto* pathElement = map_get_path_element_at(TileCoordsXYZ(CoordsXYZ{ xyElement, xyElement.element->GetBaseZ() }));
             if (pathElement)
             {
+                vehicle_motion_require_serial();
                 pathElement->SetIsBlockedByVehicle(false);
             }
         }
@@ -9890,6 +10139,7 @@ void Vehicle::SetState(Vehicle::Status vehicleStatus, uint8_t subState)
 {
     status = vehicleStatus;
     sub_state = subState;
+    sprite_checksum_invalidate(this);
     InvalidateWindow();
 }
 
@@ -135,6 +135,7 @@ enum class VehicleTrackSubposition : uint8_t
 
 struct Ride;
 struct rct_ride_entry;
+struct rct_viewport;
 
 struct GForces
 {
@@ -625,14 +626,54 @@ Vehicle* try_get_vehicle(uint16_t spriteIndex);
 void vehicle_update_all();
 void vehicle_sounds_update();
 
-extern Vehicle* gCurrentVehicle;
-extern StationIndex _vehicleStationIndex;
-extern uint32_t _vehicleMotionTrackFlags;
-extern int32_t _vehicleVelocityF64E08;
-extern int32_t _vehicleVelocityF64E0C;
-extern int32_t _vehicleUnkF64E10;
-extern uint8_t _vehicleF64E2C;
-extern Vehicle* _vehicleFrontVehicle;
-extern CoordsXYZ unk_F64E20;
+/**
+ * State the track motion functions share while one train is updated. Every thread has its own, so trains of different
+ * rides can be moved at the same time.
+ */
+struct VehicleMotionContext
+{
+    Vehicle* CurrentVehicle;
+    uint8_t Breakdown;
+    StationIndex Station;
+    uint32_t TrackFlags;
+    int32_t VelocityF64E08;
+    int32_t VelocityF64E0C;
+    int32_t UnkF64E10;
+    uint8_t F64E2C;
+    Vehicle* FrontVehicle;
+    CoordsXYZ UnkF64E20;
+};
+
+extern thread_local VehicleMotionContext gVehicleMotion;
+
+/**
+ * With parallel_ride_motion, vehicle_update_all updates the travelling trains of each ride on worker threads first.
+ * Their moves in the sprite spatial index, viewport invalidations and sounds are kept in a journal that is committed in
+ * train order afterwards. A train that reaches anything else shared between rides, such as scenario_rand, creating
+ * sprites or the guests, is put back the way it was and updated in order on the main thread instead.
+ */
+bool vehicle_motion_is_speculative();
+
+/**
+ * Called before touching state that is shared between rides, abandons the update of the train when it runs ahead.
+ */
+void vehicle_motion_require_serial();
+
+// Return true when the call has been journaled for the commit of the train running ahead.
+bool vehicle_motion_defer_spatial_move(SpriteBase* sprite);
+bool vehicle_motion_defer_checksum_invalidate(const SpriteBase* sprite);
+bool vehicle_motion_defer_viewport_invalidate(rct_viewport* viewport, int32_t left, int32_t top, int32_t right, int32_t bottom);
+bool vehicle_motion_defer_sound(OpenRCT2::Audio::SoundId soundId, const CoordsXYZ& loc);
+
+struct VehicleMotionStats
+{
+    // Train updates, the ones run ahead on worker threads and the ones of those that had to be updated again in order.
+    uint64_t Trains;
+    uint64_t Speculated;
+    uint64_t Aborted;
+};
+
+// Counted on the main thread only, reset by whoever reports them.
+extern VehicleMotionStats gVehicleMotionStats;
 
 #endif
@@ -37,6 +37,7 @@
 #include "../rct12/RCT12.h"
 #include "../ride/Ride.h"
 #include "../ride/Track.h"
+#include "../ride/Vehicle.h"
 #include "../util/SawyerCoding.h"
 #include "../util/Util.h"
 #include "../windows/Intent.h"
@@ -51,6 +52,7 @@
 
 #include <algorithm>
 #include <bitset>
+#include <vector>
 
 const rct_string_id ScenarioCategoryStringIds[SCENARIO_CATEGORY_COUNT] = {
     STR_BEGINNER_PARKS, STR_CHALLENGING_PARKS,    STR_EXPERT_PARKS, STR_REAL_PARKS, STR_OTHER_PARKS,
@@ -425,8 +427,8 @@ bool scenario_create_ducks()
     constexpr int32_t SquareRadiusSize = SquareCentre * 32;
 
     CoordsXY centrePos;
-    centrePos.x = SquareRadiusSize + (scenario_rand_max(MAXIMUM_MAP_SIZE_TECHNICAL - SquareCentre) * 32);
-    centrePos.y = SquareRadiusSize + (scenario_rand_max(MAXIMUM_MAP_SIZE_TECHNICAL - SquareCentre) * 32);
+    centrePos.x = SquareRadiusSize + (scenario_rand_max(gMapSizeTechnical - SquareCentre) * 32);
+    centrePos.y = SquareRadiusSize + (scenario_rand_max(gMapSizeTechnical - SquareCentre) * 32);
 
     Guard::Assert(map_is_location_valid(centrePos));
 
@@ -502,6 +504,8 @@ void scenario_rand_seed(random_engine_t::result_type s0, random_engine_t::result
  */
 random_engine_t::result_type scenario_rand()
 {
+    // The numbers have to be drawn in train order.
+    vehicle_motion_require_serial();
     return gScenarioRand();
 }
 
@@ -616,19 +620,20 @@ bool scenario_prepare_for_save()
  * Modifies the given S6 data so that ghost elements, rides with no track elements or unused banners / user strings are saved.
  */
 void scenario_fix_ghosts(rct_s6_data* s6)
+{
+    scenario_remove_ghost_elements(s6, s6->tile_elements, MAXIMUM_MAP_SIZE_TECHNICAL);
+}
+
+size_t scenario_remove_ghost_elements(rct_s6_data* s6, RCT12TileElement* elements, int32_t mapSize)
 {
     // Build tile pointer cache (needed to get the first element at a certain location)
-    RCT12TileElement* tilePointers[MAX_TILE_TILE_ELEMENT_POINTERS];
-    for (size_t i = 0; i < MAX_TILE_TILE_ELEMENT_POINTERS; i++)
-    {
-        tilePointers[i] = TILE_UNDEFINED_TILE_ELEMENT;
-    }
+    std::vector<RCT12TileElement*> tilePointers(static_cast<size_t>(mapSize) * mapSize, TILE_UNDEFINED_TILE_ELEMENT);
 
-    RCT12TileElement* tileElement = s6->tile_elements;
-    RCT12TileElement** tile = tilePointers;
-    for (size_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    RCT12TileElement* tileElement = elements;
+    RCT12TileElement** tile = tilePointers.data();
+    for (int32_t y = 0; y < mapSize; y++)
     {
-        for (size_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        for (int32_t x = 0; x < mapSize; x++)
         {
             *tile++ = tileElement;
             while (!(tileElement++)->IsLastForTile())
@@ -637,14 +642,14 @@ void scenario_fix_ghosts(rct_s6_data* s6)
     }
 
     // Remove all ghost elements
-    RCT12TileElement* destinationElement = s6->tile_elements;
+    RCT12TileElement* destinationElement = elements;
 
-    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    for (int32_t y = 0; y < mapSize; y++)
     {
-        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        for (int32_t x = 0; x < mapSize; x++)
         {
             // This is the equivalent of map_get_first_element_at(x, y), but on S6 data.
-            RCT12TileElement* originalElement = tilePointers[x + y * MAXIMUM_MAP_SIZE_TECHNICAL];
+            RCT12TileElement* originalElement = tilePointers[x + static_cast<size_t>(y) * mapSize];
             do
             {
                 if (originalElement->IsGhost())
@@ -671,6 +676,7 @@ void scenario_fix_ghosts(rct_s6_data* s6)
             (destinationElement - 1)->flags |= TILE_ELEMENT_FLAG_LAST_TILE;
         }
     }
+    return static_cast<size_t>(destinationElement - elements);
 }
 
 static void ride_all_has_any_track_elements(std::array<bool, RCT12_MAX_RIDES_IN_PARK>& rideIndexArray)
@@ -25,6 +25,8 @@
 #include "../world/MapAnimation.h"
 #include "../world/Sprite.h"
 
+#include <functional>
+
 using random_engine_t = Random::Rct2::Engine;
 
 struct ParkLoadResult;
@@ -298,6 +300,55 @@ struct rct_s6_data
     uint8_t pad_13CE778[434];
 };
 assert_struct_size(rct_s6_data, 0x46b44a);
+
+/**
+ * Maps larger than MAXIMUM_MAP_SIZE_TECHNICAL do not fit the RCT2 chunks, which then hold an empty map of the largest
+ * size they can. These chunks follow them before the checksum: the header, the elements of all tiles in rows split into
+ * chunks of S6_EXTENDED_MAP_ELEMENTS_PER_CHUNK and the locations RCT2 stores in 8 bits.
+ */
+struct rct_s6_extended_map_header
+{
+    uint32_t magic_number;
+    uint16_t map_size;
+    uint16_t map_size_technical;
+    uint32_t grass_and_scenery_tilepos;
+    uint32_t num_tile_elements;
+};
+assert_struct_size(rct_s6_extended_map_header, 16);
+
+// Tile coordinates, an x of RCT12_EXTENDED_XY_UNDEFINED is a null location.
+struct rct_s6_extended_xy
+{
+    uint16_t x;
+    uint16_t y;
+};
+assert_struct_size(rct_s6_extended_xy, 4);
+
+struct rct_s6_extended_ride
+{
+    rct_s6_extended_xy overall_view;
+    rct_s6_extended_xy station_starts[RCT12_MAX_STATIONS_PER_RIDE];
+    rct_s6_extended_xy entrances[RCT12_MAX_STATIONS_PER_RIDE];
+    rct_s6_extended_xy exits[RCT12_MAX_STATIONS_PER_RIDE];
+    rct_s6_extended_xy boat_hire_return_position;
+    rct_s6_extended_xy cur_test_track_location;
+    rct_s6_extended_xy chairlift_bullwheel_location[2];
+};
+assert_struct_size(rct_s6_extended_ride, 68);
+
+struct rct_s6_extended_sprite
+{
+    // The boat location of vehicles, the pathfinding goal followed by the pathfinding history of peeps.
+    rct_s6_extended_xy locations[5];
+};
+assert_struct_size(rct_s6_extended_sprite, 20);
+
+struct rct_s6_extended_locations
+{
+    rct_s6_extended_ride rides[RCT12_MAX_RIDES_IN_PARK];
+    rct_s6_extended_xy banners[RCT2_MAX_BANNERS_IN_PARK];
+    rct_s6_extended_sprite sprites[RCT2_MAX_SPRITES];
+};
 #pragma pack(pop)
 
 enum
@@ -315,6 +366,9 @@ enum
 
 #define S6_RCT2_VERSION 120001
 #define S6_MAGIC_NUMBER 0x00031144
+#define S6_EXTENDED_MAP_MAGIC_NUMBER 0x5850414D // MAPX
+#define S6_EXTENDED_MAP_ELEMENTS_PER_CHUNK 0x80000
+#define RCT12_EXTENDED_XY_UNDEFINED 0xFFFF
 
 enum
 {
@@ -457,9 +511,26 @@ random_engine_t::result_type scenario_rand();
 uint32_t scenario_rand_max(uint32_t max);
 
 bool scenario_prepare_for_save();
+/**
+ * Waits for the background saves to finish first, they may be writing the same file.
+ */
 int32_t scenario_save(const utf8* path, int32_t flags);
+
+/**
+ * Saves like scenario_save but only exports the park on the calling thread, encoding and writing the file happens on a
+ * background thread. The file is written under a temporary name and only replaces the old one once it is complete.
+ * Saves finish in the order they were started, callback is called from scenario_save_update.
+ */
+void scenario_save_async(const utf8* path, int32_t flags, std::function<void(bool)> callback);
+void scenario_save_update();
+void scenario_save_wait();
 void scenario_remove_trackless_rides(rct_s6_data* s6);
 void scenario_fix_ghosts(rct_s6_data* s6);
+/**
+ * Removes the ghost elements from elements, which hold mapSize * mapSize tiles in rows, and frees their banners in s6.
+ * Returns the number of elements that are left.
+ */
+size_t scenario_remove_ghost_elements(rct_s6_data* s6, RCT12TileElement* elements, int32_t mapSize);
 void scenario_failure();
 void scenario_success();
 void scenario_success_submit_name(const char* name);
@@ -50,6 +50,7 @@ uint32_t HookEngine::Subscribe(HOOK_TYPE type, std::shared_ptr<Plugin> owner, co
     auto cookie = _nextCookie++;
     Hook hook(cookie, owner, function);
     hookList.Hooks.push_back(hook);
+    InvalidateFunctions(hookList);
     return cookie;
 }
 
@@ -62,6 +63,7 @@ void HookEngine::Unsubscribe(HOOK_TYPE type, uint32_t cookie)
         if (it->Cookie == cookie)
         {
             hooks.erase(it);
+            InvalidateFunctions(hookList);
             break;
         }
     }
@@ -74,6 +76,7 @@ void HookEngine::UnsubscribeAll(std::shared_ptr<const Plugin> owner)
         auto& hooks = hookList.Hooks;
         auto isOwner = [&](auto& obj) { return obj.Owner == owner; };
         hooks.erase(std::remove_if(hooks.begin(), hooks.end(), isOwner), hooks.end());
+        InvalidateFunctions(hookList);
     }
 }
 
@@ -83,6 +86,7 @@ void HookEngine::UnsubscribeAll()
     {
         auto& hooks = hookList.Hooks;
         hooks.clear();
+        InvalidateFunctions(hookList);
     }
 }
 
@@ -95,54 +99,114 @@ bool HookEngine::HasSubscriptions(HOOK_TYPE type) const
 void HookEngine::Call(HOOK_TYPE type, bool isGameStateMutable)
 {
     auto& hookList = GetHookList(type);
-    for (auto& hook : hookList.Hooks)
-    {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, {}, isGameStateMutable);
-    }
+    if (hookList.Hooks.empty())
+        return;
+
+    CallHooks(hookList, 0, isGameStateMutable);
 }
 
 void HookEngine::Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable)
 {
     auto& hookList = GetHookList(type);
-    for (auto& hook : hookList.Hooks)
-    {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable);
-    }
+    if (hookList.Hooks.empty())
+        return;
+
+    auto ctx = _scriptEngine.GetContext();
+    arg.push();
+    CallHooks(hookList, 1, isGameStateMutable);
+    duk_pop(ctx);
 }
 
 void HookEngine::Call(
     HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable)
 {
     auto& hookList = GetHookList(type);
-    for (auto& hook : hookList.Hooks)
-    {
-        auto ctx = _scriptEngine.GetContext();
+    if (hookList.Hooks.empty())
+        return;
 
-        // Convert key/value pairs into an object
-        auto objIdx = duk_push_object(ctx);
-        for (const auto& arg : args)
+    auto ctx = _scriptEngine.GetContext();
+
+    // Convert key/value pairs into an object, every hook gets the same one.
+    auto objIdx = duk_push_object(ctx);
+    for (const auto& arg : args)
+    {
+        if (arg.second.type() == typeid(int32_t))
         {
-            if (arg.second.type() == typeid(int32_t))
-            {
-                auto val = std::any_cast<int32_t>(arg.second);
-                duk_push_int(ctx, val);
-            }
-            else if (arg.second.type() == typeid(std::string))
-            {
-                const auto& val = std::any_cast<std::string>(arg.second);
-                duk_push_string(ctx, val.c_str());
-            }
-            else
-            {
-                throw std::runtime_error("Not implemented");
-            }
-            duk_put_prop_string(ctx, objIdx, arg.first.data());
+            auto val = std::any_cast<int32_t>(arg.second);
+            duk_push_int(ctx, val);
         }
+        else if (arg.second.type() == typeid(std::string))
+        {
+            const auto& val = std::any_cast<std::string>(arg.second);
+            duk_push_string(ctx, val.c_str());
+        }
+        else
+        {
+            duk_pop(ctx);
+            throw std::runtime_error("Not implemented");
+        }
+        duk_put_prop_string(ctx, objIdx, arg.first.data());
+    }
+
+    CallHooks(hookList, 1, isGameStateMutable);
+    duk_pop(ctx);
+}
 
-        std::vector<DukValue> dukArgs;
-        dukArgs.push_back(DukValue::take_from_stack(ctx));
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, dukArgs, isGameStateMutable);
+void HookEngine::InvalidateFunctions(HookList& hookList)
+{
+    hookList.Functions = DukValue();
+    hookList.Version++;
+}
+
+void HookEngine::PushFunctions(HookList& hookList)
+{
+    if (hookList.Functions.type() == DukValue::Type::OBJECT)
+    {
+        hookList.Functions.push();
+        return;
+    }
+
+    auto ctx = _scriptEngine.GetContext();
+    auto arrayIdx = duk_push_array(ctx);
+    for (size_t i = 0; i < hookList.Hooks.size(); i++)
+    {
+        hookList.Hooks[i].Function.push();
+        duk_put_prop_index(ctx, arrayIdx, static_cast<duk_uarridx_t>(i));
+    }
+    hookList.Functions = DukValue::copy_from_stack(ctx, arrayIdx);
+}
+
+/**
+ * Calls every hook with the numArgs values on top of the stack as arguments, the values are left on the stack.
+ */
+void HookEngine::CallHooks(HookList& hookList, duk_idx_t numArgs, bool isGameStateMutable)
+{
+    auto ctx = _scriptEngine.GetContext();
+    auto argsIdx = duk_get_top(ctx) - numArgs;
+
+    PushFunctions(hookList);
+    auto functionsIdx = duk_get_top_index(ctx);
+    auto version = hookList.Version;
+    bool canThrottle = hookList.Type == HOOK_TYPE::INTERVAL_TICK;
+
+    // Hooks can subscribe or unsubscribe hooks, the array is only used until they do.
+    for (size_t i = 0; i < hookList.Hooks.size(); i++)
+    {
+        auto owner = hookList.Hooks[i].Owner;
+        if (canThrottle && owner->IsThrottled())
+            continue;
+
+        if (hookList.Version == version)
+            duk_get_prop_index(ctx, functionsIdx, static_cast<duk_uarridx_t>(i));
+        else
+            hookList.Hooks[i].Function.push();
+        for (duk_idx_t j = 0; j < numArgs; j++)
+        {
+            duk_dup(ctx, argsIdx + j);
+        }
+        _scriptEngine.ExecutePluginCall(owner, numArgs, isGameStateMutable);
     }
+    duk_pop(ctx);
 }
 
 HookList& HookEngine::GetHookList(HOOK_TYPE type)
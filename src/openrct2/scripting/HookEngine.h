@@ -64,6 +64,10 @@ namespace OpenRCT2::Scripting
         HOOK_TYPE Type{};
         std::vector<Hook> Hooks;
 
+        // Array of the hook functions, built on the first call after the hooks change.
+        DukValue Functions;
+        uint32_t Version{};
+
         HookList() = default;
         HookList(const HookList&) = delete;
         HookList(HookList&& src) = default;
@@ -90,6 +94,9 @@ namespace OpenRCT2::Scripting
             HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable);
 
     private:
+        void InvalidateFunctions(HookList& hookList);
+        void PushFunctions(HookList& hookList);
+        void CallHooks(HookList& hookList, duk_idx_t numArgs, bool isGameStateMutable);
         HookList& GetHookList(HOOK_TYPE type);
         const HookList& GetHookList(HOOK_TYPE type) const;
     };
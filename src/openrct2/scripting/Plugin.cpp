@@ -100,6 +100,28 @@ void Plugin::Stop()
     _hasStarted = false;
 }
 
+/**
+ * The time over the budget is carried over to the next ticks, the plugin is throttled until it has been paid back. A
+ * budget of 0 never throttles.
+ */
+void Plugin::EndTick(std::chrono::nanoseconds budget)
+{
+    _tickTimeSpent = _timeSpent - _tickStartTimeSpent;
+    _tickStartTimeSpent = _timeSpent;
+
+    if (budget.count() <= 0)
+    {
+        _overBudget = {};
+        return;
+    }
+
+    _overBudget = std::max(_overBudget + _tickTimeSpent - budget, std::chrono::nanoseconds::zero());
+    if (IsThrottled())
+    {
+        _throttledTicks++;
+    }
+}
+
 void Plugin::LoadCodeFromFile()
 {
     _code = File::ReadAllText(_path);
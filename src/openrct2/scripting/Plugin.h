@@ -13,6 +13,7 @@
 
 #    include "Duktape.hpp"
 
+#    include <chrono>
 #    include <memory>
 #    include <string>
 #    include <string_view>
@@ -53,6 +54,11 @@ namespace OpenRCT2::Scripting
         PluginMetadata _metadata{};
         std::string _code;
         bool _hasStarted{};
+        std::chrono::nanoseconds _timeSpent{};
+        std::chrono::nanoseconds _tickStartTimeSpent{};
+        std::chrono::nanoseconds _tickTimeSpent{};
+        std::chrono::nanoseconds _overBudget{};
+        uint32_t _throttledTicks{};
 
     public:
         std::string GetPath() const
@@ -80,6 +86,31 @@ namespace OpenRCT2::Scripting
             return _hasStarted;
         }
 
+        std::chrono::nanoseconds GetTimeSpent() const
+        {
+            return _timeSpent;
+        }
+
+        std::chrono::nanoseconds GetTickTimeSpent() const
+        {
+            return _tickTimeSpent;
+        }
+
+        uint32_t GetThrottledTicks() const
+        {
+            return _throttledTicks;
+        }
+
+        bool IsThrottled() const
+        {
+            return _overBudget.count() > 0;
+        }
+
+        void AddTimeSpent(std::chrono::nanoseconds time)
+        {
+            _timeSpent += time;
+        }
+
         Plugin() = default;
         Plugin(duk_context* context, const std::string& path);
         Plugin(const Plugin&) = delete;
@@ -89,6 +120,7 @@ namespace OpenRCT2::Scripting
         void Load();
         void Start();
         void Stop();
+        void EndTick(std::chrono::nanoseconds budget);
 
     private:
         void LoadCodeFromFile();
@@ -16,6 +16,7 @@
 #    include "../peep/Peep.h"
 #    include "../peep/Staff.h"
 #    include "../util/Util.h"
+#    include "../world/ParkAggregates.h"
 #    include "../world/Sprite.h"
 #    include "Duktape.hpp"
 #    include "ScRide.hpp"
@@ -690,6 +691,7 @@ namespace OpenRCT2::Scripting
                     peep->PeepFlags |= mask;
                 else
                     peep->PeepFlags &= ~mask;
+                park_aggregates_update_guest(peep);
                 peep->Invalidate();
             }
         }
@@ -888,6 +890,7 @@ namespace OpenRCT2::Scripting
             if (peep != nullptr)
             {
                 peep->Happiness = value;
+                park_aggregates_update_guest(peep);
             }
         }
 
@@ -19,8 +19,83 @@
 #    include "ScRide.hpp"
 #    include "ScTile.hpp"
 
+#    include <algorithm>
+#    include <optional>
+
 namespace OpenRCT2::Scripting
 {
+    enum class DukArrayType
+    {
+        Uint8,
+        Uint16,
+        Uint32,
+        Int32,
+    };
+
+    /**
+     * A field of the bulk queries, read into a typed array for all entities or tile elements at once.
+     */
+    template<typename T> struct ScMapDataField
+    {
+        const char* Name;
+        DukArrayType ArrayType;
+        SpriteIdentifier Identifier; // Entities only, SpriteIdentifier::Null for fields every entity has.
+        int32_t (*Read)(const T& item);
+    };
+
+    static int32_t ReadPeepCurrentRide(const SpriteBase& entity)
+    {
+        const auto& peep = static_cast<const Peep&>(entity);
+        switch (peep.State)
+        {
+            case PeepState::QueuingFront:
+            case PeepState::OnRide:
+            case PeepState::LeavingRide:
+            case PeepState::Queuing:
+            case PeepState::EnteringRide:
+                return peep.CurrentRide;
+            default:
+                return RIDE_ID_NULL;
+        }
+    }
+
+    static const ScMapDataField<SpriteBase> EntityDataFields[] = {
+        { "id", DukArrayType::Uint16, SpriteIdentifier::Null, [](const SpriteBase& e) -> int32_t { return e.sprite_index; } },
+        { "x", DukArrayType::Int32, SpriteIdentifier::Null, [](const SpriteBase& e) -> int32_t { return e.x; } },
+        { "y", DukArrayType::Int32, SpriteIdentifier::Null, [](const SpriteBase& e) -> int32_t { return e.y; } },
+        { "z", DukArrayType::Int32, SpriteIdentifier::Null, [](const SpriteBase& e) -> int32_t { return e.z; } },
+        { "energy", DukArrayType::Uint8, SpriteIdentifier::Peep,
+          [](const SpriteBase& e) -> int32_t { return static_cast<const Peep&>(e).Energy; } },
+        { "happiness", DukArrayType::Uint8, SpriteIdentifier::Peep,
+          [](const SpriteBase& e) -> int32_t { return static_cast<const Peep&>(e).Happiness; } },
+        { "nausea", DukArrayType::Uint8, SpriteIdentifier::Peep,
+          [](const SpriteBase& e) -> int32_t { return static_cast<const Peep&>(e).Nausea; } },
+        { "hunger", DukArrayType::Uint8, SpriteIdentifier::Peep,
+          [](const SpriteBase& e) -> int32_t { return static_cast<const Peep&>(e).Hunger; } },
+        { "thirst", DukArrayType::Uint8, SpriteIdentifier::Peep,
+          [](const SpriteBase& e) -> int32_t { return static_cast<const Peep&>(e).Thirst; } },
+        { "toilet", DukArrayType::Uint8, SpriteIdentifier::Peep,
+          [](const SpriteBase& e) -> int32_t { return static_cast<const Peep&>(e).Toilet; } },
+        { "cash", DukArrayType::Int32, SpriteIdentifier::Peep,
+          [](const SpriteBase& e) -> int32_t { return static_cast<const Peep&>(e).CashInPocket; } },
+        { "currentRide", DukArrayType::Uint16, SpriteIdentifier::Peep, ReadPeepCurrentRide },
+        { "ride", DukArrayType::Uint16, SpriteIdentifier::Vehicle,
+          [](const SpriteBase& e) -> int32_t { return static_cast<const Vehicle&>(e).ride; } },
+        { "velocity", DukArrayType::Int32, SpriteIdentifier::Vehicle,
+          [](const SpriteBase& e) -> int32_t { return static_cast<const Vehicle&>(e).velocity; } },
+    };
+
+    static const ScMapDataField<TileElement> TileElementDataFields[] = {
+        { "type", DukArrayType::Uint8, SpriteIdentifier::Null,
+          [](const TileElement& el) -> int32_t { return el.GetType() >> 2; } },
+        { "baseHeight", DukArrayType::Uint8, SpriteIdentifier::Null,
+          [](const TileElement& el) -> int32_t { return el.base_height; } },
+        { "clearanceHeight", DukArrayType::Uint8, SpriteIdentifier::Null,
+          [](const TileElement& el) -> int32_t { return el.clearance_height; } },
+        { "direction", DukArrayType::Uint8, SpriteIdentifier::Null,
+          [](const TileElement& el) -> int32_t { return el.GetDirection(); } },
+    };
+
     class ScMap
     {
     private:
@@ -98,79 +173,223 @@ namespace OpenRCT2::Scripting
 
         std::vector<DukValue> getAllEntities(const std::string& type) const
         {
-            EntityListId targetList{};
-            uint8_t targetType{};
-            if (type == "balloon")
+            auto query = GetEntityQuery(type);
+            if (!query)
             {
-                targetList = EntityListId::Misc;
-                targetType = SPRITE_MISC_BALLOON;
+                duk_error(_context, DUK_ERR_ERROR, "Invalid entity type.");
             }
-            if (type == "car")
+
+            std::vector<DukValue> result;
+            for (auto sprite : GetEntities(*query))
             {
-                targetList = EntityListId::TrainHead;
+                result.push_back(GetEntityAsDukValue(sprite));
             }
-            else if (type == "litter")
+            return result;
+        }
+
+        DukValue getEntityData(const std::string& type, const std::vector<std::string>& fields) const
+        {
+            // duk_error does not unwind the stack, so everything is checked before any local that needs destroying.
+            auto ctx = _context;
+            auto query = GetEntityQuery(type);
+            if (!query)
             {
-                targetList = EntityListId::Litter;
+                duk_error(ctx, DUK_ERR_ERROR, "Invalid entity type.");
             }
-            else if (type == "duck")
+            for (const auto& name : fields)
             {
-                targetList = EntityListId::Misc;
-                targetType = SPRITE_MISC_DUCK;
+                auto field = FindDataField(EntityDataFields, name);
+                if (field == nullptr || (field->Identifier != SpriteIdentifier::Null && field->Identifier != query->Identifier))
+                {
+                    duk_error(ctx, DUK_ERR_ERROR, "Invalid entity field '%s'.", name.c_str());
+                }
             }
-            else if (type == "peep")
+
+            PushEntityData(*query, fields);
+            return DukValue::take_from_stack(ctx);
+        }
+
+        DukValue getTileElementData(int32_t x, int32_t y, int32_t width, int32_t height, const std::vector<std::string>& fields)
+            const
+        {
+            // duk_error does not unwind the stack, so everything is checked before any local that needs destroying.
+            auto ctx = _context;
+            if (x < 0 || y < 0 || width < 0 || height < 0 || static_cast<int64_t>(x) + width > gMapSizeTechnical
+                || static_cast<int64_t>(y) + height > gMapSizeTechnical)
             {
-                targetList = EntityListId::Peep;
+                duk_error(ctx, DUK_ERR_RANGE_ERROR, "Invalid map range.");
             }
-            else
+            for (const auto& name : fields)
             {
-                duk_error(_context, DUK_ERR_ERROR, "Invalid entity type.");
+                if (FindDataField(TileElementDataFields, name) == nullptr)
+                {
+                    duk_error(ctx, DUK_ERR_ERROR, "Invalid tile element field '%s'.", name.c_str());
+                }
             }
 
-            std::vector<DukValue> result;
-            for (auto sprite : EntityList(targetList))
+            PushTileElementData(x, y, width, height, fields);
+            return DukValue::take_from_stack(ctx);
+        }
+
+        static void Register(duk_context* ctx)
+        {
+            dukglue_register_property(ctx, &ScMap::size_get, nullptr, "size");
+            dukglue_register_property(ctx, &ScMap::numRides_get, nullptr, "numRides");
+            dukglue_register_property(ctx, &ScMap::numEntities_get, nullptr, "numEntities");
+            dukglue_register_property(ctx, &ScMap::rides_get, nullptr, "rides");
+            dukglue_register_method(ctx, &ScMap::getRide, "getRide");
+            dukglue_register_method(ctx, &ScMap::getTile, "getTile");
+            dukglue_register_method(ctx, &ScMap::getEntity, "getEntity");
+            dukglue_register_method(ctx, &ScMap::getAllEntities, "getAllEntities");
+            dukglue_register_method(ctx, &ScMap::getEntityData, "getEntityData");
+            dukglue_register_method(ctx, &ScMap::getTileElementData, "getTileElementData");
+        }
+
+    private:
+        struct EntityQuery
+        {
+            EntityListId List;
+            SpriteIdentifier Identifier;
+            uint8_t Type;
+        };
+
+        static std::optional<EntityQuery> GetEntityQuery(const std::string& type)
+        {
+            if (type == "balloon")
+                return EntityQuery{ EntityListId::Misc, SpriteIdentifier::Misc, SPRITE_MISC_BALLOON };
+            if (type == "car")
+                return EntityQuery{ EntityListId::TrainHead, SpriteIdentifier::Vehicle, 0 };
+            if (type == "litter")
+                return EntityQuery{ EntityListId::Litter, SpriteIdentifier::Litter, 0 };
+            if (type == "duck")
+                return EntityQuery{ EntityListId::Misc, SpriteIdentifier::Misc, SPRITE_MISC_DUCK };
+            if (type == "peep")
+                return EntityQuery{ EntityListId::Peep, SpriteIdentifier::Peep, 0 };
+            return std::nullopt;
+        }
+
+        std::vector<const SpriteBase*> GetEntities(const EntityQuery& query) const
+        {
+            std::vector<const SpriteBase*> result;
+            for (auto sprite : EntityList(query.List))
             {
                 // Only the misc list checks the type property
-                if (targetList != EntityListId::Misc || sprite->type == targetType)
+                if (query.List != EntityListId::Misc || sprite->type == query.Type)
                 {
-                    if (targetList == EntityListId::Peep)
-                    {
-                        if (sprite->Is<Staff>())
-                            result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScStaff>(sprite->sprite_index)));
-                        else
-                            result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScGuest>(sprite->sprite_index)));
-                    }
-                    else if (targetList == EntityListId::TrainHead)
+                    if (query.List == EntityListId::TrainHead)
                     {
                         for (auto carId = sprite->sprite_index; carId != SPRITE_INDEX_NULL;)
                         {
                             auto car = GetEntity<Vehicle>(carId);
-                            result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScVehicle>(carId)));
+                            result.push_back(car);
                             carId = car->next_vehicle_on_train;
                         }
                     }
                     else
                     {
-                        result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScEntity>(sprite->sprite_index)));
+                        result.push_back(sprite);
                     }
                 }
             }
             return result;
         }
 
-        static void Register(duk_context* ctx)
+        // Pushes the data object, the fields must have been checked.
+        void PushEntityData(const EntityQuery& query, const std::vector<std::string>& fields) const
         {
-            dukglue_register_property(ctx, &ScMap::size_get, nullptr, "size");
-            dukglue_register_property(ctx, &ScMap::numRides_get, nullptr, "numRides");
-            dukglue_register_property(ctx, &ScMap::numEntities_get, nullptr, "numEntities");
-            dukglue_register_property(ctx, &ScMap::rides_get, nullptr, "rides");
-            dukglue_register_method(ctx, &ScMap::getRide, "getRide");
-            dukglue_register_method(ctx, &ScMap::getTile, "getTile");
-            dukglue_register_method(ctx, &ScMap::getEntity, "getEntity");
-            dukglue_register_method(ctx, &ScMap::getAllEntities, "getAllEntities");
+            auto entities = GetEntities(query);
+
+            auto ctx = _context;
+            auto objIdx = duk_push_object(ctx);
+            duk_push_uint(ctx, static_cast<duk_uint_t>(entities.size()));
+            duk_put_prop_string(ctx, objIdx, "length");
+            for (const auto& name : fields)
+            {
+                auto field = FindDataField(EntityDataFields, name);
+                PushTypedArray(field->ArrayType, entities.size(), [&](size_t i) { return field->Read(*entities[i]); });
+                duk_put_prop_string(ctx, objIdx, field->Name);
+            }
+        }
+
+        // Pushes the data object, the range and the fields must have been checked.
+        void PushTileElementData(
+            int32_t x, int32_t y, int32_t width, int32_t height, const std::vector<std::string>& fields) const
+        {
+            // The elements of tile (x + i, y + j) are from offsets[j * width + i] up to the offset after it.
+            std::vector<uint32_t> offsets;
+            std::vector<const TileElement*> elements;
+            offsets.reserve(static_cast<size_t>(width) * height + 1);
+            for (int32_t j = 0; j < height; j++)
+            {
+                for (int32_t i = 0; i < width; i++)
+                {
+                    offsets.push_back(static_cast<uint32_t>(elements.size()));
+                    auto element = map_get_first_element_at(TileCoordsXY(x + i, y + j).ToCoordsXY());
+                    if (element != nullptr)
+                    {
+                        do
+                        {
+                            elements.push_back(element);
+                        } while (!(element++)->IsLastForTile());
+                    }
+                }
+            }
+            offsets.push_back(static_cast<uint32_t>(elements.size()));
+
+            auto ctx = _context;
+            auto objIdx = duk_push_object(ctx);
+            duk_push_uint(ctx, static_cast<duk_uint_t>(elements.size()));
+            duk_put_prop_string(ctx, objIdx, "length");
+            PushTypedArray(DukArrayType::Uint32, offsets.size(), [&](size_t i) { return offsets[i]; });
+            duk_put_prop_string(ctx, objIdx, "offsets");
+            for (const auto& name : fields)
+            {
+                auto field = FindDataField(TileElementDataFields, name);
+                PushTypedArray(field->ArrayType, elements.size(), [&](size_t i) { return field->Read(*elements[i]); });
+                duk_put_prop_string(ctx, objIdx, field->Name);
+            }
+        }
+
+        template<typename T, size_t TSize>
+        static const ScMapDataField<T>* FindDataField(const ScMapDataField<T> (&fields)[TSize], const std::string& name)
+        {
+            auto it = std::find_if(
+                std::begin(fields), std::end(fields), [&name](const ScMapDataField<T>& field) { return name == field.Name; });
+            return it != std::end(fields) ? it : nullptr;
+        }
+
+        template<typename T, typename TRead> void PushTypedArray(duk_uint_t arrayType, size_t length, TRead read) const
+        {
+            auto size = length * sizeof(T);
+            auto data = static_cast<T*>(duk_push_fixed_buffer(_context, size));
+            for (size_t i = 0; i < length; i++)
+            {
+                data[i] = static_cast<T>(read(i));
+            }
+            duk_push_buffer_object(_context, -1, 0, size, arrayType);
+            duk_remove(_context, -2);
+        }
+
+        // Pushes a typed array of the values read for every index up to length.
+        template<typename TRead> void PushTypedArray(DukArrayType arrayType, size_t length, TRead read) const
+        {
+            switch (arrayType)
+            {
+                case DukArrayType::Uint8:
+                    PushTypedArray<uint8_t>(DUK_BUFOBJ_UINT8ARRAY, length, read);
+                    break;
+                case DukArrayType::Uint16:
+                    PushTypedArray<uint16_t>(DUK_BUFOBJ_UINT16ARRAY, length, read);
+                    break;
+                case DukArrayType::Uint32:
+                    PushTypedArray<uint32_t>(DUK_BUFOBJ_UINT32ARRAY, length, read);
+                    break;
+                case DukArrayType::Int32:
+                    PushTypedArray<int32_t>(DUK_BUFOBJ_INT32ARRAY, length, read);
+                    break;
+            }
         }
 
-    private:
         DukValue GetEntityAsDukValue(const SpriteBase* sprite) const
         {
             auto spriteId = sprite->sprite_index;
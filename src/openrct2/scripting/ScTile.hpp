@@ -15,6 +15,8 @@
 #    include "../common.h"
 #    include "../core/Guard.hpp"
 #    include "../world/Footpath.h"
+#    include "../world/FootpathGraph.h"
+#    include "../world/ParkAggregates.h"
 #    include "../world/Scenery.h"
 #    include "../world/Sprite.h"
 #    include "../world/Surface.h"
@@ -97,6 +99,11 @@ namespace OpenRCT2::Scripting
                 return;
             }
 
+            // Turning an element into a surface or the other way around changes the owned tiles.
+            if (_element->GetType() == TILE_ELEMENT_TYPE_SURFACE || (type & TILE_ELEMENT_TYPE_MASK) == TILE_ELEMENT_TYPE_SURFACE)
+            {
+                park_aggregates_invalidate_tiles();
+            }
             _element->type = type;
             Invalidate();
         }
@@ -993,6 +1000,7 @@ namespace OpenRCT2::Scripting
         void Invalidate()
         {
             map_invalidate_tile_full(_coords);
+            footpath_graph_invalidate_tile(_coords);
         }
 
     public:
@@ -1176,6 +1184,8 @@ namespace OpenRCT2::Scripting
                     }
                 }
                 map_invalidate_tile_full(_coords);
+                footpath_graph_invalidate_tile(_coords);
+                park_aggregates_invalidate_tiles();
             }
         }
 
@@ -1228,6 +1238,7 @@ namespace OpenRCT2::Scripting
                     }
                     first[origNumElements].SetLastForTile(true);
                     map_invalidate_tile_full(_coords);
+                    footpath_graph_invalidate_tile(_coords);
                     result = std::make_shared<ScTileElement>(_coords, &first[index]);
                 }
             }
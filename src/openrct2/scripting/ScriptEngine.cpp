@@ -44,7 +44,7 @@
 using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
 
-static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 15;
+static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 16;
 
 struct ExpressionStringifier final
 {
@@ -714,6 +714,48 @@ DukValue ScriptEngine::ExecutePluginCall(
     return DukValue();
 }
 
+/**
+ * Calls the function below the numArgs arguments on top of the stack and pops them, the result is discarded.
+ */
+void ScriptEngine::ExecutePluginCall(const std::shared_ptr<Plugin>& plugin, duk_idx_t numArgs, bool isGameStateMutable)
+{
+    if (!duk_is_function(_context, -numArgs - 1))
+    {
+        duk_pop_n(_context, numArgs + 1);
+        return;
+    }
+
+    ScriptExecutionInfo::PluginScope scope(_execInfo, plugin, isGameStateMutable);
+    auto result = duk_pcall(_context, numArgs);
+    if (result != DUK_EXEC_SUCCESS)
+    {
+        auto message = duk_safe_to_string(_context, -1);
+        LogPluginInfo(plugin, message);
+    }
+    duk_pop(_context);
+}
+
+void ScriptEngine::UpdatePluginTickBudgets()
+{
+    auto budget = std::chrono::milliseconds(gConfigPlugin.tick_budget);
+    for (auto& plugin : _plugins)
+    {
+        // Remote plugins run on every client, skipping their hooks on one of them would desync it.
+        if (network_get_mode() != NETWORK_MODE_NONE && plugin->GetMetadata().Type != PluginType::Local)
+        {
+            plugin->EndTick({});
+            continue;
+        }
+
+        bool wasThrottled = plugin->IsThrottled();
+        plugin->EndTick(budget);
+        if (!wasThrottled && plugin->IsThrottled())
+        {
+            log_verbose("Plugin '%s' is over the tick budget, throttling it", plugin->GetMetadata().Name.c_str());
+        }
+    }
+}
+
 void ScriptEngine::LogPluginInfo(const std::shared_ptr<Plugin>& plugin, const std::string_view& message)
 {
     const auto& pluginName = plugin->GetMetadata().Name;
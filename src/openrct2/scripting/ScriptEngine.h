@@ -18,6 +18,7 @@
 #    include "HookEngine.h"
 #    include "Plugin.h"
 
+#    include <chrono>
 #    include <future>
 #    include <list>
 #    include <memory>
@@ -55,6 +56,18 @@ namespace OpenRCT2::Scripting
     private:
         std::shared_ptr<Plugin> _plugin;
         bool _isGameStateMutable{};
+        std::chrono::high_resolution_clock::time_point _pluginStartTime;
+
+        // Adds the time since the current plugin started or was resumed to it, nested plugin calls are not counted twice.
+        void AddTimeSpent()
+        {
+            auto now = std::chrono::high_resolution_clock::now();
+            if (_plugin != nullptr)
+            {
+                _plugin->AddTimeSpent(now - _pluginStartTime);
+            }
+            _pluginStartTime = now;
+        }
 
     public:
         class PluginScope
@@ -71,6 +84,8 @@ namespace OpenRCT2::Scripting
                 : _execInfo(execInfo)
                 , _plugin(plugin)
             {
+                _execInfo.AddTimeSpent();
+
                 _backupPlugin = _execInfo._plugin;
                 _backupIsGameStateMutable = _execInfo._isGameStateMutable;
 
@@ -80,6 +95,8 @@ namespace OpenRCT2::Scripting
             PluginScope(const PluginScope&) = delete;
             ~PluginScope()
             {
+                _execInfo.AddTimeSpent();
+
                 _execInfo._plugin = _backupPlugin;
                 _execInfo._isGameStateMutable = _backupIsGameStateMutable;
             }
@@ -183,6 +200,13 @@ namespace OpenRCT2::Scripting
         DukValue ExecutePluginCall(
             const std::shared_ptr<Plugin>& plugin, const DukValue& func, const std::vector<DukValue>& args,
             bool isGameStateMutable);
+        void ExecutePluginCall(const std::shared_ptr<Plugin>& plugin, duk_idx_t numArgs, bool isGameStateMutable);
+
+        /**
+         * Ends the tick for the time spent in each plugin. Plugins over the tick budget skip their interval.tick hooks
+         * until their average is back under it.
+         */
+        void UpdatePluginTickBudgets();
 
         void LogPluginInfo(const std::shared_ptr<Plugin>& plugin, const std::string_view& message);
 
@@ -21,18 +21,45 @@ static size_t decode_chunk_rle_with_size(const uint8_t* src_buffer, uint8_t* dst
 
 static size_t encode_chunk_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length);
 static size_t encode_chunk_repeat(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length);
-static void encode_chunk_rotate(uint8_t* buffer, size_t length);
+static size_t find_repeat(const uint8_t* src_buffer, size_t i, size_t length, size_t* bestRepeatIndex);
+
+static uint32_t calculate_checksum_scalar(const uint8_t* buffer, size_t length);
+static void encode_rotate_scalar(const uint8_t* src, uint8_t* dst, size_t length);
+static void decode_rotate_scalar(const uint8_t* src, uint8_t* dst, size_t length);
+static size_t count_literals_scalar(const uint8_t* src, size_t maxCount);
+static size_t count_run_scalar(const uint8_t* src, size_t maxCount);
+static size_t find_repeat_scalar(const uint8_t* src, size_t i, size_t* bestRepeatIndex);
+
+const SawyerCodingFunctions SawyerCodingScalar = {
+    calculate_checksum_scalar, encode_rotate_scalar, decode_rotate_scalar,
+    count_literals_scalar,     count_run_scalar,     find_repeat_scalar,
+};
+const SawyerCodingFunctions* gSawyerCoding = &SawyerCodingScalar;
 
 bool gUseRLE = true;
 
 uint32_t sawyercoding_calculate_checksum(const uint8_t* buffer, size_t length)
 {
-    size_t i;
-    uint32_t checksum = 0;
-    for (i = 0; i < length; i++)
-        checksum += buffer[i];
+    return gSawyerCoding->CalculateChecksum(buffer, length);
+}
 
-    return checksum;
+void sawyercoding_init()
+{
+    if (avx2_available())
+    {
+        log_verbose("registering AVX2 sawyer coding functions");
+        gSawyerCoding = &SawyerCodingAVX2;
+    }
+    else if (sse41_available())
+    {
+        log_verbose("registering SSE4.1 sawyer coding functions");
+        gSawyerCoding = &SawyerCodingSSE41;
+    }
+    else
+    {
+        log_verbose("registering scalar sawyer coding functions");
+        gSawyerCoding = &SawyerCodingScalar;
+    }
 }
 
 /**
@@ -83,8 +110,7 @@ size_t sawyercoding_write_chunk_buffer(uint8_t* dst_file, const uint8_t* buffer,
             break;
         case CHUNK_ENCODING_ROTATE:
             encode_buffer = static_cast<uint8_t*>(malloc(chunkHeader.length));
-            std::memcpy(encode_buffer, buffer, chunkHeader.length);
-            encode_chunk_rotate(encode_buffer, chunkHeader.length);
+            gSawyerCoding->EncodeRotate(buffer, encode_buffer, chunkHeader.length);
             std::memcpy(dst_file, &chunkHeader, sizeof(sawyercoding_chunk_header));
             dst_file += sizeof(sawyercoding_chunk_header);
             std::memcpy(dst_file, encode_buffer, chunkHeader.length);
@@ -276,6 +302,16 @@ static size_t encode_chunk_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, s
 
     while (src < end_src - 1)
     {
+        if (count <= 125)
+        {
+            // Skip the bytes that only extend the literal run, the loop below would take them one at a time.
+            auto maxCount = std::min<size_t>(126 - count, end_src - 1 - src);
+            auto literals = gSawyerCoding->CountLiterals(src, maxCount);
+            count += static_cast<uint8_t>(literals);
+            src += literals;
+            if (src >= end_src - 1)
+                break;
+        }
         if ((count && *src == src[1]) || count > 125)
         {
             *dst++ = count - 1;
@@ -286,11 +322,7 @@ static size_t encode_chunk_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, s
         }
         if (*src == src[1])
         {
-            for (; (count < 125) && ((src + count) < end_src); count++)
-            {
-                if (*src != src[count])
-                    break;
-            }
+            count = static_cast<uint8_t>(gSawyerCoding->CountRun(src, std::min<size_t>(125, end_src - src)));
             *dst++ = 257 - count;
             *dst++ = *src;
             src += count;
@@ -329,39 +361,12 @@ static size_t encode_chunk_repeat(const uint8_t* src_buffer, uint8_t* dst_buffer
     // Iterate through remainder of the source buffer
     for (size_t i = 1; i < length;)
     {
-        size_t searchIndex = (i < 32) ? 0 : (i - 32);
-        size_t searchEnd = i - 1;
-
         size_t bestRepeatIndex = 0;
-        size_t bestRepeatCount = 0;
-        for (size_t repeatIndex = searchIndex; repeatIndex <= searchEnd; repeatIndex++)
-        {
-            size_t repeatCount = 0;
-            size_t maxRepeatCount = std::min(std::min(static_cast<size_t>(7), searchEnd - repeatIndex), length - i - 1);
-            // maxRepeatCount should not exceed length
-            assert(repeatIndex + maxRepeatCount < length);
-            assert(i + maxRepeatCount < length);
-            for (size_t j = 0; j <= maxRepeatCount; j++)
-            {
-                if (src_buffer[repeatIndex + j] == src_buffer[i + j])
-                {
-                    repeatCount++;
-                }
-                else
-                {
-                    break;
-                }
-            }
-            if (repeatCount > bestRepeatCount)
-            {
-                bestRepeatIndex = repeatIndex;
-                bestRepeatCount = repeatCount;
-
-                // Maximum repeat count is 8
-                if (repeatCount == 8)
-                    break;
-            }
-        }
+        size_t bestRepeatCount;
+        if (i >= 32 && i + 8 <= length)
+            bestRepeatCount = gSawyerCoding->FindRepeat(src_buffer, i, &bestRepeatIndex);
+        else
+            bestRepeatCount = find_repeat(src_buffer, i, length, &bestRepeatIndex);
 
         if (bestRepeatCount == 0)
         {
@@ -381,17 +386,102 @@ static size_t encode_chunk_repeat(const uint8_t* src_buffer, uint8_t* dst_buffer
     return outLength;
 }
 
-static void encode_chunk_rotate(uint8_t* buffer, size_t length)
+/**
+ * Finds the first of the longest runs in the 32 bytes before i that match the bytes from i, the runs may not overlap i.
+ */
+static size_t find_repeat(const uint8_t* src_buffer, size_t i, size_t length, size_t* bestRepeatIndex)
+{
+    size_t searchIndex = (i < 32) ? 0 : (i - 32);
+    size_t searchEnd = i - 1;
+
+    size_t bestRepeatCount = 0;
+    for (size_t repeatIndex = searchIndex; repeatIndex <= searchEnd; repeatIndex++)
+    {
+        size_t repeatCount = 0;
+        size_t maxRepeatCount = std::min(std::min(static_cast<size_t>(7), searchEnd - repeatIndex), length - i - 1);
+        // maxRepeatCount should not exceed length
+        assert(repeatIndex + maxRepeatCount < length);
+        assert(i + maxRepeatCount < length);
+        for (size_t j = 0; j <= maxRepeatCount; j++)
+        {
+            if (src_buffer[repeatIndex + j] == src_buffer[i + j])
+            {
+                repeatCount++;
+            }
+            else
+            {
+                break;
+            }
+        }
+        if (repeatCount > bestRepeatCount)
+        {
+            *bestRepeatIndex = repeatIndex;
+            bestRepeatCount = repeatCount;
+
+            // Maximum repeat count is 8
+            if (repeatCount == 8)
+                break;
+        }
+    }
+    return bestRepeatCount;
+}
+
+#pragma endregion
+
+#pragma region Scalar functions
+
+static uint32_t calculate_checksum_scalar(const uint8_t* buffer, size_t length)
 {
     size_t i;
-    uint8_t code = 1;
+    uint32_t checksum = 0;
     for (i = 0; i < length; i++)
+        checksum += buffer[i];
+
+    return checksum;
+}
+
+static void encode_rotate_scalar(const uint8_t* src, uint8_t* dst, size_t length)
+{
+    uint8_t code = 1;
+    for (size_t i = 0; i < length; i++)
     {
-        buffer[i] = rol8(buffer[i], code);
+        dst[i] = rol8(src[i], code);
         code = (code + 2) % 8;
     }
 }
 
+static void decode_rotate_scalar(const uint8_t* src, uint8_t* dst, size_t length)
+{
+    uint8_t code = 1;
+    for (size_t i = 0; i < length; i++)
+    {
+        dst[i] = ror8(src[i], code);
+        code = (code + 2) % 8;
+    }
+}
+
+static size_t count_literals_scalar(const uint8_t* src, size_t maxCount)
+{
+    size_t count = 0;
+    while (count < maxCount && src[count] != src[count + 1])
+        count++;
+    return count;
+}
+
+static size_t count_run_scalar(const uint8_t* src, size_t maxCount)
+{
+    size_t count = 0;
+    while (count < maxCount && src[count] == src[0])
+        count++;
+    return count;
+}
+
+static size_t find_repeat_scalar(const uint8_t* src, size_t i, size_t* bestRepeatIndex)
+{
+    // Only called with 8 bytes left, the rest of the buffer does not change the result.
+    return find_repeat(src, i, i + 8, bestRepeatIndex);
+}
+
 #pragma endregion
 
 int32_t sawyercoding_detect_file_type(const uint8_t* src, size_t length)
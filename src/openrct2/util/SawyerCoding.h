@@ -42,8 +42,32 @@ enum
     FILE_TYPE_SC4 = (2 << 2)
 };
 
+/**
+ * The inner loops of the chunk codecs. Every set gives the same results, sawyercoding_init picks the fastest one the
+ * CPU supports.
+ */
+struct SawyerCodingFunctions
+{
+    uint32_t (*CalculateChecksum)(const uint8_t* buffer, size_t length);
+    void (*EncodeRotate)(const uint8_t* src, uint8_t* dst, size_t length);
+    void (*DecodeRotate)(const uint8_t* src, uint8_t* dst, size_t length);
+    // Number of bytes from src that differ from the byte after them, at most maxCount. Reads src[maxCount].
+    size_t (*CountLiterals)(const uint8_t* src, size_t maxCount);
+    // Number of bytes from src that are equal to src[0], at most maxCount.
+    size_t (*CountRun)(const uint8_t* src, size_t maxCount);
+    // Longest match of up to 8 bytes for src[i] in the 32 bytes before it, needs i >= 32 and i + 8 <= length.
+    size_t (*FindRepeat)(const uint8_t* src, size_t i, size_t* bestRepeatIndex);
+};
+
+extern const SawyerCodingFunctions SawyerCodingScalar;
+extern const SawyerCodingFunctions SawyerCodingSSE41;
+extern const SawyerCodingFunctions SawyerCodingAVX2;
+extern const SawyerCodingFunctions* gSawyerCoding;
+
 extern bool gUseRLE;
 
+void sawyercoding_init();
+
 uint32_t sawyercoding_calculate_checksum(const uint8_t* buffer, size_t length);
 size_t sawyercoding_write_chunk_buffer(uint8_t* dst_file, const uint8_t* src_buffer, sawyercoding_chunk_header chunkHeader);
 size_t sawyercoding_decode_sv4(const uint8_t* src, uint8_t* dst, size_t length, size_t bufferLength);
@@ -0,0 +1,156 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../common.h"
+#include "SawyerCoding.h"
+#include "Util.h"
+
+#ifdef __AVX2__
+
+#    include <immintrin.h>
+
+static uint32_t calculate_checksum_avx2(const uint8_t* buffer, size_t length)
+{
+    const __m256i zero256 = {};
+    __m256i sum = zero256;
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32)
+    {
+        const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(buffer + i));
+        // Adds up each quarter of the bytes into the low bits of a 64 bit lane.
+        sum = _mm256_add_epi64(sum, _mm256_sad_epu8(data, zero256));
+    }
+
+    // The checksum wraps around, only the low 32 bits of each lane matter.
+    const __m128i sum128 = _mm_add_epi64(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+    uint32_t checksum = static_cast<uint32_t>(_mm_cvtsi128_si32(sum128))
+        + static_cast<uint32_t>(_mm_extract_epi32(sum128, 2));
+    for (; i < length; i++)
+        checksum += buffer[i];
+    return checksum;
+}
+
+template<int TShift> static __m256i rotate_bytes_left(__m256i data)
+{
+    // There are no byte shifts, shift the words and drop the bits that crossed into the neighbouring byte.
+    const __m256i left = _mm256_and_si256(
+        _mm256_slli_epi16(data, TShift), _mm256_set1_epi8(static_cast<char>(0xFF << TShift)));
+    const __m256i right = _mm256_and_si256(
+        _mm256_srli_epi16(data, 8 - TShift), _mm256_set1_epi8(static_cast<char>(0xFF >> (8 - TShift))));
+    return _mm256_or_si256(left, right);
+}
+
+/**
+ * Rotates each byte left by the shift for its position in every group of four bytes.
+ */
+template<int TShift0, int TShift1, int TShift2, int TShift3>
+static void rotate_avx2(const uint8_t* src, uint8_t* dst, size_t length)
+{
+    const __m256i select1 = _mm256_set1_epi32(0x0000FF00);
+    const __m256i select2 = _mm256_set1_epi32(0x00FF0000);
+    const __m256i select3 = _mm256_set1_epi32(static_cast<int32_t>(0xFF000000));
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32)
+    {
+        const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i result = rotate_bytes_left<TShift0>(data);
+        result = _mm256_blendv_epi8(result, rotate_bytes_left<TShift1>(data), select1);
+        result = _mm256_blendv_epi8(result, rotate_bytes_left<TShift2>(data), select2);
+        result = _mm256_blendv_epi8(result, rotate_bytes_left<TShift3>(data), select3);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), result);
+    }
+
+    static constexpr uint8_t shifts[] = { TShift0, TShift1, TShift2, TShift3 };
+    for (; i < length; i++)
+        dst[i] = rol8(src[i], shifts[i % 4]);
+}
+
+static void encode_rotate_avx2(const uint8_t* src, uint8_t* dst, size_t length)
+{
+    rotate_avx2<1, 3, 5, 7>(src, dst, length);
+}
+
+static void decode_rotate_avx2(const uint8_t* src, uint8_t* dst, size_t length)
+{
+    rotate_avx2<7, 5, 3, 1>(src, dst, length);
+}
+
+static size_t count_literals_avx2(const uint8_t* src, size_t maxCount)
+{
+    size_t count = 0;
+    for (; count + 32 <= maxCount; count += 32)
+    {
+        const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + count));
+        const __m256i next = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + count + 1));
+        int32_t equal = _mm256_movemask_epi8(_mm256_cmpeq_epi8(data, next));
+        if (equal != 0)
+            return count + bitscanforward(equal);
+    }
+    while (count < maxCount && src[count] != src[count + 1])
+        count++;
+    return count;
+}
+
+static size_t count_run_avx2(const uint8_t* src, size_t maxCount)
+{
+    const __m256i first = _mm256_set1_epi8(static_cast<char>(src[0]));
+    size_t count = 0;
+    for (; count + 32 <= maxCount; count += 32)
+    {
+        const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + count));
+        int32_t different = ~_mm256_movemask_epi8(_mm256_cmpeq_epi8(data, first));
+        if (different != 0)
+            return count + bitscanforward(different);
+    }
+    while (count < maxCount && src[count] == src[0])
+        count++;
+    return count;
+}
+
+static size_t find_repeat_avx2(const uint8_t* src, size_t i, size_t* bestRepeatIndex)
+{
+    // Bit k stands for the run starting at i - 32 + k, cleared once a byte of the run does not match.
+    uint32_t runs = 0xFFFFFFFF;
+    uint32_t bestRuns = 0;
+    size_t bestRepeatCount = 0;
+    for (size_t j = 0; j < 8; j++)
+    {
+        const __m256i value = _mm256_set1_epi8(static_cast<char>(src[i + j]));
+        const __m256i window = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i - 32 + j));
+        auto equal = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(window, value)));
+
+        // Runs may not reach i, the one starting at i - 32 + k is at most 32 - k bytes long.
+        runs &= equal & (0xFFFFFFFF >> j);
+        if (runs == 0)
+            break;
+        bestRuns = runs;
+        bestRepeatCount = j + 1;
+    }
+
+    // Ties go to the run furthest back, the same as the scalar search.
+    if (bestRepeatCount != 0)
+        *bestRepeatIndex = i - 32 + bitscanforward(static_cast<int32_t>(bestRuns));
+    return bestRepeatCount;
+}
+
+const SawyerCodingFunctions SawyerCodingAVX2 = {
+    calculate_checksum_avx2, encode_rotate_avx2, decode_rotate_avx2,
+    count_literals_avx2,     count_run_avx2,     find_repeat_avx2,
+};
+
+#else
+
+#    ifdef OPENRCT2_X86
+#        error You have to compile this file with AVX2 enabled, when targetting x86!
+#    endif
+
+// Never registered without AVX2, sawyercoding_init keeps the scalar functions.
+const SawyerCodingFunctions SawyerCodingAVX2 = SawyerCodingScalar;
+
+#endif // __AVX2__
@@ -0,0 +1,156 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../common.h"
+#include "SawyerCoding.h"
+#include "Util.h"
+
+#ifdef __SSE4_1__
+
+#    include <immintrin.h>
+
+static uint32_t calculate_checksum_sse4_1(const uint8_t* buffer, size_t length)
+{
+    const __m128i zero128 = {};
+    __m128i sum = zero128;
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16)
+    {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + i));
+        // Adds up each half of the bytes into the low bits of a 64 bit lane.
+        sum = _mm_add_epi64(sum, _mm_sad_epu8(data, zero128));
+    }
+
+    // The checksum wraps around, only the low 32 bits of each lane matter.
+    uint32_t checksum = static_cast<uint32_t>(_mm_cvtsi128_si32(sum)) + static_cast<uint32_t>(_mm_extract_epi32(sum, 2));
+    for (; i < length; i++)
+        checksum += buffer[i];
+    return checksum;
+}
+
+template<int TShift> static __m128i rotate_bytes_left(__m128i data)
+{
+    // There are no byte shifts, shift the words and drop the bits that crossed into the neighbouring byte.
+    const __m128i left = _mm_and_si128(_mm_slli_epi16(data, TShift), _mm_set1_epi8(static_cast<char>(0xFF << TShift)));
+    const __m128i right = _mm_and_si128(
+        _mm_srli_epi16(data, 8 - TShift), _mm_set1_epi8(static_cast<char>(0xFF >> (8 - TShift))));
+    return _mm_or_si128(left, right);
+}
+
+/**
+ * Rotates each byte left by the shift for its position in every group of four bytes.
+ */
+template<int TShift0, int TShift1, int TShift2, int TShift3>
+static void rotate_sse4_1(const uint8_t* src, uint8_t* dst, size_t length)
+{
+    const __m128i select1 = _mm_set1_epi32(0x0000FF00);
+    const __m128i select2 = _mm_set1_epi32(0x00FF0000);
+    const __m128i select3 = _mm_set1_epi32(static_cast<int32_t>(0xFF000000));
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16)
+    {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i result = rotate_bytes_left<TShift0>(data);
+        result = _mm_blendv_epi8(result, rotate_bytes_left<TShift1>(data), select1);
+        result = _mm_blendv_epi8(result, rotate_bytes_left<TShift2>(data), select2);
+        result = _mm_blendv_epi8(result, rotate_bytes_left<TShift3>(data), select3);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), result);
+    }
+
+    static constexpr uint8_t shifts[] = { TShift0, TShift1, TShift2, TShift3 };
+    for (; i < length; i++)
+        dst[i] = rol8(src[i], shifts[i % 4]);
+}
+
+static void encode_rotate_sse4_1(const uint8_t* src, uint8_t* dst, size_t length)
+{
+    rotate_sse4_1<1, 3, 5, 7>(src, dst, length);
+}
+
+static void decode_rotate_sse4_1(const uint8_t* src, uint8_t* dst, size_t length)
+{
+    rotate_sse4_1<7, 5, 3, 1>(src, dst, length);
+}
+
+static size_t count_literals_sse4_1(const uint8_t* src, size_t maxCount)
+{
+    size_t count = 0;
+    for (; count + 16 <= maxCount; count += 16)
+    {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + count));
+        const __m128i next = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + count + 1));
+        int32_t equal = _mm_movemask_epi8(_mm_cmpeq_epi8(data, next));
+        if (equal != 0)
+            return count + bitscanforward(equal);
+    }
+    while (count < maxCount && src[count] != src[count + 1])
+        count++;
+    return count;
+}
+
+static size_t count_run_sse4_1(const uint8_t* src, size_t maxCount)
+{
+    const __m128i first = _mm_set1_epi8(static_cast<char>(src[0]));
+    size_t count = 0;
+    for (; count + 16 <= maxCount; count += 16)
+    {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + count));
+        int32_t different = ~_mm_movemask_epi8(_mm_cmpeq_epi8(data, first)) & 0xFFFF;
+        if (different != 0)
+            return count + bitscanforward(different);
+    }
+    while (count < maxCount && src[count] == src[0])
+        count++;
+    return count;
+}
+
+static size_t find_repeat_sse4_1(const uint8_t* src, size_t i, size_t* bestRepeatIndex)
+{
+    // Bit k stands for the run starting at i - 32 + k, cleared once a byte of the run does not match.
+    uint32_t runs = 0xFFFFFFFF;
+    uint32_t bestRuns = 0;
+    size_t bestRepeatCount = 0;
+    for (size_t j = 0; j < 8; j++)
+    {
+        const __m128i value = _mm_set1_epi8(static_cast<char>(src[i + j]));
+        const uint8_t* window = src + i - 32 + j;
+        const __m128i window1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(window));
+        const __m128i window2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(window + 16));
+        uint32_t equal = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(window1, value)))
+            | (static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(window2, value))) << 16);
+
+        // Runs may not reach i, the one starting at i - 32 + k is at most 32 - k bytes long.
+        runs &= equal & (0xFFFFFFFF >> j);
+        if (runs == 0)
+            break;
+        bestRuns = runs;
+        bestRepeatCount = j + 1;
+    }
+
+    // Ties go to the run furthest back, the same as the scalar search.
+    if (bestRepeatCount != 0)
+        *bestRepeatIndex = i - 32 + bitscanforward(static_cast<int32_t>(bestRuns));
+    return bestRepeatCount;
+}
+
+const SawyerCodingFunctions SawyerCodingSSE41 = {
+    calculate_checksum_sse4_1, encode_rotate_sse4_1, decode_rotate_sse4_1,
+    count_literals_sse4_1,     count_run_sse4_1,     find_repeat_sse4_1,
+};
+
+#else
+
+#    ifdef OPENRCT2_X86
+#        error You have to compile this file with SSE4.1 enabled, when targetting x86!
+#    endif
+
+// Never registered without SSE4.1, sawyercoding_init keeps the scalar functions.
+const SawyerCodingFunctions SawyerCodingSSE41 = SawyerCodingScalar;
+
+#endif // __SSE4_1__
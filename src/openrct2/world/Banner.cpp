@@ -275,9 +275,9 @@ void fix_duplicated_banners()
 {
     // For each banner in the map, check if the banner index is in use already, and if so, create a new entry for it
     bool activeBanners[std::size(_banners)]{};
-    for (int y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    for (int y = 0; y < gMapSizeTechnical; y++)
     {
-        for (int x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        for (int x = 0; x < gMapSizeTechnical; x++)
         {
             auto tileElement = map_get_first_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
             if (tileElement != nullptr)
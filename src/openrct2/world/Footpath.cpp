@@ -28,6 +28,7 @@
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
 #include "../util/Util.h"
+#include "FootpathGraph.h"
 #include "Map.h"
 #include "MapAnimation.h"
 #include "Park.h"
@@ -1450,6 +1451,8 @@ bool PathElement::IsSloped() const
 
 void PathElement::SetSloped(bool isSloped)
 {
+    if (isSloped != IsSloped())
+        footpath_graph_invalidate_element(this);
     Flags2 &= ~FOOTPATH_ELEMENT_FLAGS2_IS_SLOPED;
     if (isSloped)
         Flags2 |= FOOTPATH_ELEMENT_FLAGS2_IS_SLOPED;
@@ -1462,6 +1465,8 @@ Direction PathElement::GetSlopeDirection() const
 
 void PathElement::SetSlopeDirection(Direction newSlope)
 {
+    if (newSlope != SlopeDirection)
+        footpath_graph_invalidate_element(this);
     SlopeDirection = newSlope;
 }
 
@@ -1472,6 +1477,8 @@ bool PathElement::IsQueue() const
 
 void PathElement::SetIsQueue(bool isQueue)
 {
+    if (isQueue != IsQueue())
+        footpath_graph_invalidate_element(this);
     type &= ~FOOTPATH_ELEMENT_TYPE_FLAG_IS_QUEUE;
     if (isQueue)
         type |= FOOTPATH_ELEMENT_TYPE_FLAG_IS_QUEUE;
@@ -1684,6 +1691,27 @@ static TileElement* footpath_can_be_wide(const CoordsXYZ& footpathPos)
     return nullptr;
 }
 
+/**
+ * Returns the wide flags of the paths at the location, one bit per path.
+ */
+static uint32_t footpath_get_wide_flags(const CoordsXY& footpathPos)
+{
+    uint32_t wideFlags = 0;
+    uint32_t pathBit = 1;
+    TileElement* tileElement = map_get_first_element_at(footpathPos);
+    if (tileElement == nullptr)
+        return wideFlags;
+    do
+    {
+        if (tileElement->GetType() != TILE_ELEMENT_TYPE_PATH)
+            continue;
+        if (tileElement->AsPath()->IsWide())
+            wideFlags |= pathBit;
+        pathBit <<= 1;
+    } while (!(tileElement++)->IsLastForTile());
+    return wideFlags;
+}
+
 /**
  *
  *  rct2: 0x006A87BB
@@ -1693,6 +1721,8 @@ void footpath_update_path_wide_flags(const CoordsXY& footpathPos)
     if (map_is_location_at_edge(footpathPos))
         return;
 
+    // The flags are cleared and set again, only tell the footpath graph if they end up different.
+    auto oldWideFlags = footpath_get_wide_flags(footpathPos);
     footpath_clear_wide(footpathPos);
     /* Rather than clearing the wide flag of the following tiles and
      * checking the state of them later, leave them intact and assume
@@ -1871,6 +1901,9 @@ void footpath_update_path_wide_flags(const CoordsXY& footpathPos)
                 tileElement->AsPath()->SetWide(true);
         }
     } while (!(tileElement++)->IsLastForTile());
+
+    if (footpath_get_wide_flags(footpathPos) != oldWideFlags)
+        footpath_graph_invalidate_tile(footpathPos);
 }
 
 bool footpath_is_blocked_by_vehicle(const TileCoordsXYZ& position)
@@ -2242,6 +2275,8 @@ uint8_t PathElement::GetEdges() const
 
 void PathElement::SetEdges(uint8_t newEdges)
 {
+    if ((newEdges & FOOTPATH_PROPERTIES_EDGES_EDGES_MASK) != GetEdges())
+        footpath_graph_invalidate_element(this);
     EdgesAndCorners &= ~FOOTPATH_PROPERTIES_EDGES_EDGES_MASK;
     EdgesAndCorners |= (newEdges & FOOTPATH_PROPERTIES_EDGES_EDGES_MASK);
 }
@@ -2264,6 +2299,8 @@ uint8_t PathElement::GetEdgesAndCorners() const
 
 void PathElement::SetEdgesAndCorners(uint8_t newEdgesAndCorners)
 {
+    if ((newEdgesAndCorners & FOOTPATH_PROPERTIES_EDGES_EDGES_MASK) != GetEdges())
+        footpath_graph_invalidate_element(this);
     EdgesAndCorners = newEdgesAndCorners;
 }
 
@@ -0,0 +1,425 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "FootpathGraph.h"
+
+#include "../util/Util.h"
+#include "Map.h"
+
+#include <algorithm>
+#include <vector>
+
+static constexpr size_t MaxDirtyTiles = 1024;
+
+enum class SegmentState : uint8_t
+{
+    Unlinked,
+    Linking,
+    Linked,
+};
+
+static std::vector<FootpathGraphTile> _graphTiles;
+// The size of the map the tiles were read from, a new size always goes along with a rebuild.
+static int32_t _graphSize = 0;
+static std::vector<FootpathGraphSegment> _graphSegments;
+static std::vector<TileCoordsXY> _dirtyTiles;
+static std::vector<TileCoordsXY> _changedTiles;
+// Segments of tiles that are no longer plain, by the index of the first of the pair.
+static std::vector<uint32_t> _freeSegments;
+static std::vector<SegmentState> _segmentStates;
+static std::vector<TileCoordsXY> _linkTiles;
+static std::vector<std::pair<uint32_t, TileCoordsXY>> _run;
+static bool _graphNeedsRebuild = true;
+static bool _graphIsValid = false;
+static bool _graphWasRebuilt = false;
+static uint32_t _graphRevision = 0;
+static uint32_t _graphRebuildCount = 0;
+
+bool FootpathGraphTile::IsValidEntry(int32_t z, Direction direction) const
+{
+    // Same as IsValidPathZAndDirection.
+    if (SlopeDirection == INVALID_DIRECTION)
+        return z == BaseZ;
+    if (SlopeDirection == direction)
+        return z == BaseZ;
+    return direction_reverse(SlopeDirection) == direction && z == BaseZ + 2;
+}
+
+uint8_t FootpathGraphTile::GetExitHeight(Direction direction) const
+{
+    return SlopeDirection == direction ? BaseZ + 2 : BaseZ;
+}
+
+static size_t footpath_graph_get_tile_index(const TileCoordsXY& loc)
+{
+    return static_cast<size_t>(loc.y) * _graphSize + loc.x;
+}
+
+static bool footpath_graph_is_tile_in_range(const TileCoordsXY& loc)
+{
+    return loc.x >= 0 && loc.y >= 0 && loc.x < _graphSize && loc.y < _graphSize;
+}
+
+static uint32_t footpath_graph_get_segment_index(const FootpathGraphTile& tile, Direction exitDirection)
+{
+    return tile.SegmentIndex + (exitDirection == bitscanforward(tile.Edges) ? 0 : 1);
+}
+
+/**
+ * Reads the tile elements at loc, returns a tile without edges if the tile is not plain. Checks every element the
+ * heuristic search looks at: ghost paths and banners count, ghost tracks and entrances do not.
+ */
+static FootpathGraphTile footpath_graph_read_tile(const TileCoordsXY& loc)
+{
+    FootpathGraphTile result{};
+    TileElement* tileElement = map_get_first_element_at(loc.ToCoordsXY());
+    if (tileElement == nullptr)
+        return result;
+
+    TileElement* pathElement = nullptr;
+    bool hasBanner = false;
+    do
+    {
+        switch (tileElement->GetType())
+        {
+            case TILE_ELEMENT_TYPE_PATH:
+                if (pathElement != nullptr)
+                    return result;
+                pathElement = tileElement;
+                break;
+            case TILE_ELEMENT_TYPE_BANNER:
+                hasBanner |= pathElement != nullptr;
+                break;
+        }
+    } while (!(tileElement++)->IsLastForTile());
+
+    if (pathElement == nullptr || hasBanner || pathElement->IsGhost())
+        return result;
+
+    auto path = pathElement->AsPath();
+    if (path->IsWide() || path->IsQueue() || bitcount(path->GetEdges()) != 2)
+        return result;
+
+    // The search enters the path at its base or at the top of a slope.
+    uint8_t baseZ = pathElement->base_height;
+    tileElement = map_get_first_element_at(loc.ToCoordsXY());
+    do
+    {
+        auto type = tileElement->GetType();
+        if ((type == TILE_ELEMENT_TYPE_TRACK || type == TILE_ELEMENT_TYPE_ENTRANCE) && !tileElement->IsGhost()
+            && (tileElement->base_height == baseZ || tileElement->base_height == baseZ + 2))
+        {
+            return result;
+        }
+    } while (!(tileElement++)->IsLastForTile());
+
+    result.BaseZ = baseZ;
+    result.Edges = path->GetEdges();
+    result.SlopeDirection = path->IsSloped() ? path->GetSlopeDirection() : INVALID_DIRECTION;
+    return result;
+}
+
+static const FootpathGraphTile* footpath_graph_get_plain_tile(const TileCoordsXY& loc)
+{
+    if (!footpath_graph_is_tile_in_range(loc))
+        return nullptr;
+
+    const auto& tile = _graphTiles[footpath_graph_get_tile_index(loc)];
+    return tile.Edges != 0 ? &tile : nullptr;
+}
+
+/**
+ * Reserves the two segments of a tile that became plain, their state is linked until the tile is collected for
+ * linking.
+ */
+static uint32_t footpath_graph_allocate_segments()
+{
+    uint32_t segmentIndex;
+    if (!_freeSegments.empty())
+    {
+        segmentIndex = _freeSegments.back();
+        _freeSegments.pop_back();
+    }
+    else
+    {
+        segmentIndex = static_cast<uint32_t>(_graphSegments.size());
+        _graphSegments.resize(_graphSegments.size() + 2);
+        _segmentStates.resize(_graphSegments.size());
+    }
+    _segmentStates[segmentIndex] = SegmentState::Linked;
+    _segmentStates[segmentIndex + 1] = SegmentState::Linked;
+    return segmentIndex;
+}
+
+/**
+ * Adds every tile linked to the plain tile at loc to the tiles to link and marks their segments as unlinked. Runs only
+ * continue through the edges of plain tiles, so every run starting on these tiles stays on them up to its end tile.
+ */
+static void footpath_graph_collect_linked_tiles(const TileCoordsXY& loc)
+{
+    const FootpathGraphTile* firstTile = footpath_graph_get_plain_tile(loc);
+    if (firstTile == nullptr || _segmentStates[firstTile->SegmentIndex] == SegmentState::Unlinked)
+        return;
+
+    _segmentStates[firstTile->SegmentIndex] = SegmentState::Unlinked;
+    _segmentStates[firstTile->SegmentIndex + 1] = SegmentState::Unlinked;
+    _linkTiles.push_back(loc);
+    for (Direction firstDirection : ALL_DIRECTIONS)
+    {
+        if (!(firstTile->Edges & (1 << firstDirection)))
+            continue;
+
+        TileCoordsXY tileLoc = loc;
+        Direction direction = firstDirection;
+        while (true)
+        {
+            auto nextLoc = tileLoc + TileDirectionDelta[direction];
+            auto reverseEdge = 1 << direction_reverse(direction);
+            const FootpathGraphTile* next = footpath_graph_get_plain_tile(nextLoc);
+            if (next == nullptr || !(next->Edges & reverseEdge)
+                || _segmentStates[next->SegmentIndex] == SegmentState::Unlinked)
+            {
+                break;
+            }
+
+            _segmentStates[next->SegmentIndex] = SegmentState::Unlinked;
+            _segmentStates[next->SegmentIndex + 1] = SegmentState::Unlinked;
+            _linkTiles.push_back(nextLoc);
+            tileLoc = nextLoc;
+            direction = static_cast<Direction>(bitscanforward(next->Edges & ~reverseEdge));
+        }
+    }
+}
+
+/**
+ * Follows the runs of plain tiles through both edges of the plain tile at loc. Runs are linked back to front so every
+ * run is only walked once, runs through segments that are already linked reuse them.
+ */
+static void footpath_graph_link_tile(const TileCoordsXY& firstLoc)
+{
+    const auto& firstTile = _graphTiles[footpath_graph_get_tile_index(firstLoc)];
+    for (Direction firstDirection : ALL_DIRECTIONS)
+    {
+        if (!(firstTile.Edges & (1 << firstDirection)))
+            continue;
+        if (_segmentStates[footpath_graph_get_segment_index(firstTile, firstDirection)] != SegmentState::Unlinked)
+            continue;
+
+        const FootpathGraphTile* tile = &firstTile;
+        TileCoordsXY loc = firstLoc;
+        Direction direction = firstDirection;
+        FootpathGraphSegment tail{};
+        bool isLoop = false;
+        _run.clear();
+        while (true)
+        {
+            auto segmentIndex = footpath_graph_get_segment_index(*tile, direction);
+            _segmentStates[segmentIndex] = SegmentState::Linking;
+            _run.emplace_back(segmentIndex, loc);
+
+            auto z = tile->GetExitHeight(direction);
+            auto nextLoc = loc + TileDirectionDelta[direction];
+            const FootpathGraphTile* next = footpath_graph_get_plain_tile(nextLoc);
+            auto reverseEdge = 1 << direction_reverse(direction);
+            if (next == nullptr || !(next->Edges & reverseEdge) || !next->IsValidEntry(z, direction))
+            {
+                tail.End = { nextLoc.x, nextLoc.y, z };
+                tail.EndDirection = direction;
+                tail.Min = nextLoc;
+                tail.Max = nextLoc;
+                break;
+            }
+
+            auto nextDirection = static_cast<Direction>(bitscanforward(next->Edges & ~reverseEdge));
+            auto nextIndex = footpath_graph_get_segment_index(*next, nextDirection);
+            if (_segmentStates[nextIndex] == SegmentState::Linking)
+            {
+                isLoop = true;
+                break;
+            }
+            if (_segmentStates[nextIndex] == SegmentState::Linked)
+            {
+                tail = _graphSegments[nextIndex];
+                isLoop = tail.Length == 0;
+                break;
+            }
+            tile = next;
+            loc = nextLoc;
+            direction = nextDirection;
+        }
+
+        for (auto it = _run.rbegin(); it != _run.rend(); it++)
+        {
+            auto& segment = _graphSegments[it->first];
+            _segmentStates[it->first] = SegmentState::Linked;
+            if (isLoop)
+            {
+                segment = {};
+                continue;
+            }
+            segment.Length = tail.Length + 1;
+            segment.End = tail.End;
+            segment.EndDirection = tail.EndDirection;
+            segment.Min = { std::min(tail.Min.x, it->second.x), std::min(tail.Min.y, it->second.y) };
+            segment.Max = { std::max(tail.Max.x, it->second.x), std::max(tail.Max.y, it->second.y) };
+            tail = segment;
+        }
+    }
+}
+
+/**
+ * Reads every tile of the map again and links all runs.
+ */
+static void footpath_graph_rebuild()
+{
+    _graphSize = gMapSizeTechnical;
+    _graphTiles.resize(static_cast<size_t>(_graphSize) * _graphSize);
+    _graphSegments.clear();
+    _freeSegments.clear();
+    for (int32_t y = 0; y < _graphSize; y++)
+    {
+        for (int32_t x = 0; x < _graphSize; x++)
+        {
+            auto& tile = _graphTiles[footpath_graph_get_tile_index({ x, y })];
+            tile = footpath_graph_read_tile({ x, y });
+            if (tile.Edges != 0)
+            {
+                tile.SegmentIndex = static_cast<uint32_t>(_graphSegments.size());
+                _graphSegments.resize(_graphSegments.size() + 2);
+            }
+        }
+    }
+
+    _segmentStates.assign(_graphSegments.size(), SegmentState::Unlinked);
+    for (int32_t y = 0; y < _graphSize; y++)
+    {
+        for (int32_t x = 0; x < _graphSize; x++)
+        {
+            if (_graphTiles[footpath_graph_get_tile_index({ x, y })].Edges != 0)
+            {
+                footpath_graph_link_tile({ x, y });
+            }
+        }
+    }
+}
+
+/**
+ * Reads the dirty tiles again and links the runs through them and their neighbours. A run only changes if one of its
+ * tiles or its end tile changed, the tile before a changed tile on the run is one of its neighbours.
+ */
+static void footpath_graph_update_dirty_tiles()
+{
+    for (const auto& loc : _dirtyTiles)
+    {
+        if (!footpath_graph_is_tile_in_range(loc))
+            continue;
+
+        auto& tile = _graphTiles[footpath_graph_get_tile_index(loc)];
+        auto newTile = footpath_graph_read_tile(loc);
+        if (tile.Edges != 0 && newTile.Edges == 0)
+            _freeSegments.push_back(tile.SegmentIndex);
+        else if (tile.Edges != 0)
+            newTile.SegmentIndex = tile.SegmentIndex;
+        else if (newTile.Edges != 0)
+            newTile.SegmentIndex = footpath_graph_allocate_segments();
+        tile = newTile;
+    }
+
+    _linkTiles.clear();
+    for (const auto& loc : _dirtyTiles)
+    {
+        footpath_graph_collect_linked_tiles(loc);
+        for (Direction direction : ALL_DIRECTIONS)
+        {
+            footpath_graph_collect_linked_tiles(loc + TileDirectionDelta[direction]);
+        }
+    }
+    for (const auto& loc : _linkTiles)
+    {
+        footpath_graph_link_tile(loc);
+    }
+}
+
+void footpath_graph_invalidate()
+{
+    _graphNeedsRebuild = true;
+    _graphIsValid = false;
+}
+
+void footpath_graph_invalidate_tile(const CoordsXY& loc)
+{
+    if (!_graphNeedsRebuild)
+    {
+        if (_dirtyTiles.size() >= MaxDirtyTiles)
+            _graphNeedsRebuild = true;
+        else
+            _dirtyTiles.emplace_back(loc);
+    }
+    _graphIsValid = false;
+}
+
+void footpath_graph_invalidate_element(const TileElementBase* element)
+{
+    TileCoordsXY tilePos;
+    if (map_get_element_tile(static_cast<const TileElement*>(element), tilePos))
+    {
+        footpath_graph_invalidate_tile(tilePos.ToCoordsXY());
+    }
+}
+
+void footpath_graph_update()
+{
+    if (_graphIsValid)
+        return;
+
+    if (_graphNeedsRebuild || _graphTiles.empty())
+    {
+        _graphNeedsRebuild = true;
+        footpath_graph_rebuild();
+        _graphRebuildCount++;
+    }
+    else
+    {
+        footpath_graph_update_dirty_tiles();
+    }
+
+    _changedTiles.swap(_dirtyTiles);
+    _dirtyTiles.clear();
+    _graphWasRebuilt = _graphNeedsRebuild;
+    _graphNeedsRebuild = false;
+    _graphIsValid = true;
+    _graphRevision++;
+}
+
+uint32_t footpath_graph_get_revision()
+{
+    return _graphRevision;
+}
+
+uint32_t footpath_graph_get_rebuild_count()
+{
+    return _graphRebuildCount;
+}
+
+const std::vector<TileCoordsXY>* footpath_graph_get_changed_tiles()
+{
+    return _graphWasRebuilt ? nullptr : &_changedTiles;
+}
+
+const FootpathGraphTile* footpath_graph_get_tile(const TileCoordsXY& loc)
+{
+    if (!_graphIsValid)
+        return nullptr;
+    return footpath_graph_get_plain_tile(loc);
+}
+
+const FootpathGraphSegment& footpath_graph_get_segment(const FootpathGraphTile& tile, Direction exitDirection)
+{
+    return _graphSegments[footpath_graph_get_segment_index(tile, exitDirection)];
+}
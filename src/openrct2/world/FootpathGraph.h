@@ -0,0 +1,83 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "Location.hpp"
+
+#include <vector>
+
+/**
+ * A run of plain path tiles, followed from a tile through one of its edges up to the first tile that is not plain.
+ */
+struct FootpathGraphSegment
+{
+    // Number of plain tiles in the run including the first one, 0 if the run is part of a loop.
+    uint32_t Length;
+    // The tile after the run with the height and direction it is entered at.
+    TileCoordsXYZ End;
+    Direction EndDirection;
+    // Bounds of the tiles in the run.
+    TileCoordsXY Min;
+    TileCoordsXY Max;
+};
+
+/**
+ * A plain path tile has a single thin, non queue path with exactly two edges, no banners and nothing else a peep could
+ * walk onto near its height. Searching over it always continues through the other edge, the footpath graph keeps these
+ * tiles so the search does not have to read their tile elements.
+ */
+struct FootpathGraphTile
+{
+    uint8_t BaseZ;
+    uint8_t Edges;
+    Direction SlopeDirection;
+    uint32_t SegmentIndex;
+
+    bool IsValidEntry(int32_t z, Direction direction) const;
+    uint8_t GetExitHeight(Direction direction) const;
+};
+
+struct TileElementBase;
+
+void footpath_graph_invalidate();
+void footpath_graph_invalidate_tile(const CoordsXY& loc);
+
+/**
+ * Invalidates the tile of the element, elements outside of the map storage are not part of the graph.
+ */
+void footpath_graph_invalidate_element(const TileElementBase* element);
+
+/**
+ * Rebuilds the invalidated parts of the graph, must be called from the main thread before searches use it.
+ */
+void footpath_graph_update();
+
+/**
+ * Counts the updates that changed the graph, caches built on top of it can compare it to find out if they are out of
+ * date.
+ */
+uint32_t footpath_graph_get_revision();
+
+/**
+ * Counts the updates that read the whole map instead of only the invalidated tiles.
+ */
+uint32_t footpath_graph_get_rebuild_count();
+
+/**
+ * Returns the tiles read again by the last update that changed the graph, nullptr if it read the whole map.
+ */
+const std::vector<TileCoordsXY>* footpath_graph_get_changed_tiles();
+
+/**
+ * Returns the plain path tile at loc or nullptr if the tile is not plain or the graph is out of date.
+ */
+const FootpathGraphTile* footpath_graph_get_tile(const TileCoordsXY& loc);
+const FootpathGraphSegment& footpath_graph_get_segment(const FootpathGraphTile& tile, Direction exitDirection);
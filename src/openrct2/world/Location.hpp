@@ -630,6 +630,16 @@ struct TileCoordsXYZD : public TileCoordsXYZ
     {
     }
 
+    bool operator==(const TileCoordsXYZD& other) const
+    {
+        return x == other.x && y == other.y && z == other.z && direction == other.direction;
+    }
+
+    bool operator!=(const TileCoordsXYZD& other) const
+    {
+        return !(*this == other);
+    }
+
     CoordsXYZD ToCoordsXYZD() const
     {
         if (isNull())
@@ -46,9 +46,11 @@
 #include "Banner.h"
 #include "Climate.h"
 #include "Footpath.h"
+#include "FootpathGraph.h"
 #include "LargeScenery.h"
 #include "MapAnimation.h"
 #include "Park.h"
+#include "ParkAggregates.h"
 #include "Scenery.h"
 #include "SmallScenery.h"
 #include "Surface.h"
@@ -56,8 +58,11 @@
 #include "Wall.h"
 
 #include <algorithm>
+#include <chrono>
 #include <iterator>
+#include <map>
 #include <memory>
+#include <set>
 
 using namespace OpenRCT2;
 
@@ -91,22 +96,54 @@ uint8_t gMapGroundFlags;
 
 uint16_t gWidePathTileLoopX;
 uint16_t gWidePathTileLoopY;
-uint16_t gGrassSceneryTileLoopPosition;
+uint32_t gGrassSceneryTileLoopPosition;
 
 int16_t gMapSizeUnits;
 int16_t gMapSizeMinus2;
 int16_t gMapSize;
 int16_t gMapSizeMaxXY;
 int16_t gMapBaseZ;
+int32_t gMapSizeTechnical = MAXIMUM_MAP_SIZE_TECHNICAL;
 
-TileElement gTileElements[MAX_TILE_ELEMENTS_WITH_SPARE_ROOM];
-TileElement* gTileElementTilePointers[MAX_TILE_TILE_ELEMENT_POINTERS];
+std::vector<TileElement> gTileElements;
+std::vector<TileElement*> gTileElementTilePointers(MAX_TILE_TILE_ELEMENT_POINTERS);
 std::vector<CoordsXY> gMapSelectionTiles;
 std::vector<PeepSpawn> gPeepSpawns;
 
 TileElement* gNextFreeTileElement;
 uint32_t gNextFreeTileElementPointerIndex;
 
+static constexpr uint32_t NoTileIndex = 0xFFFFFFFF;
+static constexpr uint32_t NoElementIndex = 0xFFFFFFFF;
+// The number of elements in each block the storage grows by.
+static constexpr uint32_t ElementBlockSize = 0x4000;
+
+// The blocks of elements after gTileElements, element indices count on from gTileElements into them. The storage grows
+// by adding blocks and never moves the elements, so element pointers stay valid while tiles are inserted into.
+static std::vector<std::vector<TileElement>> _elementBlocks;
+// The block gNextFreeTileElement points into, 0 is gTileElements and 1 is the first of _elementBlocks.
+static size_t _nextFreeElementBlock;
+
+// Runs of free elements below gNextFreeTileElement, by start and by length for best fit lookups.
+static std::map<uint32_t, uint32_t> _freeElementRuns;
+static std::set<std::pair<uint32_t, uint32_t>> _freeElementRunsByLength;
+static uint32_t _freeElementCount;
+// The tile each element belongs to, used to find the tile of the last run when compacting.
+static std::vector<uint32_t> _elementTileIndices;
+static uint32_t _elementCompactionMoves;
+static uint32_t _elementReorganisations;
+static std::chrono::nanoseconds _elementCompactionTime;
+
+static uint32_t map_get_element_index(const TileElement* element);
+static uint32_t map_get_next_free_element_index();
+static TileElement* map_allocate_at_end(uint32_t length, uint32_t maxEnd);
+static uint32_t map_get_element_block_start(size_t block);
+static std::vector<TileElement>& map_get_element_block(size_t block);
+static uint32_t map_count_elements(const TileElement* firstElement);
+static void map_set_element_tile_index(uint32_t start, uint32_t length, uint32_t tileIndex);
+static void map_insert_free_run(uint32_t start, uint32_t length);
+static void map_free_elements(uint32_t start, uint32_t length);
+
 bool gLandMountainMode;
 bool gLandPaintMode;
 bool gClearSmallScenery;
@@ -142,14 +179,14 @@ int32_t tile_element_iterator_next(tile_element_iterator* it)
         return 1;
     }
 
-    if (it->x < (MAXIMUM_MAP_SIZE_TECHNICAL - 1))
+    if (it->x < (gMapSizeTechnical - 1))
     {
         it->x++;
         it->element = map_get_first_element_at(TileCoordsXY{ it->x, it->y }.ToCoordsXY());
         return 1;
     }
 
-    if (it->y < (MAXIMUM_MAP_SIZE_TECHNICAL - 1))
+    if (it->y < (gMapSizeTechnical - 1))
     {
         it->x = 0;
         it->y++;
@@ -172,8 +209,7 @@ TileElement* map_get_first_element_at(const CoordsXY& elementPos)
         log_verbose("Trying to access element outside of range");
         return nullptr;
     }
-    auto tileElementPos = TileCoordsXY{ elementPos };
-    return gTileElementTilePointers[tileElementPos.x + tileElementPos.y * MAXIMUM_MAP_SIZE_TECHNICAL];
+    return gTileElementTilePointers[map_get_tile_index(TileCoordsXY{ elementPos })];
 }
 
 TileElement* map_get_nth_element_at(const CoordsXY& coords, int32_t n)
@@ -210,7 +246,7 @@ void map_set_tile_element(const TileCoordsXY& tilePos, TileElement* elements)
         log_error("Trying to access element outside of range");
         return;
     }
-    gTileElementTilePointers[tilePos.x + tilePos.y * MAXIMUM_MAP_SIZE_TECHNICAL] = elements;
+    gTileElementTilePointers[map_get_tile_index(tilePos)] = elements;
 }
 
 SurfaceElement* map_get_surface_element_at(const CoordsXY& coords)
@@ -285,9 +321,14 @@ BannerElement* map_get_banner_element_at(const CoordsXYZ& bannerPos, uint8_t pos
  */
 void map_init(int32_t size)
 {
+    gMapSizeTechnical = map_get_size_technical(size);
+    auto numTiles = static_cast<uint32_t>(gMapSizeTechnical * gMapSizeTechnical);
+
+    // Start with room for one more element per tile, the storage grows in blocks when it runs out.
+    map_resize_storage(numTiles * 2);
     gNextFreeTileElementPointerIndex = 0;
 
-    for (int32_t i = 0; i < MAX_TILE_TILE_ELEMENT_POINTERS; i++)
+    for (uint32_t i = 0; i < numTiles; i++)
     {
         TileElement* tile_element = &gTileElements[i];
         tile_element->ClearAs(TILE_ELEMENT_TYPE_SURFACE);
@@ -319,6 +360,86 @@ void map_init(int32_t size)
     context_broadcast_intent(&intent);
 }
 
+int32_t map_get_size_technical(int32_t mapSize)
+{
+    auto size = std::clamp(mapSize, MAXIMUM_MAP_SIZE_TECHNICAL, MAXIMUM_MAP_SIZE_EXTENDED);
+    return static_cast<int32_t>(floor2(size + MAP_CHUNK_SIZE - 1, MAP_CHUNK_SIZE));
+}
+
+/**
+ * Replaces the tile storage with an empty one with numElements elements in gTileElements, with gMapSizeTechnical tiles
+ * in each direction. The elements are only allocated up front, tile_element_insert adds blocks to the storage when it
+ * runs out.
+ */
+void map_resize_storage(uint32_t numElements)
+{
+    gTileElementTilePointers.assign(static_cast<size_t>(gMapSizeTechnical) * gMapSizeTechnical, nullptr);
+    gTileElements.assign(numElements, TileElement{});
+    _elementBlocks.clear();
+    gNextFreeTileElement = gTileElements.data();
+    _nextFreeElementBlock = 0;
+    map_rebuild_free_elements();
+    footpath_graph_invalidate();
+    park_aggregates_invalidate_tiles();
+}
+
+void map_swap_storage(TileElementStorage& storage)
+{
+    std::swap(gTileElements, storage.Elements);
+    std::swap(_elementBlocks, storage.ElementBlocks);
+    std::swap(gTileElementTilePointers, storage.TilePointers);
+    std::swap(gNextFreeTileElement, storage.NextFreeElement);
+    std::swap(_nextFreeElementBlock, storage.NextFreeElementBlock);
+    std::swap(gMapSizeTechnical, storage.SizeTechnical);
+    map_rebuild_free_elements();
+    footpath_graph_invalidate();
+    park_aggregates_invalidate_tiles();
+}
+
+void map_snapshot_add_tile(TileElementSnapshot& snapshot, const TileCoordsXY& tilePos)
+{
+    if (!map_is_location_valid(tilePos.ToCoordsXY()))
+        return;
+
+    auto tileElement = map_get_first_element_at(tilePos.ToCoordsXY());
+    if (tileElement == nullptr)
+        return;
+
+    auto key = static_cast<uint32_t>(tilePos.y * MAXIMUM_MAP_SIZE_EXTENDED + tilePos.x);
+    if (!snapshot.Tiles.emplace(key, static_cast<uint32_t>(snapshot.Elements.size())).second)
+        return;
+
+    do
+    {
+        snapshot.Elements.push_back(*tileElement);
+    } while (!(tileElement++)->IsLastForTile());
+}
+
+void map_snapshot_add_tile(TileElementSnapshot& snapshot, const TileCoordsXY& tilePos, const std::vector<TileElement>& elements)
+{
+    if (elements.empty())
+        return;
+
+    auto key = static_cast<uint32_t>(tilePos.y * MAXIMUM_MAP_SIZE_EXTENDED + tilePos.x);
+    if (!snapshot.Tiles.emplace(key, static_cast<uint32_t>(snapshot.Elements.size())).second)
+        return;
+
+    snapshot.Elements.insert(snapshot.Elements.end(), elements.begin(), elements.end());
+}
+
+TileElement* map_snapshot_get_first_element_at(const TileElementSnapshot& snapshot, const TileCoordsXY& tilePos)
+{
+    if (tilePos.x < 0 || tilePos.y < 0 || tilePos.x >= MAXIMUM_MAP_SIZE_EXTENDED || tilePos.y >= MAXIMUM_MAP_SIZE_EXTENDED)
+        return nullptr;
+
+    auto it = snapshot.Tiles.find(static_cast<uint32_t>(tilePos.y * MAXIMUM_MAP_SIZE_EXTENDED + tilePos.x));
+    if (it == snapshot.Tiles.end())
+        return nullptr;
+
+    // Readers never write through the pointer, map_get_first_element_at just has no const version.
+    return const_cast<TileElement*>(&snapshot.Elements[it->second]);
+}
+
 /**
  * Counts the number of surface tiles that offer land ownership rights for sale,
  * but haven't been bought yet. It updates gLandRemainingOwnershipSales and
@@ -329,9 +450,9 @@ void map_count_remaining_land_rights()
     gLandRemainingOwnershipSales = 0;
     gLandRemainingConstructionSales = 0;
 
-    for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+    for (int32_t x = 0; x < gMapSizeTechnical; x++)
     {
-        for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+        for (int32_t y = 0; y < gMapSizeTechnical; y++)
         {
             auto* surfaceElement = map_get_surface_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
             // Surface elements are sometimes hacked out to save some space for other map elements
@@ -371,38 +492,80 @@ void map_count_remaining_land_rights()
  */
 void map_strip_ghost_flag_from_elements()
 {
-    for (auto& element : gTileElements)
+    for (size_t block = 0; block <= _elementBlocks.size(); block++)
     {
-        element.SetGhost(false);
+        for (auto& element : map_get_element_block(block))
+        {
+            element.SetGhost(false);
+        }
     }
 }
 
 /**
- *
+ * Points the tiles at the elements, which have to be stored tile by tile in rows like in the park files.
  *  rct2: 0x0068AFFD
  */
 void map_update_tile_pointers()
 {
-    int32_t i, x, y;
+    std::fill(gTileElementTilePointers.begin(), gTileElementTilePointers.end(), nullptr);
 
-    for (i = 0; i < MAX_TILE_TILE_ELEMENT_POINTERS; i++)
+    TileElement* tileElement = gTileElements.data();
+    for (int32_t y = 0; y < gMapSizeTechnical; y++)
     {
-        gTileElementTilePointers[i] = TILE_UNDEFINED_TILE_ELEMENT;
-    }
-
-    TileElement* tileElement = gTileElements;
-    TileElement** tile = gTileElementTilePointers;
-    for (y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
-    {
-        for (x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        for (int32_t x = 0; x < gMapSizeTechnical; x++)
         {
-            *tile++ = tileElement;
+            gTileElementTilePointers[map_get_tile_index({ x, y })] = tileElement;
             while (!(tileElement++)->IsLastForTile())
                 ;
         }
     }
 
     gNextFreeTileElement = tileElement;
+    _nextFreeElementBlock = 0;
+    map_rebuild_free_elements();
+    footpath_graph_invalidate();
+    park_aggregates_invalidate_tiles();
+}
+
+void map_rebuild_free_elements()
+{
+    _freeElementRuns.clear();
+    _freeElementRunsByLength.clear();
+    _freeElementCount = 0;
+    _elementTileIndices.assign(map_get_element_block_start(_elementBlocks.size() + 1), NoTileIndex);
+
+    for (uint32_t i = 0; i < gTileElementTilePointers.size(); i++)
+    {
+        auto elements = gTileElementTilePointers[i];
+        auto elementIndex = map_get_element_index(elements);
+        if (elementIndex != NoElementIndex)
+        {
+            map_set_element_tile_index(elementIndex, map_count_elements(elements), i);
+        }
+    }
+
+    // Everything below the end that no tile points into is free, the runs end with their block.
+    auto end = map_get_next_free_element_index();
+    for (size_t block = 0; block <= _nextFreeElementBlock; block++)
+    {
+        auto blockStart = map_get_element_block_start(block);
+        auto blockEnd = std::min(map_get_element_block_start(block + 1), end);
+        for (uint32_t i = blockStart; i < blockEnd;)
+        {
+            uint32_t length = 0;
+            while (i + length < blockEnd && _elementTileIndices[i + length] == NoTileIndex)
+                length++;
+            if (length != 0)
+            {
+                map_insert_free_run(i, length);
+                i += length;
+            }
+            else
+            {
+                i++;
+            }
+        }
+    }
 }
 
 /**
@@ -427,9 +590,14 @@ int16_t tile_element_height(const CoordsXY& loc)
         return MINIMUM_LAND_HEIGHT_BIG;
     }
 
-    uint16_t height = surfaceElement->GetBaseZ();
+    return tile_element_height(*surfaceElement, loc);
+}
+
+int16_t tile_element_height(const SurfaceElement& surfaceElement, const CoordsXY& loc)
+{
+    uint16_t height = surfaceElement.GetBaseZ();
 
-    uint32_t slope = surfaceElement->GetSlope();
+    uint32_t slope = surfaceElement.GetSlope();
     uint8_t extra_height = (slope & TILE_ELEMENT_SLOPE_DOUBLE_HEIGHT) >> 4; // 0x10 is the 5th bit - sets slope to double height
     // Remove the extra height bit
     slope &= TILE_ELEMENT_SLOPE_ALL_CORNERS_UP;
@@ -630,19 +798,19 @@ void map_update_path_wide_flags()
     // Presumably update_path_wide_flags is too computationally expensive to call for every
     // tile every update, so gWidePathTileLoopX and gWidePathTileLoopY store the x and y
     // progress. A maximum of 128 calls is done per update.
-    uint16_t x = gWidePathTileLoopX;
-    uint16_t y = gWidePathTileLoopY;
+    int32_t x = gWidePathTileLoopX;
+    int32_t y = gWidePathTileLoopY;
     for (int32_t i = 0; i < 128; i++)
     {
         footpath_update_path_wide_flags({ x, y });
 
         // Next x, y tile
         x += COORDS_XY_STEP;
-        if (x >= MAXIMUM_MAP_SIZE_BIG)
+        if (x >= map_get_size_big())
         {
             x = 0;
             y += COORDS_XY_STEP;
-            if (y >= MAXIMUM_MAP_SIZE_BIG)
+            if (y >= map_get_size_big())
             {
                 y = 0;
             }
@@ -677,8 +845,8 @@ int32_t map_height_from_slope(const CoordsXY& coords, int32_t slopeDirection, bo
 
 bool map_is_location_valid(const CoordsXY& coords)
 {
-    const bool is_x_valid = coords.x < MAXIMUM_MAP_SIZE_BIG && coords.x >= 0;
-    const bool is_y_valid = coords.y < MAXIMUM_MAP_SIZE_BIG && coords.y >= 0;
+    const bool is_x_valid = coords.x < map_get_size_big() && coords.x >= 0;
+    const bool is_y_valid = coords.y < map_get_size_big() && coords.y >= 0;
     return is_x_valid && is_y_valid;
 }
 
@@ -934,7 +1102,8 @@ uint8_t map_get_highest_land_height(const MapRange& range)
 
 bool map_is_location_at_edge(const CoordsXY& loc)
 {
-    return loc.x < 32 || loc.y < 32 || loc.x >= (MAXIMUM_TILE_START_XY) || loc.y >= (MAXIMUM_TILE_START_XY);
+    auto lastTileStart = map_get_size_big() - COORDS_XY_STEP;
+    return loc.x < 32 || loc.y < 32 || loc.x >= lastTileStart || loc.y >= lastTileStart;
 }
 
 /**
@@ -943,6 +1112,23 @@ bool map_is_location_at_edge(const CoordsXY& loc)
  */
 void tile_element_remove(TileElement* tileElement)
 {
+    // Removing ghost tracks and entrances does not change what the footpath graph sees.
+    switch (tileElement->GetType())
+    {
+        case TILE_ELEMENT_TYPE_TRACK:
+        case TILE_ELEMENT_TYPE_ENTRANCE:
+            if (tileElement->IsGhost())
+                break;
+            [[fallthrough]];
+        case TILE_ELEMENT_TYPE_PATH:
+        case TILE_ELEMENT_TYPE_BANNER:
+            footpath_graph_invalidate_element(tileElement);
+            break;
+        case TILE_ELEMENT_TYPE_SURFACE:
+            park_aggregates_invalidate_tiles();
+            break;
+    }
+
     // Replace Nth element by (N+1)th element.
     // This loop will make tileElement point to the old last element position,
     // after copy it to it's new position
@@ -956,12 +1142,7 @@ void tile_element_remove(TileElement* tileElement)
 
     // Mark the latest element with the last element flag.
     (tileElement - 1)->SetLastForTile(true);
-    tileElement->base_height = MAX_ELEMENT_HEIGHT;
-
-    if ((tileElement + 1) == gNextFreeTileElement)
-    {
-        gNextFreeTileElement--;
-    }
+    map_free_elements(map_get_element_index(tileElement), 1);
 }
 
 /**
@@ -1077,66 +1258,386 @@ void map_reorganise_elements()
 {
     context_setcurrentcursor(CursorID::ZZZ);
 
-    auto newTileElements = std::make_unique<TileElement[]>(MAX_TILE_ELEMENTS_WITH_SPARE_ROOM);
-    TileElement* newElementsPtr = newTileElements.get();
+    // The elements are written back in the order of the tile pointers, so the tiles of a chunk end up next to each
+    // other. The blocks stay where they are, only the elements in them move.
+    std::vector<TileElement> elements;
+    elements.reserve(map_get_next_free_element_index());
+    for (auto tilePointer : gTileElementTilePointers)
+    {
+        if (tilePointer != nullptr)
+        {
+            elements.insert(elements.end(), tilePointer, tilePointer + map_count_elements(tilePointer));
+        }
+    }
+
+    gNextFreeTileElement = gTileElements.data();
+    _nextFreeElementBlock = 0;
+    const TileElement* elementsPtr = elements.data();
+    for (auto& tilePointer : gTileElementTilePointers)
+    {
+        if (tilePointer == nullptr)
+            continue;
+
+        const auto numElements = map_count_elements(elementsPtr);
+        tilePointer = map_allocate_at_end(numElements, NoElementIndex);
+        std::copy_n(elementsPtr, numElements, tilePointer);
+        elementsPtr += numElements;
+    }
+
+    map_rebuild_free_elements();
+    footpath_graph_invalidate();
+    _elementReorganisations++;
+}
+
+bool map_is_element_in_storage(const TileElement* element)
+{
+    return map_get_element_index(element) != NoElementIndex;
+}
+
+bool map_get_element_tile(const TileElement* element, TileCoordsXY& tilePos)
+{
+    auto elementIndex = map_get_element_index(element);
+    if (elementIndex == NoElementIndex || _elementTileIndices[elementIndex] == NoTileIndex)
+        return false;
+
+    // The inverse of map_get_tile_index.
+    auto tileIndex = _elementTileIndices[elementIndex];
+    auto chunkIndex = tileIndex / (MAP_CHUNK_SIZE * MAP_CHUNK_SIZE);
+    auto chunksPerRow = static_cast<uint32_t>(gMapSizeTechnical) / MAP_CHUNK_SIZE;
+    tilePos.x = static_cast<int32_t>((chunkIndex % chunksPerRow) * MAP_CHUNK_SIZE + tileIndex % MAP_CHUNK_SIZE);
+    tilePos.y = static_cast<int32_t>(
+        (chunkIndex / chunksPerRow) * MAP_CHUNK_SIZE + (tileIndex / MAP_CHUNK_SIZE) % MAP_CHUNK_SIZE);
+    return true;
+}
+
+static std::vector<TileElement>& map_get_element_block(size_t block)
+{
+    return block == 0 ? gTileElements : _elementBlocks[block - 1];
+}
+
+/**
+ * Returns the index of the first element of the block, or the size of the storage for the block after the last one.
+ */
+static uint32_t map_get_element_block_start(size_t block)
+{
+    uint32_t start = 0;
+    for (size_t i = 0; i < block; i++)
+    {
+        start += static_cast<uint32_t>(map_get_element_block(i).size());
+    }
+    return start;
+}
+
+/**
+ * Whether the element at the index is the first of a block or the end of the storage, runs can not grow past it.
+ */
+static bool map_is_element_block_boundary(uint32_t index)
+{
+    uint32_t start = 0;
+    for (size_t block = 0; block <= _elementBlocks.size(); block++)
+    {
+        if (index == start)
+            return true;
+        start += static_cast<uint32_t>(map_get_element_block(block).size());
+    }
+    return index == start;
+}
+
+static uint32_t map_get_element_index(const TileElement* element)
+{
+    uint32_t start = 0;
+    for (size_t block = 0; block <= _elementBlocks.size(); block++)
+    {
+        const auto& blockElements = map_get_element_block(block);
+        if (element >= blockElements.data() && element < blockElements.data() + blockElements.size())
+        {
+            return start + static_cast<uint32_t>(element - blockElements.data());
+        }
+        start += static_cast<uint32_t>(blockElements.size());
+    }
+    return NoElementIndex;
+}
+
+static TileElement* map_get_element(uint32_t index)
+{
+    for (size_t block = 0; block <= _elementBlocks.size(); block++)
+    {
+        auto& blockElements = map_get_element_block(block);
+        if (index < blockElements.size())
+            return &blockElements[index];
+        index -= static_cast<uint32_t>(blockElements.size());
+    }
+    return nullptr;
+}
+
+/**
+ * Returns the index of gNextFreeTileElement, which can point at the end of its block.
+ */
+static uint32_t map_get_next_free_element_index()
+{
+    const auto& blockElements = map_get_element_block(_nextFreeElementBlock);
+    auto offset = static_cast<uint32_t>(gNextFreeTileElement - blockElements.data());
+    return map_get_element_block_start(_nextFreeElementBlock) + offset;
+}
+
+static uint32_t map_count_elements(const TileElement* firstElement)
+{
+    auto element = firstElement;
+    while (!(element++)->IsLastForTile())
+        ;
+    return static_cast<uint32_t>(element - firstElement);
+}
+
+static void map_set_element_tile_index(uint32_t start, uint32_t length, uint32_t tileIndex)
+{
+    std::fill_n(_elementTileIndices.begin() + start, length, tileIndex);
+}
+
+static void map_insert_free_run(uint32_t start, uint32_t length)
+{
+    _freeElementRuns.emplace(start, length);
+    _freeElementRunsByLength.emplace(length, start);
+    _freeElementCount += length;
+}
+
+static std::map<uint32_t, uint32_t>::iterator map_erase_free_run(std::map<uint32_t, uint32_t>::iterator it)
+{
+    _freeElementRunsByLength.erase({ it->second, it->first });
+    _freeElementCount -= it->second;
+    return _freeElementRuns.erase(it);
+}
 
-    if (newTileElements == nullptr)
+/**
+ * Moves gNextFreeTileElement back to the end of the previous block while it is at the start of its block, together
+ * with the free run at the end of the previous block.
+ */
+static void map_retreat_next_free_element()
+{
+    while (_nextFreeElementBlock > 0 && gNextFreeTileElement == map_get_element_block(_nextFreeElementBlock).data())
     {
-        log_fatal("Unable to allocate memory for map elements.");
+        _nextFreeElementBlock--;
+        auto& blockElements = map_get_element_block(_nextFreeElementBlock);
+        gNextFreeTileElement = blockElements.data() + blockElements.size();
+
+        auto blockStart = map_get_element_block_start(_nextFreeElementBlock);
+        auto blockEnd = blockStart + static_cast<uint32_t>(blockElements.size());
+        auto it = _freeElementRuns.lower_bound(blockEnd);
+        if (it != _freeElementRuns.begin())
+        {
+            it = std::prev(it);
+            if (it->first >= blockStart && it->first + it->second == blockEnd)
+            {
+                gNextFreeTileElement = blockElements.data() + (it->first - blockStart);
+                map_erase_free_run(it);
+            }
+        }
+    }
+}
+
+/**
+ * Marks the elements as free and merges them with the free runs next to them in the same block. Free elements at the
+ * end give the room back to gNextFreeTileElement instead.
+ */
+static void map_free_elements(uint32_t start, uint32_t length)
+{
+    if (length == 0)
         return;
+
+    auto element = map_get_element(start);
+    for (uint32_t i = 0; i < length; i++)
+    {
+        element[i].base_height = MAX_ELEMENT_HEIGHT;
     }
+    map_set_element_tile_index(start, length, NoTileIndex);
 
-    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    auto next = _freeElementRuns.lower_bound(start);
+    if (next != _freeElementRuns.end() && next->first == start + length && !map_is_element_block_boundary(start + length))
+    {
+        length += next->second;
+        next = map_erase_free_run(next);
+    }
+    if (next != _freeElementRuns.begin() && !map_is_element_block_boundary(start))
     {
-        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == start)
         {
-            TileElement* startElement = map_get_first_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
-            if (startElement == nullptr)
-                continue;
-            TileElement* endElement = startElement;
-            while (!(endElement++)->IsLastForTile())
-                ;
+            start = prev->first;
+            length += prev->second;
+            map_erase_free_run(prev);
+        }
+    }
+
+    if (start + length == map_get_next_free_element_index() && start >= map_get_element_block_start(_nextFreeElementBlock))
+    {
+        gNextFreeTileElement = map_get_element(start);
+        map_retreat_next_free_element();
+    }
+    else
+    {
+        map_insert_free_run(start, length);
+    }
+}
+
+/**
+ * Takes length elements from the smallest free run they fit in, nullptr if there is none.
+ */
+static TileElement* map_allocate_free_run(uint32_t length)
+{
+    auto it = _freeElementRunsByLength.lower_bound({ length, 0 });
+    if (it == _freeElementRunsByLength.end())
+        return nullptr;
 
-            const auto numElements = static_cast<uint32_t>(endElement - startElement);
-            std::memcpy(newElementsPtr, startElement, numElements * sizeof(TileElement));
-            newElementsPtr += numElements;
+    auto [runLength, start] = *it;
+    map_erase_free_run(_freeElementRuns.find(start));
+    if (runLength > length)
+    {
+        map_insert_free_run(start + length, runLength - length);
+    }
+    return map_get_element(start);
+}
+
+/**
+ * Takes length elements at gNextFreeTileElement. If they do not fit in its block, the rest of the block becomes a free
+ * run and the elements are taken from the next block, which is added if there is none yet. Returns nullptr if the
+ * elements would end past maxEnd.
+ */
+static TileElement* map_allocate_at_end(uint32_t length, uint32_t maxEnd)
+{
+    while (true)
+    {
+        auto& blockElements = map_get_element_block(_nextFreeElementBlock);
+        auto blockRoom = static_cast<uint32_t>(blockElements.data() + blockElements.size() - gNextFreeTileElement);
+        if (blockRoom >= length)
+            break;
+
+        auto nextFreeIndex = map_get_next_free_element_index();
+        auto nextBlockStart = nextFreeIndex + blockRoom;
+        if (nextBlockStart + length > maxEnd)
+            return nullptr;
+
+        if (_nextFreeElementBlock == _elementBlocks.size())
+        {
+            auto blockSize = std::max(length, std::min(ElementBlockSize, maxEnd - nextBlockStart));
+            _elementBlocks.emplace_back(blockSize);
+            _elementTileIndices.resize(static_cast<size_t>(nextBlockStart) + blockSize, NoTileIndex);
+        }
+        if (blockRoom != 0)
+        {
+            map_insert_free_run(nextFreeIndex, blockRoom);
         }
+        _nextFreeElementBlock++;
+        gNextFreeTileElement = map_get_element_block(_nextFreeElementBlock).data();
     }
 
-    const auto numElements = static_cast<uint32_t>(newElementsPtr - newTileElements.get());
-    std::memcpy(gTileElements, newTileElements.get(), numElements * sizeof(TileElement));
-    std::memset(gTileElements + numElements, 0, (MAX_TILE_ELEMENTS_WITH_SPARE_ROOM - numElements) * sizeof(TileElement));
+    auto result = gNextFreeTileElement;
+    gNextFreeTileElement += length;
+    return result;
+}
 
-    map_update_tile_pointers();
+static TileElement* map_allocate_elements(uint32_t length)
+{
+    auto result = map_allocate_free_run(length);
+    if (result == nullptr)
+    {
+        result = map_allocate_at_end(length, map_get_max_elements_with_spare_room());
+    }
+    return result;
+}
+
+/**
+ * Takes the element after the run of the tile if it is free, so the run can grow without being moved.
+ */
+static bool map_try_grow_elements(const TileElement* firstElement, uint32_t numElements)
+{
+    auto end = map_get_element_index(firstElement) + numElements;
+    if (map_is_element_block_boundary(end))
+        return false;
+
+    if (end == map_get_next_free_element_index())
+    {
+        gNextFreeTileElement++;
+        return true;
+    }
+
+    auto it = _freeElementRuns.find(end);
+    if (it == _freeElementRuns.end())
+        return false;
+
+    auto runLength = it->second;
+    map_erase_free_run(it);
+    if (runLength > 1)
+    {
+        map_insert_free_run(end + 1, runLength - 1);
+    }
+    return true;
+}
+
+/**
+ * Whether numElements fit between gNextFreeTileElement and the spare room at the end of the storage.
+ */
+static bool map_has_room_at_end(uint32_t numElements)
+{
+    return map_get_next_free_element_index() + numElements <= map_get_max_elements();
+}
+
+/**
+ * Moves the runs of the tiles at the end into the free runs below them until there is room for numElements at the
+ * end. Stops early if the last run does not fit in any free run.
+ */
+static void map_compact_elements(uint32_t numElements)
+{
+    auto startTime = std::chrono::high_resolution_clock::now();
+    while (!map_has_room_at_end(numElements) && map_get_next_free_element_index() > 0)
+    {
+        auto endIndex = map_get_next_free_element_index();
+        auto tileIndex = _elementTileIndices[endIndex - 1];
+        if (tileIndex == NoTileIndex)
+            break;
+
+        // Tiles can be pointed elsewhere temporarily or left empty, only move runs the tile still owns.
+        auto firstElement = gTileElementTilePointers[tileIndex];
+        auto firstIndex = map_get_element_index(firstElement);
+        if (firstIndex == NoElementIndex)
+            break;
+        auto length = map_count_elements(firstElement);
+        if (firstIndex + length != endIndex)
+            break;
+
+        auto newElements = map_allocate_free_run(length);
+        if (newElements == nullptr)
+            break;
+
+        std::copy_n(firstElement, length, newElements);
+        map_set_element_tile_index(map_get_element_index(newElements), length, tileIndex);
+        gTileElementTilePointers[tileIndex] = newElements;
+        map_free_elements(firstIndex, length);
+        _elementCompactionMoves++;
+    }
+    _elementCompactionTime += std::chrono::high_resolution_clock::now() - startTime;
 }
 
 /**
  *
  *  rct2: 0x0068B044
  *  Returns true on space available for more elements
- *  Reorganises the map elements to check for space
+ *  Compacts the map elements at the end to make room for them
  */
 bool map_check_free_elements_and_reorganise(int32_t numElements)
 {
     if (numElements != 0)
     {
-        auto tileElementEnd = &gTileElements[MAX_TILE_ELEMENTS];
-
-        // Check if is there is room for the required number of elements
-        auto newTileElementEnd = gNextFreeTileElement + numElements;
-        if (newTileElementEnd > tileElementEnd)
+        // Free runs between the tiles are reused before the end grows, so they count as room.
+        auto numUsedElements = map_get_next_free_element_index() - _freeElementCount;
+        if (numUsedElements + numElements > map_get_max_elements())
         {
-            // Defragment the map element list
-            map_reorganise_elements();
+            // Not enough spare elements left :'(
+            gGameCommandErrorText = STR_ERR_LANDSCAPE_DATA_AREA_FULL;
+            return false;
+        }
 
-            // Check if there is any room again
-            newTileElementEnd = gNextFreeTileElement + numElements;
-            if (newTileElementEnd > tileElementEnd)
-            {
-                // Not enough spare elements left :'(
-                gGameCommandErrorText = STR_ERR_LANDSCAPE_DATA_AREA_FULL;
-                return false;
-            }
+        if (!map_has_room_at_end(numElements))
+        {
+            map_compact_elements(numElements);
         }
     }
     return true;
@@ -1149,75 +1650,97 @@ bool map_check_free_elements_and_reorganise(int32_t numElements)
 TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants)
 {
     const auto& tileLoc = TileCoordsXYZ(loc);
-    TileElement *originalTileElement, *newTileElement, *insertedElement;
-    bool isLastForTile = false;
-
     if (!map_check_free_elements_and_reorganise(1))
     {
         log_error("Cannot insert new element");
         return nullptr;
     }
 
-    newTileElement = gNextFreeTileElement;
-    originalTileElement = gTileElementTilePointers[tileLoc.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileLoc.x];
+    footpath_graph_invalidate_tile(loc);
 
-    // Set tile index pointer to point to new element block
-    gTileElementTilePointers[tileLoc.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileLoc.x] = newTileElement;
+    auto tileIndex = map_get_tile_index(tileLoc);
+    auto originalTileElement = gTileElementTilePointers[tileIndex];
+    auto numElements = originalTileElement != nullptr ? map_count_elements(originalTileElement) : 0;
 
-    if (originalTileElement == nullptr)
+    // Grow the run in place if the element after it is free, otherwise move it to a free run with room for one more.
+    TileElement* newTileElement = originalTileElement;
+    if (originalTileElement == nullptr || !map_try_grow_elements(originalTileElement, numElements))
     {
-        isLastForTile = true;
-    }
-    else
-    {
-        // Copy all elements that are below the insert height
-        while (loc.z >= originalTileElement->GetBaseZ())
+        newTileElement = map_allocate_elements(numElements + 1);
+        if (newTileElement == nullptr)
         {
-            // Copy over map element
-            *newTileElement = *originalTileElement;
-            originalTileElement->base_height = MAX_ELEMENT_HEIGHT;
-            originalTileElement++;
-            newTileElement++;
-
-            if ((newTileElement - 1)->IsLastForTile())
+            // Too fragmented for the run, defragment the whole map element list.
+            map_reorganise_elements();
+            originalTileElement = gTileElementTilePointers[tileIndex];
+            newTileElement = map_allocate_elements(numElements + 1);
+            if (newTileElement == nullptr)
             {
-                // No more elements above the insert element
-                (newTileElement - 1)->SetLastForTile(false);
-                isLastForTile = true;
-                break;
+                log_error("Cannot insert new element");
+                return nullptr;
             }
         }
     }
 
-    // Insert new map element
-    insertedElement = newTileElement;
-    newTileElement->type = 0;
-    newTileElement->SetBaseZ(loc.z);
-    newTileElement->Flags = 0;
-    newTileElement->SetLastForTile(isLastForTile);
-    newTileElement->SetOccupiedQuadrants(occupiedQuadrants);
-    newTileElement->SetClearanceZ(loc.z);
-    std::memset(&newTileElement->pad_04, 0, sizeof(newTileElement->pad_04));
-    std::memset(&newTileElement->pad_08, 0, sizeof(newTileElement->pad_08));
-    newTileElement++;
-
-    // Insert rest of map elements above insert height
-    if (!isLastForTile)
+    // Elements below or at the insert height stay below the new element.
+    uint32_t insertIndex = 0;
+    while (insertIndex < numElements && loc.z >= originalTileElement[insertIndex].GetBaseZ())
     {
-        do
+        insertIndex++;
+    }
+
+    if (newTileElement == originalTileElement)
+    {
+        std::copy_backward(
+            originalTileElement + insertIndex, originalTileElement + numElements, newTileElement + numElements + 1);
+    }
+    else
+    {
+        std::copy_n(originalTileElement, insertIndex, newTileElement);
+        std::copy_n(originalTileElement + insertIndex, numElements - insertIndex, newTileElement + insertIndex + 1);
+        if (originalTileElement != nullptr)
         {
-            // Copy over map element
-            *newTileElement = *originalTileElement;
-            originalTileElement->base_height = MAX_ELEMENT_HEIGHT;
-            originalTileElement++;
-            newTileElement++;
-        } while (!((newTileElement - 1)->IsLastForTile()));
+            map_free_elements(map_get_element_index(originalTileElement), numElements);
+        }
+        gTileElementTilePointers[tileIndex] = newTileElement;
+    }
+    map_set_element_tile_index(map_get_element_index(newTileElement), numElements + 1, tileIndex);
+
+    bool isLastForTile = insertIndex == numElements;
+    if (isLastForTile && insertIndex != 0)
+    {
+        // No more elements above the insert element
+        newTileElement[insertIndex - 1].SetLastForTile(false);
     }
 
-    gNextFreeTileElement = newTileElement;
+    // Insert new map element
+    auto insertedElement = &newTileElement[insertIndex];
+    insertedElement->type = 0;
+    insertedElement->SetBaseZ(loc.z);
+    insertedElement->Flags = 0;
+    insertedElement->SetLastForTile(isLastForTile);
+    insertedElement->SetOccupiedQuadrants(occupiedQuadrants);
+    insertedElement->SetClearanceZ(loc.z);
+    std::memset(&insertedElement->pad_04, 0, sizeof(insertedElement->pad_04));
+    std::memset(&insertedElement->pad_08, 0, sizeof(insertedElement->pad_08));
     return insertedElement;
 }
 
+MapElementStats map_get_element_stats()
+{
+    MapElementStats stats{};
+    stats.UsedElements = map_get_next_free_element_index() - _freeElementCount;
+    stats.FreeElements = _freeElementCount;
+    stats.FreeRuns = static_cast<uint32_t>(_freeElementRuns.size());
+    if (!_freeElementRunsByLength.empty())
+    {
+        stats.LargestFreeRun = _freeElementRunsByLength.rbegin()->first;
+    }
+    stats.CompactionMoves = _elementCompactionMoves;
+    stats.Reorganisations = _elementReorganisations;
+    stats.CompactionTime = std::chrono::duration_cast<std::chrono::microseconds>(_elementCompactionTime).count();
+    return stats;
+}
+
 /**
  *
  *  rct2: 0x0068BB18
@@ -1518,14 +2041,21 @@ void map_update_tiles()
     if (gScreenFlags & ignoreScreenFlags)
         return;
 
+    // The position interleaves the bits of x and y, it covers the smallest power of two square around the map and
+    // skips the positions outside of it.
+    int32_t bitsPerAxis = 8;
+    while ((1 << bitsPerAxis) < gMapSizeTechnical)
+        bitsPerAxis++;
+    uint32_t positionMask = (1u << (bitsPerAxis * 2)) - 1;
+
     // Update 43 more tiles
-    for (int32_t j = 0; j < 43; j++)
+    for (int32_t j = 0; j < 43;)
     {
         int32_t x = 0;
         int32_t y = 0;
 
-        uint16_t interleaved_xy = gGrassSceneryTileLoopPosition;
-        for (int32_t i = 0; i < 8; i++)
+        uint32_t interleaved_xy = gGrassSceneryTileLoopPosition;
+        for (int32_t i = 0; i < bitsPerAxis; i++)
         {
             x = (x << 1) | (interleaved_xy & 1);
             interleaved_xy >>= 1;
@@ -1533,6 +2063,12 @@ void map_update_tiles()
             interleaved_xy >>= 1;
         }
 
+        gGrassSceneryTileLoopPosition++;
+        gGrassSceneryTileLoopPosition &= positionMask;
+        if (x >= gMapSizeTechnical || y >= gMapSizeTechnical)
+            continue;
+        j++;
+
         auto mapPos = TileCoordsXY{ x, y }.ToCoordsXY();
         auto* surfaceElement = map_get_surface_element_at(mapPos);
         if (surfaceElement != nullptr)
@@ -1540,9 +2076,6 @@ void map_update_tiles()
             surfaceElement->UpdateGrassLength(mapPos);
             scenery_update_tile(mapPos);
         }
-
-        gGrassSceneryTileLoopPosition++;
-        gGrassSceneryTileLoopPosition &= 0xFFFF;
     }
 }
 
@@ -1604,9 +2137,9 @@ void map_remove_out_of_range_elements()
     bool buildState = gCheatsBuildInPauseMode;
     gCheatsBuildInPauseMode = true;
 
-    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_BIG; y += COORDS_XY_STEP)
+    for (int32_t y = 0; y < map_get_size_big(); y += COORDS_XY_STEP)
     {
-        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_BIG; x += COORDS_XY_STEP)
+        for (int32_t x = 0; x < map_get_size_big(); x += COORDS_XY_STEP)
         {
             if (x == 0 || y == 0 || x >= mapMaxXY || y >= mapMaxXY)
             {
@@ -1673,7 +2206,7 @@ void map_extend_boundary_surface()
     int32_t x, y;
 
     y = gMapSize - 2;
-    for (x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+    for (x = 0; x < gMapSizeTechnical; x++)
     {
         existingTileElement = map_get_surface_element_at(TileCoordsXY{ x, y - 1 }.ToCoordsXY());
         newTileElement = map_get_surface_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
@@ -1687,7 +2220,7 @@ void map_extend_boundary_surface()
     }
 
     x = gMapSize - 2;
-    for (y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    for (y = 0; y < gMapSizeTechnical; y++)
     {
         existingTileElement = map_get_surface_element_at(TileCoordsXY{ x - 1, y }.ToCoordsXY());
         newTileElement = map_get_surface_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
@@ -2173,9 +2706,9 @@ bool map_surface_is_blocked(const CoordsXY& mapCoords)
 /* Clears all map elements, to be used before generating a new map */
 void map_clear_all_elements()
 {
-    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_BIG; y += COORDS_XY_STEP)
+    for (int32_t y = 0; y < map_get_size_big(); y += COORDS_XY_STEP)
     {
-        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_BIG; x += COORDS_XY_STEP)
+        for (int32_t x = 0; x < map_get_size_big(); x += COORDS_XY_STEP)
         {
             clear_elements_at({ x, y });
         }
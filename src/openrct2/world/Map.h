@@ -15,6 +15,7 @@
 #include "TileElement.h"
 
 #include <initializer_list>
+#include <unordered_map>
 #include <vector>
 
 #define MINIMUM_LAND_HEIGHT 2
@@ -33,6 +34,13 @@ constexpr const int32_t MINIMUM_LAND_HEIGHT_BIG = MINIMUM_LAND_HEIGHT * COORDS_Z
 
 #define MAP_MINIMUM_X_Y (-MAXIMUM_MAP_SIZE_TECHNICAL)
 
+// Maps larger than MAXIMUM_MAP_SIZE_TECHNICAL do not fit the park files, their tiles are stored in a larger grid. The
+// coordinates of entities are 16 bit, so the grid can not be larger than this.
+constexpr const int32_t MAXIMUM_MAP_SIZE_EXTENDED = 1024;
+
+// Tiles are stored in square chunks so tiles next to each other in either direction are close in memory.
+constexpr const uint32_t MAP_CHUNK_SIZE = 32;
+
 constexpr const uint32_t MAX_TILE_ELEMENTS_WITH_SPARE_ROOM = 0x30000;
 constexpr const uint32_t MAX_TILE_ELEMENTS = MAX_TILE_ELEMENTS_WITH_SPARE_ROOM - 512;
 #define MAX_TILE_TILE_ELEMENT_POINTERS (MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL)
@@ -100,13 +108,15 @@ extern const TileCoordsXY TileDirectionDelta[];
 
 extern uint16_t gWidePathTileLoopX;
 extern uint16_t gWidePathTileLoopY;
-extern uint16_t gGrassSceneryTileLoopPosition;
+extern uint32_t gGrassSceneryTileLoopPosition;
 
 extern int16_t gMapSizeUnits;
 extern int16_t gMapSizeMinus2;
 extern int16_t gMapSize;
 extern int16_t gMapSizeMaxXY;
 extern int16_t gMapBaseZ;
+// The number of tiles in each row and column of the tile storage.
+extern int32_t gMapSizeTechnical;
 
 extern uint16_t gMapSelectFlags;
 extern uint16_t gMapSelectType;
@@ -117,8 +127,8 @@ extern uint8_t gMapSelectArrowDirection;
 
 extern uint8_t gMapGroundFlags;
 
-extern TileElement gTileElements[MAX_TILE_ELEMENTS_WITH_SPARE_ROOM];
-extern TileElement* gTileElementTilePointers[MAX_TILE_TILE_ELEMENT_POINTERS];
+extern std::vector<TileElement> gTileElements;
+extern std::vector<TileElement*> gTileElementTilePointers;
 
 extern std::vector<CoordsXY> gMapSelectionTiles;
 extern std::vector<PeepSpawn> gPeepSpawns;
@@ -146,6 +156,92 @@ extern const uint8_t tile_element_raise_styles[9][32];
 
 void map_init(int32_t size);
 
+/**
+ * The size of the tile storage for a map, MAXIMUM_MAP_SIZE_TECHNICAL or the map size rounded up to whole chunks for
+ * larger maps.
+ */
+int32_t map_get_size_technical(int32_t mapSize);
+
+/**
+ * The end of the tile storage in coordinates, the runtime counterpart of MAXIMUM_MAP_SIZE_BIG.
+ */
+inline int32_t map_get_size_big()
+{
+    return gMapSizeTechnical * COORDS_XY_STEP;
+}
+
+/**
+ * The element limit, the runtime counterpart of MAX_TILE_ELEMENTS_WITH_SPARE_ROOM. Larger maps get the same room per
+ * tile as the classic map.
+ */
+inline uint32_t map_get_max_elements_with_spare_room()
+{
+    auto numTiles = static_cast<uint32_t>(gMapSizeTechnical * gMapSizeTechnical);
+    return MAX_TILE_ELEMENTS_WITH_SPARE_ROOM / MAX_TILE_TILE_ELEMENT_POINTERS * numTiles;
+}
+
+inline uint32_t map_get_max_elements()
+{
+    return map_get_max_elements_with_spare_room() - (MAX_TILE_ELEMENTS_WITH_SPARE_ROOM - MAX_TILE_ELEMENTS);
+}
+
+/**
+ * Returns the index of the tile in gTileElementTilePointers, the tiles of each chunk are stored together.
+ */
+inline size_t map_get_tile_index(const TileCoordsXY& tilePos)
+{
+    auto x = static_cast<uint32_t>(tilePos.x);
+    auto y = static_cast<uint32_t>(tilePos.y);
+    auto chunksPerRow = static_cast<uint32_t>(gMapSizeTechnical) / MAP_CHUNK_SIZE;
+    auto chunkIndex = (y / MAP_CHUNK_SIZE) * chunksPerRow + x / MAP_CHUNK_SIZE;
+    return (static_cast<size_t>(chunkIndex) * MAP_CHUNK_SIZE + y % MAP_CHUNK_SIZE) * MAP_CHUNK_SIZE + x % MAP_CHUNK_SIZE;
+}
+
+void map_resize_storage(uint32_t numElements);
+bool map_is_element_in_storage(const TileElement* element);
+
+/**
+ * Finds the tile an element of the storage belongs to, returns false for elements outside of the storage.
+ */
+bool map_get_element_tile(const TileElement* element, TileCoordsXY& tilePos);
+
+/**
+ * The tile storage of a map, the track design preview swaps it out to draw on an empty map.
+ */
+struct TileElementStorage
+{
+    std::vector<TileElement> Elements;
+    std::vector<std::vector<TileElement>> ElementBlocks;
+    std::vector<TileElement*> TilePointers;
+    TileElement* NextFreeElement = nullptr;
+    size_t NextFreeElementBlock = 0;
+    int32_t SizeTechnical = MAXIMUM_MAP_SIZE_TECHNICAL;
+};
+void map_swap_storage(TileElementStorage& storage);
+
+/**
+ * Copies of some tiles of the map that other threads can read while the game keeps changing the map.
+ */
+struct TileElementSnapshot
+{
+    std::vector<TileElement> Elements;
+    // The index of the first element of each tile in Elements, by y * MAXIMUM_MAP_SIZE_EXTENDED + x.
+    std::unordered_map<uint32_t, uint32_t> Tiles;
+};
+
+/**
+ * Copies the elements of the tile from the map into the snapshot, or the given elements, which must end with one that
+ * is the last for the tile. Tiles that are already in the snapshot are left as they are.
+ */
+void map_snapshot_add_tile(TileElementSnapshot& snapshot, const TileCoordsXY& tilePos);
+void map_snapshot_add_tile(
+    TileElementSnapshot& snapshot, const TileCoordsXY& tilePos, const std::vector<TileElement>& elements);
+
+/**
+ * The first element of the tile in the snapshot, tiles that are not in it read as if they were outside of the map.
+ */
+TileElement* map_snapshot_get_first_element_at(const TileElementSnapshot& snapshot, const TileCoordsXY& tilePos);
+
 void map_count_remaining_land_rights();
 void map_strip_ghost_flag_from_elements();
 void map_update_tile_pointers();
@@ -163,6 +259,7 @@ EntranceElement* map_get_park_entrance_element_at(const CoordsXYZ& entranceCoord
 EntranceElement* map_get_ride_entrance_element_at(const CoordsXYZ& entranceCoords, bool ghost);
 EntranceElement* map_get_ride_exit_element_at(const CoordsXYZ& exitCoords, bool ghost);
 int16_t tile_element_height(const CoordsXY& loc);
+int16_t tile_element_height(const SurfaceElement& surfaceElement, const CoordsXY& loc);
 int16_t tile_element_water_height(const CoordsXY& loc);
 uint8_t map_get_highest_land_height(const MapRange& range);
 uint8_t map_get_lowest_land_height(const MapRange& range);
@@ -185,6 +282,27 @@ void map_reorganise_elements();
 bool map_check_free_elements_and_reorganise(int32_t num_elements);
 TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants);
 
+/**
+ * Rebuilds the free element runs, must be called after the tile pointers were changed directly.
+ */
+void map_rebuild_free_elements();
+
+struct MapElementStats
+{
+    // Elements in use by tiles.
+    uint32_t UsedElements;
+    // Free elements left between the tiles and the number of runs they are split into.
+    uint32_t FreeElements;
+    uint32_t FreeRuns;
+    uint32_t LargestFreeRun;
+    // Tile runs moved down to make room at the end and the time spent on it in microseconds.
+    uint32_t CompactionMoves;
+    uint64_t CompactionTime;
+    // Whole map element list defragmentations, saving a park always does one.
+    uint32_t Reorganisations;
+};
+MapElementStats map_get_element_stats();
+
 namespace GameActions
 {
     class Result;
@@ -16,6 +16,7 @@
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
 #include "../ride/Track.h"
+#include "../ride/Vehicle.h"
 #include "../world/Wall.h"
 #include "Banner.h"
 #include "Footpath.h"
@@ -48,6 +49,8 @@ static bool DoesAnimationExist(int32_t type, const CoordsXYZ& location)
 
 void map_animation_create(int32_t type, const CoordsXYZ& loc)
 {
+    vehicle_motion_require_serial();
+
     if (!DoesAnimationExist(type, loc))
     {
         if (_mapAnimations.size() < MAX_ANIMATED_OBJECTS)
@@ -37,6 +37,7 @@
 #include "../windows/Intent.h"
 #include "Entrance.h"
 #include "Map.h"
+#include "ParkAggregates.h"
 #include "Sprite.h"
 #include "Surface.h"
 
@@ -319,6 +320,10 @@ void Park::Update(const Date& date)
         _suggestedGuestMaximum = CalculateSuggestedMaxGuests();
         _guestGenerationProbability = CalculateGuestGenerationProbability();
 
+#if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+        park_aggregates_verify();
+#endif // defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+
         window_invalidate_by_class(WC_FINANCES);
         auto intent = Intent(INTENT_ACTION_UPDATE_PARK_RATING);
         context_broadcast_intent(&intent);
@@ -326,7 +331,7 @@ void Park::Update(const Date& date)
     // Every ~102 seconds
     if (gCurrentTicks % 4096 == 0)
     {
-        gParkSize = CalculateParkSize();
+        gParkSize = park_aggregates_get().OwnedTiles;
         window_invalidate_by_class(WC_PARK_INFORMATION);
     }
     // Every new week
@@ -355,12 +360,6 @@ int32_t Park::CalculateParkSize() const
         }
     } while (tile_element_iterator_next(&it));
 
-    if (tiles != gParkSize)
-    {
-        gParkSize = tiles;
-        window_invalidate_by_class(WC_PARK_INFORMATION);
-    }
-
     return tiles;
 }
 
@@ -382,23 +381,10 @@ int32_t Park::CalculateParkRating() const
         // -150 to +3 based on a range of guests from 0 to 2000
         result -= 150 - (std::min<int16_t>(2000, gNumGuestsInPark) / 13);
 
-        // Find the number of happy peeps and the number of peeps who can't find the park exit
-        uint32_t happyGuestCount = 0;
-        uint32_t lostGuestCount = 0;
-        for (auto peep : EntityList<Guest>(EntityListId::Peep))
-        {
-            if (!peep->OutsideOfPark)
-            {
-                if (peep->Happiness > 128)
-                {
-                    happyGuestCount++;
-                }
-                if ((peep->PeepFlags & PEEP_FLAGS_LEAVING_PARK) && (peep->GuestIsLostCountdown < 90))
-                {
-                    lostGuestCount++;
-                }
-            }
-        }
+        // The number of happy peeps and the number of peeps who can't find the park exit
+        const auto& aggregates = park_aggregates_get();
+        uint32_t happyGuestCount = aggregates.HappyGuests;
+        uint32_t lostGuestCount = aggregates.LostGuests;
 
         // Peep happiness -500 to +0
         result -= 500;
@@ -467,15 +453,9 @@ int32_t Park::CalculateParkRating() const
 
     // Litter
     {
-        int32_t litterCount = 0;
-        for (auto litter : EntityList<Litter>(EntityListId::Litter))
-        {
-            // Ignore recently dropped litter
-            if (litter->creationTick - gScenarioTicks >= 7680)
-            {
-                litterCount++;
-            }
-        }
+        // Ignore recently dropped litter
+        int32_t litterCount = GetEntityListCount(EntityListId::Litter)
+            - static_cast<int32_t>(park_aggregates_get().NewLitter);
         result -= 600 - (4 * (150 - std::min<int32_t>(150, litterCount)));
     }
 
@@ -0,0 +1,250 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ParkAggregates.h"
+
+#include "../scenario/Scenario.h"
+#include "Map.h"
+#include "Sprite.h"
+#include "Surface.h"
+
+/**
+ * What a guest adds to the aggregates, kept per sprite index so it can be taken away again when the guest changes.
+ */
+struct GuestContribution
+{
+    bool Counted;
+    bool InPark;
+    bool Happy;
+    bool Lost;
+    PeepThoughtType FreshThought;
+};
+
+static ParkAggregates _aggregates;
+static GuestContribution _guestContributions[MAX_SPRITES];
+static uint32_t _newLitterTick;
+static bool _tilesNeedRecount = true;
+static bool _entitiesNeedRecount = true;
+
+uint32_t ParkAggregates::GetFreshThoughtCount(PeepThoughtType type) const
+{
+    return FreshThoughts[static_cast<uint8_t>(type)];
+}
+
+static bool park_aggregates_is_owned(uint8_t ownership)
+{
+    return (ownership & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED)) != 0;
+}
+
+static uint32_t park_aggregates_count_owned_tiles()
+{
+    uint32_t tiles = 0;
+    tile_element_iterator it;
+    tile_element_iterator_begin(&it);
+    do
+    {
+        if (it.element->GetType() == TILE_ELEMENT_TYPE_SURFACE)
+        {
+            if (park_aggregates_is_owned(it.element->AsSurface()->GetOwnership()))
+            {
+                tiles++;
+            }
+        }
+    } while (tile_element_iterator_next(&it));
+    return tiles;
+}
+
+static GuestContribution park_aggregates_get_contribution(const Peep* peep)
+{
+    GuestContribution contribution{};
+    contribution.FreshThought = PeepThoughtType::None;
+    if (peep == nullptr || !peep->Is<Guest>())
+        return contribution;
+
+    contribution.Counted = true;
+    if (!peep->OutsideOfPark)
+    {
+        contribution.InPark = true;
+        contribution.Happy = peep->Happiness > 128;
+        contribution.Lost = (peep->PeepFlags & PEEP_FLAGS_LEAVING_PARK) && peep->GuestIsLostCountdown < 90;
+        if (peep->Thoughts[0].freshness <= 5)
+        {
+            contribution.FreshThought = peep->Thoughts[0].type;
+        }
+    }
+    return contribution;
+}
+
+static void park_aggregates_apply(ParkAggregates& aggregates, const GuestContribution& contribution, uint32_t delta)
+{
+    // delta is 1 or the two's complement of 1, the unsigned totals wrap back into range.
+    if (!contribution.InPark)
+        return;
+
+    aggregates.GuestsInPark += delta;
+    if (contribution.Happy)
+        aggregates.HappyGuests += delta;
+    if (contribution.Lost)
+        aggregates.LostGuests += delta;
+    aggregates.FreshThoughts[static_cast<uint8_t>(contribution.FreshThought)] += delta;
+}
+
+static void park_aggregates_count_entities(ParkAggregates& aggregates, GuestContribution* contributions)
+{
+    aggregates.GuestsInPark = 0;
+    aggregates.HappyGuests = 0;
+    aggregates.LostGuests = 0;
+    aggregates.FreshThoughts.fill(0);
+    aggregates.NewLitter = 0;
+
+    for (auto guest : EntityList<Guest>(EntityListId::Peep))
+    {
+        auto contribution = park_aggregates_get_contribution(guest);
+        park_aggregates_apply(aggregates, contribution, 1);
+        if (contributions != nullptr)
+        {
+            contributions[guest->sprite_index] = contribution;
+        }
+    }
+
+    for (auto litter : EntityList<Litter>(EntityListId::Litter))
+    {
+        if (litter->creationTick == gScenarioTicks)
+        {
+            aggregates.NewLitter++;
+        }
+    }
+}
+
+const ParkAggregates& park_aggregates_get()
+{
+    if (_tilesNeedRecount)
+    {
+        _aggregates.OwnedTiles = park_aggregates_count_owned_tiles();
+        _tilesNeedRecount = false;
+    }
+    if (_entitiesNeedRecount)
+    {
+        std::fill(std::begin(_guestContributions), std::end(_guestContributions), GuestContribution{});
+        park_aggregates_count_entities(_aggregates, _guestContributions);
+        _newLitterTick = gScenarioTicks;
+        _entitiesNeedRecount = false;
+    }
+    if (_newLitterTick != gScenarioTicks)
+    {
+        _aggregates.NewLitter = 0;
+        _newLitterTick = gScenarioTicks;
+    }
+    return _aggregates;
+}
+
+void park_aggregates_invalidate_tiles()
+{
+    _tilesNeedRecount = true;
+}
+
+void park_aggregates_invalidate_entities()
+{
+    _entitiesNeedRecount = true;
+}
+
+void park_aggregates_set_ownership(const SurfaceElement* surfaceElement, uint8_t oldOwnership, uint8_t newOwnership)
+{
+    bool wasOwned = park_aggregates_is_owned(oldOwnership);
+    bool isOwned = park_aggregates_is_owned(newOwnership);
+    if (wasOwned == isOwned || _tilesNeedRecount)
+        return;
+
+    // Elements outside of the tile storage, such as the ones of a swapped out track design preview, are not counted.
+    auto element = reinterpret_cast<const TileElement*>(surfaceElement);
+    if (!map_is_element_in_storage(element))
+        return;
+
+    if (isOwned)
+        _aggregates.OwnedTiles++;
+    else
+        _aggregates.OwnedTiles--;
+}
+
+void park_aggregates_update_guest(const Peep* peep)
+{
+    if (peep == nullptr || peep->sprite_index >= MAX_SPRITES || _entitiesNeedRecount)
+        return;
+
+    auto& contribution = _guestContributions[peep->sprite_index];
+    auto newContribution = park_aggregates_get_contribution(peep);
+    park_aggregates_apply(_aggregates, contribution, static_cast<uint32_t>(-1));
+    park_aggregates_apply(_aggregates, newContribution, 1);
+    contribution = newContribution;
+}
+
+void park_aggregates_add_litter(const Litter* litter)
+{
+    if (litter == nullptr || _entitiesNeedRecount)
+        return;
+
+    if (_newLitterTick != gScenarioTicks)
+    {
+        _aggregates.NewLitter = 0;
+        _newLitterTick = gScenarioTicks;
+    }
+    if (litter->creationTick == gScenarioTicks)
+    {
+        _aggregates.NewLitter++;
+    }
+}
+
+void park_aggregates_remove_entity(const SpriteBase* sprite)
+{
+    if (sprite == nullptr || sprite->sprite_index >= MAX_SPRITES || _entitiesNeedRecount)
+        return;
+
+    auto& contribution = _guestContributions[sprite->sprite_index];
+    park_aggregates_apply(_aggregates, contribution, static_cast<uint32_t>(-1));
+    contribution = GuestContribution{};
+
+    auto litter = sprite->As<Litter>();
+    if (litter != nullptr && litter->creationTick == gScenarioTicks && _newLitterTick == gScenarioTicks)
+    {
+        _aggregates.NewLitter--;
+    }
+}
+
+bool park_aggregates_verify()
+{
+    const auto& aggregates = park_aggregates_get();
+    ParkAggregates expected{};
+    expected.OwnedTiles = park_aggregates_count_owned_tiles();
+    park_aggregates_count_entities(expected, nullptr);
+
+    bool result = true;
+    auto compare = [&result](const char* name, uint32_t value, uint32_t expectedValue) {
+        if (value != expectedValue)
+        {
+            log_error("Park aggregate %s is %u, counted %u", name, value, expectedValue);
+            result = false;
+        }
+    };
+    compare("OwnedTiles", aggregates.OwnedTiles, expected.OwnedTiles);
+    compare("GuestsInPark", aggregates.GuestsInPark, expected.GuestsInPark);
+    compare("HappyGuests", aggregates.HappyGuests, expected.HappyGuests);
+    compare("LostGuests", aggregates.LostGuests, expected.LostGuests);
+    compare("NewLitter", aggregates.NewLitter, expected.NewLitter);
+    for (size_t i = 0; i < expected.FreshThoughts.size(); i++)
+    {
+        if (aggregates.FreshThoughts[i] != expected.FreshThoughts[i])
+        {
+            log_error(
+                "Park aggregate FreshThoughts[%zu] is %u, counted %u", i, aggregates.FreshThoughts[i],
+                expected.FreshThoughts[i]);
+            result = false;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,67 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <array>
+
+enum class PeepThoughtType : uint8_t;
+struct Litter;
+struct Peep;
+struct SpriteBase;
+struct SurfaceElement;
+
+/**
+ * Running totals of the park state read by the park rating, park size and award checks. They are kept up to date where
+ * the state changes so the periodic park updates do not have to scan every tile element and every guest.
+ */
+struct ParkAggregates
+{
+    // Surface elements with owned land or construction rights.
+    uint32_t OwnedTiles;
+    // Guests that are not outside of the park and the ones among them counted by the park rating.
+    uint32_t GuestsInPark;
+    uint32_t HappyGuests;
+    uint32_t LostGuests;
+    // Guests in the park by the type of their newest thought, if it is at most 5 updates old.
+    std::array<uint32_t, 256> FreshThoughts;
+    // Litter created in the current scenario tick, the park rating ignores it.
+    uint32_t NewLitter;
+
+    uint32_t GetFreshThoughtCount(PeepThoughtType type) const;
+};
+
+/**
+ * Returns the aggregates, counting everything again first if they were invalidated.
+ */
+const ParkAggregates& park_aggregates_get();
+
+/**
+ * The tile storage or the entities were replaced without going through the functions below, the next read counts them
+ * again.
+ */
+void park_aggregates_invalidate_tiles();
+void park_aggregates_invalidate_entities();
+
+void park_aggregates_set_ownership(const SurfaceElement* surfaceElement, uint8_t oldOwnership, uint8_t newOwnership);
+
+/**
+ * Counts the guest again, must be called after the fields read by the aggregates change outside of the guest's own
+ * update.
+ */
+void park_aggregates_update_guest(const Peep* peep);
+void park_aggregates_add_litter(const Litter* litter);
+void park_aggregates_remove_entity(const SpriteBase* sprite);
+
+/**
+ * Compares the aggregates with a count of the whole map and all guests and logs the ones that differ.
+ */
+bool park_aggregates_verify();
@@ -18,12 +18,16 @@
 #include "../interface/Viewport.h"
 #include "../localisation/Date.h"
 #include "../localisation/Localisation.h"
+#include "../ride/Vehicle.h"
 #include "../scenario/Scenario.h"
 #include "Fountain.h"
+#include "ParkAggregates.h"
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iterator>
+#include <vector>
 
 uint16_t gSpriteListHead[static_cast<uint8_t>(EntityListId::Count)];
 uint16_t gSpriteListCount[static_cast<uint8_t>(EntityListId::Count)];
@@ -218,6 +222,10 @@ void reset_sprite_list()
  */
 void reset_sprite_spatial_index()
 {
+    // Called after loading entities, none of the stored digests and park aggregates can be trusted anymore.
+    sprite_checksum_invalidate_all();
+    park_aggregates_invalidate_entities();
+
     std::fill_n(gSpriteSpatialIndex, std::size(gSpriteSpatialIndex), SPRITE_INDEX_NULL);
     for (size_t i = 0; i < MAX_SPRITES; i++)
     {
@@ -237,17 +245,12 @@ static size_t GetSpatialIndexOffset(int32_t x, int32_t y)
     size_t index = SPATIAL_INDEX_LOCATION_NULL;
     if (x != LOCATION_NULL)
     {
-        x = std::clamp(x, 0, 0xFFFF);
-        y = std::clamp(y, 0, 0xFFFF);
-
-        int16_t flooredX = floor2(x, 32);
-        uint8_t tileY = y >> 5;
-        index = (flooredX << 3) | tileY;
-    }
-
-    if (index >= sizeof(gSpriteSpatialIndex))
-    {
-        return SPATIAL_INDEX_LOCATION_NULL;
+        auto tileX = std::clamp(x, 0, 0xFFFF) / COORDS_XY_STEP;
+        auto tileY = std::clamp(y, 0, 0xFFFF) / COORDS_XY_STEP;
+        if (tileX < MAXIMUM_MAP_SIZE_EXTENDED && tileY < MAXIMUM_MAP_SIZE_EXTENDED)
+        {
+            index = static_cast<size_t>(tileX) * MAXIMUM_MAP_SIZE_EXTENDED + tileY;
+        }
     }
     return index;
 }
@@ -329,6 +332,139 @@ rct_sprite_checksum sprite_checksum()
 
 #endif // DISABLE_NETWORK
 
+// Per-entity digests for the incremental checksum. The combined value is the wrapping sum of all mixed digests, so it is
+// independent of the order entities are visited in and a single entity can be replaced without touching the rest.
+static uint64_t _spriteDigests[MAX_SPRITES];
+static uint64_t _spriteDigestSum;
+static bool _spriteDigestDirty[MAX_SPRITES];
+static std::vector<uint16_t> _spriteDigestDirtyList;
+static bool _spriteDigestRebuildAll = true;
+
+static uint64_t sprite_checksum_mix(uint64_t value)
+{
+    // splitmix64 finaliser
+    value ^= value >> 30;
+    value *= 0xBF58476D1CE4E5B9ULL;
+    value ^= value >> 27;
+    value *= 0x94D049BB133111EBULL;
+    value ^= value >> 31;
+    return value;
+}
+
+static uint64_t sprite_checksum_hash_bytes(const void* data, size_t length)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = 0xCBF29CE484222325ULL ^ length;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ word) * 0x100000001B3ULL;
+        hash ^= hash >> 29;
+    }
+    for (; i < length; i++)
+    {
+        hash = (hash ^ bytes[i]) * 0x100000001B3ULL;
+    }
+    return sprite_checksum_mix(hash);
+}
+
+/**
+ * Hashes the identity, position and state of a single entity. These only change when the entity is created or removed,
+ * through MoveTo and through the state setters, which is where the entity is marked dirty.
+ */
+static uint64_t sprite_checksum_digest(size_t index)
+{
+    auto sprite = GetEntity(index);
+    if (sprite == nullptr || sprite->sprite_identifier == SpriteIdentifier::Null
+        || sprite->sprite_identifier == SpriteIdentifier::Misc)
+    {
+        return 0;
+    }
+
+    struct
+    {
+        int32_t X;
+        int32_t Y;
+        int32_t Z;
+        uint8_t Identifier;
+        uint8_t Type;
+        uint8_t State;
+        uint8_t Padding;
+    } state{};
+    state.X = sprite->x;
+    state.Y = sprite->y;
+    state.Z = sprite->z;
+    state.Identifier = static_cast<uint8_t>(sprite->sprite_identifier);
+    state.Type = sprite->type;
+    if (auto peep = sprite->As<Peep>(); peep != nullptr)
+    {
+        state.State = static_cast<uint8_t>(peep->State);
+    }
+    else if (auto vehicle = sprite->As<Vehicle>(); vehicle != nullptr)
+    {
+        state.State = static_cast<uint8_t>(vehicle->status);
+    }
+
+    auto hash = sprite_checksum_hash_bytes(&state, sizeof(state));
+    return sprite_checksum_mix(hash ^ (static_cast<uint64_t>(index) * 0x9E3779B97F4A7C15ULL));
+}
+
+void sprite_checksum_invalidate(const SpriteBase* sprite)
+{
+    if (sprite == nullptr || sprite->sprite_index >= MAX_SPRITES || _spriteDigestRebuildAll)
+        return;
+
+    if (vehicle_motion_defer_checksum_invalidate(sprite))
+        return;
+
+    if (!_spriteDigestDirty[sprite->sprite_index])
+    {
+        _spriteDigestDirty[sprite->sprite_index] = true;
+        _spriteDigestDirtyList.push_back(sprite->sprite_index);
+    }
+}
+
+void sprite_checksum_invalidate_all()
+{
+    _spriteDigestRebuildAll = true;
+}
+
+rct_sprite_checksum sprite_checksum_incremental()
+{
+    if (_spriteDigestRebuildAll)
+    {
+        _spriteDigestSum = 0;
+        for (size_t i = 0; i < MAX_SPRITES; i++)
+        {
+            _spriteDigests[i] = sprite_checksum_digest(i);
+            _spriteDigestSum += _spriteDigests[i];
+            _spriteDigestDirty[i] = false;
+        }
+        _spriteDigestDirtyList.clear();
+        _spriteDigestRebuildAll = false;
+    }
+    else
+    {
+        for (auto index : _spriteDigestDirtyList)
+        {
+            auto digest = sprite_checksum_digest(index);
+            _spriteDigestSum += digest - _spriteDigests[index];
+            _spriteDigests[index] = digest;
+            _spriteDigestDirty[index] = false;
+        }
+        _spriteDigestDirtyList.clear();
+    }
+
+    rct_sprite_checksum checksum{};
+    for (size_t i = 0; i < sizeof(_spriteDigestSum); i++)
+    {
+        checksum.raw[i] = static_cast<uint8_t>(_spriteDigestSum >> ((sizeof(_spriteDigestSum) - 1 - i) * 8));
+    }
+    return checksum;
+}
+
 static void sprite_reset(SpriteBase* sprite)
 {
     // Need to retain how the sprite is linked in lists
@@ -377,6 +513,8 @@ static constexpr uint16_t MAX_MISC_SPRITES = 300;
 
 rct_sprite* create_sprite(SpriteIdentifier spriteIdentifier, EntityListId linkedListIndex)
 {
+    vehicle_motion_require_serial();
+
     if (GetEntityListCount(EntityListId::Free) == 0)
     {
         // No free sprites.
@@ -401,6 +539,7 @@ rct_sprite* create_sprite(SpriteIdentifier spriteIdentifier, EntityListId linked
         return nullptr;
     }
     move_sprite_to_list(sprite, linkedListIndex);
+    sprite_checksum_invalidate(sprite);
 
     // Need to reset all sprite data, as the uninitialised values
     // may contain garbage and cause a desync later on.
@@ -676,9 +815,9 @@ static void SpriteSpatialInsert(SpriteBase* sprite, const CoordsXY& newLoc)
     *next = sprite->sprite_index;
 }
 
-static void SpriteSpatialRemove(SpriteBase* sprite)
+static void SpriteSpatialRemove(SpriteBase* sprite, const CoordsXY& currentLoc)
 {
-    size_t currentIndex = GetSpatialIndexOffset(sprite->x, sprite->y);
+    size_t currentIndex = GetSpatialIndexOffset(currentLoc.x, currentLoc.y);
     auto* index = &gSpriteSpatialIndex[currentIndex];
 
     // This indicates that the spatial index data is incorrect.
@@ -701,17 +840,27 @@ static void SpriteSpatialRemove(SpriteBase* sprite)
     *index = sprite->next_in_quadrant;
 }
 
-static void SpriteSpatialMove(SpriteBase* sprite, const CoordsXY& newLoc)
+static void SpriteSpatialRemove(SpriteBase* sprite)
+{
+    SpriteSpatialRemove(sprite, { sprite->x, sprite->y });
+}
+
+static void SpriteSpatialMove(SpriteBase* sprite, const CoordsXY& currentLoc, const CoordsXY& newLoc)
 {
     size_t newIndex = GetSpatialIndexOffset(newLoc.x, newLoc.y);
-    size_t currentIndex = GetSpatialIndexOffset(sprite->x, sprite->y);
+    size_t currentIndex = GetSpatialIndexOffset(currentLoc.x, currentLoc.y);
     if (newIndex == currentIndex)
         return;
 
-    SpriteSpatialRemove(sprite);
+    SpriteSpatialRemove(sprite, currentLoc);
     SpriteSpatialInsert(sprite, newLoc);
 }
 
+void sprite_spatial_move_from(SpriteBase* sprite, const CoordsXY& oldLoc)
+{
+    SpriteSpatialMove(sprite, oldLoc, { sprite->x, sprite->y });
+}
+
 /**
  * Moves a sprite to a new location.
  *  rct2: 0x0069E9D3
@@ -729,7 +878,11 @@ void SpriteBase::MoveTo(const CoordsXYZ& newLocation)
         loc.x = LOCATION_NULL;
     }
 
-    SpriteSpatialMove(this, loc);
+    if (!vehicle_motion_defer_spatial_move(this))
+    {
+        SpriteSpatialMove(this, { x, y }, loc);
+    }
+    sprite_checksum_invalidate(this);
 
     if (loc.x == LOCATION_NULL)
     {
@@ -763,15 +916,19 @@ void sprite_set_coordinates(const CoordsXYZ& spritePos, SpriteBase* sprite)
  */
 void sprite_remove(SpriteBase* sprite)
 {
+    vehicle_motion_require_serial();
+
     auto peep = sprite->As<Peep>();
     if (peep != nullptr)
     {
         peep->SetName({});
     }
 
+    park_aggregates_remove_entity(sprite);
     move_sprite_to_list(sprite, EntityListId::Free);
     sprite->sprite_identifier = SpriteIdentifier::Null;
     _spriteFlashingList[sprite->sprite_index] = false;
+    sprite_checksum_invalidate(sprite);
 
     SpriteSpatialRemove(sprite);
 }
@@ -849,6 +1006,7 @@ void litter_create(const CoordsXYZD& litterPos, int32_t type)
     litter->MoveTo(offsetLitterPos);
     litter->Invalidate0();
     litter->creationTick = gScenarioTicks;
+    park_aggregates_add_litter(litter);
 }
 
 /**
@@ -227,7 +227,8 @@ uint16_t GetEntityListCount(EntityListId list);
 extern uint16_t gSpriteListHead[static_cast<uint8_t>(EntityListId::Count)];
 extern uint16_t gSpriteListCount[static_cast<uint8_t>(EntityListId::Count)];
 
-constexpr const uint32_t SPATIAL_INDEX_SIZE = (MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL) + 1;
+// Covers the largest map so it does not depend on the tile storage, which the track design preview swaps out.
+constexpr const uint32_t SPATIAL_INDEX_SIZE = (MAXIMUM_MAP_SIZE_EXTENDED * MAXIMUM_MAP_SIZE_EXTENDED) + 1;
 constexpr const uint32_t SPATIAL_INDEX_LOCATION_NULL = SPATIAL_INDEX_SIZE - 1;
 extern uint16_t gSpriteSpatialIndex[SPATIAL_INDEX_SIZE];
 
@@ -237,6 +238,11 @@ rct_sprite* create_sprite(SpriteIdentifier spriteIdentifier);
 rct_sprite* create_sprite(SpriteIdentifier spriteIdentifier, EntityListId linkedListIndex);
 void reset_sprite_list();
 void reset_sprite_spatial_index();
+/**
+ * Moves the sprite in the spatial index from where it was at oldLoc to where it is now, for moves that were held back
+ * while the index could not be changed.
+ */
+void sprite_spatial_move_from(SpriteBase* sprite, const CoordsXY& oldLoc);
 void sprite_clear_all_unused();
 void sprite_misc_update_all();
 void sprite_set_coordinates(const CoordsXYZ& spritePos, SpriteBase* sprite);
@@ -274,6 +280,16 @@ void crash_splash_create(const CoordsXYZ& splashPos);
 
 rct_sprite_checksum sprite_checksum();
 
+/**
+ * Cheap checksum of the identity, position and state of the entities, built from cached per-entity digests. Only
+ * entities passed to sprite_checksum_invalidate since the last call are rehashed, MoveTo and the state setters do
+ * that. The result is not comparable to the SHA1 based sprite_checksum of all entity fields, which stays the reference
+ * used for replays and verification.
+ */
+rct_sprite_checksum sprite_checksum_incremental();
+void sprite_checksum_invalidate(const SpriteBase* sprite);
+void sprite_checksum_invalidate_all();
+
 void sprite_set_flashing(SpriteBase* sprite, bool flashing);
 bool sprite_get_flashing(SpriteBase* sprite);
 int32_t check_for_sprite_list_cycles(bool fix);
@@ -14,6 +14,7 @@
 #include "../localisation/Localisation.h"
 #include "../ride/Track.h"
 #include "Banner.h"
+#include "FootpathGraph.h"
 #include "LargeScenery.h"
 #include "Location.hpp"
 #include "Scenery.h"
@@ -65,6 +66,18 @@ bool TileElementBase::IsGhost() const
 
 void TileElementBase::SetGhost(bool isGhost)
 {
+    if (isGhost != IsGhost())
+    {
+        switch (GetType())
+        {
+            case TILE_ELEMENT_TYPE_PATH:
+            case TILE_ELEMENT_TYPE_TRACK:
+            case TILE_ELEMENT_TYPE_ENTRANCE:
+            case TILE_ELEMENT_TYPE_BANNER:
+                footpath_graph_invalidate_element(this);
+                break;
+        }
+    }
     if (isGhost)
     {
         this->Flags |= TILE_ELEMENT_FLAG_GHOST;
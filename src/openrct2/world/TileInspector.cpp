@@ -26,6 +26,7 @@
 #include "LargeScenery.h"
 #include "Map.h"
 #include "Park.h"
+#include "ParkAggregates.h"
 #include "Scenery.h"
 #include "Surface.h"
 
@@ -387,6 +388,10 @@ GameActionResultPtr tile_inspector_paste_element_at(const CoordsXY& loc, TileEle
         bool lastForTile = pastedElement->IsLastForTile();
         *pastedElement = element;
         pastedElement->SetLastForTile(lastForTile);
+        if (element.GetType() == TILE_ELEMENT_TYPE_SURFACE)
+        {
+            park_aggregates_invalidate_tiles();
+        }
 
         map_invalidate_tile_full(loc);
 
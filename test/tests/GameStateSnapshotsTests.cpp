@@ -0,0 +1,123 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/GameStateSnapshots.h>
+#include <openrct2/core/DataSerialiser.h>
+#include <openrct2/core/MemoryStream.h>
+#include <openrct2/world/Sprite.h>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class GameStateSnapshotsTests : public testing::Test
+{
+protected:
+    std::vector<SpriteBase*> _sprites;
+
+    void SetUp() override
+    {
+        reset_sprite_list();
+        for (int32_t i = 0; i < 200; i++)
+        {
+            auto spriteIdentifier = (i % 4 == 0) ? SpriteIdentifier::Litter : SpriteIdentifier::Peep;
+            auto sprite = create_sprite(spriteIdentifier);
+            ASSERT_NE(sprite, nullptr);
+            sprite->generic.sprite_identifier = spriteIdentifier;
+            sprite->generic.x = static_cast<int16_t>(i * 32);
+            sprite->generic.y = static_cast<int16_t>(i * 16);
+            _sprites.push_back(&sprite->generic);
+        }
+    }
+
+    // Moves a handful of entities, the same way a game tick would only touch part of the sprite pool.
+    void Simulate(uint32_t tick)
+    {
+        for (size_t i = tick % 7; i < _sprites.size(); i += 13)
+        {
+            _sprites[i]->z += static_cast<int16_t>(tick);
+        }
+    }
+
+    static MemoryStream Serialise(IGameStateSnapshots& snapshots, const GameStateSnapshot_t& snapshot)
+    {
+        MemoryStream ms;
+        DataSerialiser ds(true, ms);
+        snapshots.SerialiseSnapshot(const_cast<GameStateSnapshot_t&>(snapshot), ds);
+        return ms;
+    }
+
+    static void AssertStreamsEqual(const MemoryStream& a, const MemoryStream& b)
+    {
+        ASSERT_EQ(a.GetLength(), b.GetLength());
+        ASSERT_EQ(std::memcmp(a.GetData(), b.GetData(), static_cast<size_t>(a.GetLength())), 0);
+    }
+};
+
+TEST_F(GameStateSnapshotsTests, LinkedSnapshotsMatchFullCaptures)
+{
+    auto snapshots = CreateGameStateSnapshots();
+    auto reference = CreateGameStateSnapshots();
+
+    std::vector<MemoryStream> expected;
+    for (uint32_t tick = 0; tick < 48; tick++)
+    {
+        Simulate(tick);
+
+        auto& snapshot = snapshots->CreateSnapshot();
+        snapshots->Capture(snapshot);
+        snapshots->LinkSnapshot(snapshot, tick, tick);
+
+        auto full = reference->CreateDetachedSnapshot();
+        reference->Capture(*full);
+        reference->LinkSnapshot(*full, tick, tick);
+        expected.push_back(Serialise(*reference, *full));
+    }
+
+    // Only the most recent snapshots are kept, those include keyframes promoted on eviction.
+    ASSERT_EQ(snapshots->GetLinkedSnapshot(0), nullptr);
+    for (uint32_t tick = 16; tick < 48; tick++)
+    {
+        auto snapshot = snapshots->GetLinkedSnapshot(tick);
+        ASSERT_NE(snapshot, nullptr);
+        AssertStreamsEqual(Serialise(*snapshots, *snapshot), expected[tick]);
+    }
+}
+
+TEST_F(GameStateSnapshotsTests, DeltaSerialisationRoundTrip)
+{
+    auto snapshots = CreateGameStateSnapshots();
+
+    auto base = snapshots->CreateDetachedSnapshot();
+    snapshots->Capture(*base);
+    snapshots->LinkSnapshot(*base, 1, 1);
+
+    Simulate(1);
+    auto current = snapshots->CreateDetachedSnapshot();
+    snapshots->Capture(*current);
+    snapshots->LinkSnapshot(*current, 2, 2);
+
+    MemoryStream delta;
+    {
+        DataSerialiser ds(true, delta);
+        snapshots->SerialiseSnapshotDelta(*base, *current, ds);
+    }
+    auto full = Serialise(*snapshots, *current);
+    ASSERT_LT(delta.GetLength(), full.GetLength());
+
+    delta.SetPosition(0);
+    auto loaded = snapshots->CreateDetachedSnapshot();
+    {
+        DataSerialiser ds(false, delta);
+        snapshots->SerialiseSnapshotDelta(*base, *loaded, ds);
+    }
+    AssertStreamsEqual(Serialise(*snapshots, *loaded), full);
+}
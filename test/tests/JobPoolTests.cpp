@@ -0,0 +1,68 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <openrct2/core/JobPool.h>
+#include <thread>
+#include <vector>
+
+TEST(JobPoolTests, ParallelForVisitsEveryIndexOnce)
+{
+    JobPool pool;
+    std::vector<std::atomic<int32_t>> visits(10000);
+    pool.ParallelFor(visits.size(), [&visits](size_t i) { visits[i]++; });
+    for (auto& visit : visits)
+    {
+        ASSERT_EQ(visit, 1);
+    }
+}
+
+TEST(JobPoolTests, NestedParallelFor)
+{
+    JobPool pool;
+    std::atomic<size_t> sum = { 0 };
+    pool.ParallelFor(64, [&pool, &sum](size_t i) { pool.ParallelFor(100, [&sum, i](size_t j) { sum += i * j; }); });
+
+    size_t expected = 0;
+    for (size_t i = 0; i < 64; i++)
+        for (size_t j = 0; j < 100; j++)
+            expected += i * j;
+    ASSERT_EQ(sum, expected);
+}
+
+TEST(JobPoolTests, ParallelForWithoutWorkers)
+{
+    JobPool pool(0);
+    size_t sum = 0;
+    pool.ParallelFor(1000, [&sum](size_t i) { sum += i; });
+    ASSERT_EQ(sum, 999u * 1000u / 2);
+}
+
+TEST(JobPoolTests, JoinDispatchesCompletionsOnCallingThread)
+{
+    JobPool pool;
+    std::atomic<int32_t> work = { 0 };
+    int32_t completions = 0;
+    auto callingThread = std::this_thread::get_id();
+
+    // More tasks than fit in the worker queues, the rest run right away.
+    for (int32_t i = 0; i < 2000; i++)
+    {
+        pool.AddTask([&work]() { work++; }, [&completions, callingThread]() {
+            ASSERT_EQ(std::this_thread::get_id(), callingThread);
+            completions++;
+        });
+    }
+    pool.Join();
+
+    ASSERT_EQ(work, 2000);
+    ASSERT_EQ(completions, 2000);
+    ASSERT_EQ(pool.CountPending(), 0u);
+}
@@ -0,0 +1,337 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/Context.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/platform/platform.h>
+#include <openrct2/world/Map.h>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class MapStorageTest : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        core_init();
+        _context = CreateContext();
+        bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+    }
+
+    static void TearDownTestCase()
+    {
+        _context = nullptr;
+    }
+
+    void SetUp() override
+    {
+        // Not the size a new park gets, the storage does not depend on it.
+        map_init(MapSize);
+    }
+
+    static TileElement* InsertElement(const TileCoordsXY& tilePos, int32_t z)
+    {
+        return tile_element_insert({ tilePos.ToCoordsXY(), z }, 0b1111);
+    }
+
+    /**
+     * Fills the storage like the park importers do, one surface per tile and all of the room the map allows.
+     */
+    static void ResetFullStorage()
+    {
+        map_resize_storage(MAX_TILE_ELEMENTS_WITH_SPARE_ROOM);
+        for (int32_t i = 0; i < MAX_TILE_TILE_ELEMENT_POINTERS; i++)
+        {
+            gTileElements[i].ClearAs(TILE_ELEMENT_TYPE_SURFACE);
+            gTileElements[i].SetLastForTile(true);
+        }
+        map_update_tile_pointers();
+    }
+
+    static void RemoveInsertedElements(const TileCoordsXY& tilePos)
+    {
+        auto firstElement = map_get_first_element_at(tilePos.ToCoordsXY());
+        while (!firstElement->IsLastForTile())
+        {
+            tile_element_remove(firstElement + 1);
+        }
+    }
+
+    static uint32_t CountElements(const TileElement* element)
+    {
+        uint32_t count = 1;
+        while (!(element++)->IsLastForTile())
+            count++;
+        return count;
+    }
+
+    static constexpr int32_t MapSize = 64;
+    // Above the surface map_init creates, so inserted elements go after it.
+    static constexpr int32_t InsertZ = 200;
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> MapStorageTest::_context;
+
+TEST_F(MapStorageTest, TileIndicesRoundTrip)
+{
+    std::vector<bool> usedIndices(MAX_TILE_TILE_ELEMENT_POINTERS);
+    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    {
+        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        {
+            auto tileIndex = map_get_tile_index({ x, y });
+            ASSERT_LT(tileIndex, usedIndices.size());
+            ASSERT_FALSE(usedIndices[tileIndex]) << "Tile " << x << ", " << y << " shares its index";
+            usedIndices[tileIndex] = true;
+
+            auto firstElement = map_get_first_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
+            ASSERT_NE(firstElement, nullptr);
+            ASSERT_EQ(firstElement, gTileElementTilePointers[tileIndex]);
+            ASSERT_EQ(firstElement->GetType(), TILE_ELEMENT_TYPE_SURFACE);
+        }
+    }
+}
+
+TEST_F(MapStorageTest, LargerMapTileIndicesRoundTrip)
+{
+    // Rounded up to whole chunks.
+    map_init(500);
+    ASSERT_EQ(gMapSizeTechnical, 512);
+    ASSERT_EQ(gTileElementTilePointers.size(), 512u * 512u);
+    EXPECT_TRUE(map_is_location_valid(TileCoordsXY{ 511, 511 }.ToCoordsXY()));
+    EXPECT_FALSE(map_is_location_valid(TileCoordsXY{ 512, 0 }.ToCoordsXY()));
+
+    std::vector<bool> usedIndices(gTileElementTilePointers.size());
+    for (int32_t y = 0; y < gMapSizeTechnical; y++)
+    {
+        for (int32_t x = 0; x < gMapSizeTechnical; x++)
+        {
+            auto tileIndex = map_get_tile_index({ x, y });
+            ASSERT_LT(tileIndex, usedIndices.size());
+            ASSERT_FALSE(usedIndices[tileIndex]) << "Tile " << x << ", " << y << " shares its index";
+            usedIndices[tileIndex] = true;
+
+            auto firstElement = map_get_first_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
+            ASSERT_NE(firstElement, nullptr);
+            ASSERT_EQ(firstElement->GetType(), TILE_ELEMENT_TYPE_SURFACE);
+
+            TileCoordsXY tilePos;
+            ASSERT_TRUE(map_get_element_tile(firstElement, tilePos));
+            ASSERT_EQ(tilePos, (TileCoordsXY{ x, y }));
+        }
+    }
+
+    // Elements go onto tiles beyond the classic map and past the classic element limit.
+    for (int32_t x = 0; x < gMapSizeTechnical; x++)
+    {
+        for (int32_t y = MAXIMUM_MAP_SIZE_TECHNICAL; y < gMapSizeTechnical; y++)
+        {
+            ASSERT_NE(InsertElement({ x, y }, InsertZ), nullptr);
+        }
+    }
+    EXPECT_GT(map_get_element_stats().UsedElements, MAX_TILE_ELEMENTS);
+    EXPECT_EQ(CountElements(map_get_first_element_at(TileCoordsXY{ 400, 400 }.ToCoordsXY())), 2u);
+
+    int32_t numElements = 0;
+    tile_element_iterator it;
+    tile_element_iterator_begin(&it);
+    while (tile_element_iterator_next(&it))
+    {
+        numElements++;
+    }
+    EXPECT_EQ(numElements, 512 * 512 + 512 * (512 - MAXIMUM_MAP_SIZE_TECHNICAL));
+}
+
+TEST_F(MapStorageTest, InsertPastInitialCapacityKeepsElements)
+{
+    auto statsBefore = map_get_element_stats();
+
+    // Held like the result of a large scenery placement while the other tiles are inserted into.
+    const auto heldTile = TileCoordsXY{ 10, 10 };
+    auto heldElement = InsertElement(heldTile, InsertZ);
+    ASSERT_NE(heldElement, nullptr);
+    heldElement->SetClearanceZ(InsertZ + 64);
+
+    // map_init leaves room for one more element per tile, so this has to go past it.
+    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    {
+        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        {
+            if (TileCoordsXY{ x, y } != heldTile)
+            {
+                ASSERT_NE(InsertElement({ x, y }, InsertZ), nullptr);
+            }
+        }
+    }
+
+    auto stats = map_get_element_stats();
+    EXPECT_EQ(stats.UsedElements, MAX_TILE_TILE_ELEMENT_POINTERS * 2);
+    EXPECT_EQ(stats.CompactionMoves, statsBefore.CompactionMoves);
+    EXPECT_EQ(stats.Reorganisations, statsBefore.Reorganisations);
+
+    // The held element has not moved.
+    EXPECT_TRUE(map_is_element_in_storage(heldElement));
+    EXPECT_EQ(heldElement->GetBaseZ(), InsertZ);
+    EXPECT_EQ(heldElement->GetClearanceZ(), InsertZ + 64);
+    EXPECT_EQ(map_get_first_element_at(heldTile.ToCoordsXY()) + 1, heldElement);
+
+    bool usesAddedBlocks = false;
+    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    {
+        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        {
+            auto firstElement = map_get_first_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
+            ASSERT_NE(firstElement, nullptr);
+            ASSERT_EQ(firstElement, gTileElementTilePointers[map_get_tile_index({ x, y })]);
+            ASSERT_TRUE(map_is_element_in_storage(firstElement));
+            ASSERT_EQ(CountElements(firstElement), 2u);
+            ASSERT_EQ(firstElement[0].GetType(), TILE_ELEMENT_TYPE_SURFACE);
+            ASSERT_EQ(firstElement[1].GetBaseZ(), InsertZ);
+
+            auto elementsEnd = gTileElements.data() + gTileElements.size();
+            usesAddedBlocks |= firstElement < gTileElements.data() || firstElement >= elementsEnd;
+        }
+    }
+    EXPECT_TRUE(usesAddedBlocks);
+}
+
+TEST_F(MapStorageTest, SwapStorageKeepsElements)
+{
+    auto firstElement = map_get_first_element_at(TileCoordsXY{ 1, 1 }.ToCoordsXY());
+    ASSERT_NE(firstElement, nullptr);
+
+    TileElementStorage storage;
+    map_swap_storage(storage);
+    map_resize_storage(MAX_TILE_TILE_ELEMENT_POINTERS);
+    EXPECT_FALSE(map_is_element_in_storage(firstElement));
+
+    map_swap_storage(storage);
+    EXPECT_TRUE(map_is_element_in_storage(firstElement));
+    EXPECT_EQ(map_get_first_element_at(TileCoordsXY{ 1, 1 }.ToCoordsXY()), firstElement);
+}
+
+TEST_F(MapStorageTest, ElementStatsCountRuns)
+{
+    ResetFullStorage();
+    auto stats = map_get_element_stats();
+    EXPECT_EQ(stats.UsedElements, static_cast<uint32_t>(MAX_TILE_TILE_ELEMENT_POINTERS));
+    EXPECT_EQ(stats.FreeElements, 0u);
+    EXPECT_EQ(stats.FreeRuns, 0u);
+    EXPECT_EQ(stats.LargestFreeRun, 0u);
+
+    // Tiles that are not next to each other, each of them moves to the end and leaves its old element as a free run.
+    const TileCoordsXY tiles[] = { { 10, 10 }, { 20, 20 }, { 30, 30 } };
+    for (const auto& tilePos : tiles)
+    {
+        ASSERT_NE(InsertElement(tilePos, InsertZ), nullptr);
+    }
+    stats = map_get_element_stats();
+    EXPECT_EQ(stats.UsedElements, MAX_TILE_TILE_ELEMENT_POINTERS + 3u);
+    EXPECT_EQ(stats.FreeElements, 3u);
+    EXPECT_EQ(stats.FreeRuns, 3u);
+    EXPECT_EQ(stats.LargestFreeRun, 1u);
+
+    // The last tile is at the end, its free element goes back to the end instead of into a run.
+    RemoveInsertedElements(tiles[2]);
+    stats = map_get_element_stats();
+    EXPECT_EQ(stats.UsedElements, MAX_TILE_TILE_ELEMENT_POINTERS + 2u);
+    EXPECT_EQ(stats.FreeElements, 3u);
+    EXPECT_EQ(stats.FreeRuns, 3u);
+
+    RemoveInsertedElements(tiles[0]);
+    stats = map_get_element_stats();
+    EXPECT_EQ(stats.UsedElements, MAX_TILE_TILE_ELEMENT_POINTERS + 1u);
+    EXPECT_EQ(stats.FreeElements, 4u);
+    EXPECT_EQ(stats.FreeRuns, 4u);
+}
+
+TEST_F(MapStorageTest, InsertAndRemoveReusesFreedRun)
+{
+    ResetFullStorage();
+    const auto tilePos = TileCoordsXY{ 10, 10 };
+    ASSERT_NE(InsertElement(tilePos, InsertZ), nullptr);
+    ASSERT_NE(InsertElement({ 20, 20 }, InsertZ), nullptr);
+    auto statsBefore = map_get_element_stats();
+
+    for (int32_t i = 0; i < 100; i++)
+    {
+        RemoveInsertedElements(tilePos);
+        ASSERT_NE(InsertElement(tilePos, InsertZ), nullptr);
+
+        // The tile grows back into the element it freed, the end of the storage does not move.
+        auto stats = map_get_element_stats();
+        ASSERT_EQ(stats.UsedElements, statsBefore.UsedElements);
+        ASSERT_EQ(stats.FreeElements, statsBefore.FreeElements);
+        ASSERT_EQ(stats.FreeRuns, statsBefore.FreeRuns);
+    }
+    EXPECT_EQ(CountElements(map_get_first_element_at(tilePos.ToCoordsXY())), 2u);
+}
+
+TEST_F(MapStorageTest, CompactionMakesRoomWithoutReorganising)
+{
+    ResetFullStorage();
+    auto statsBefore = map_get_element_stats();
+
+    // Every other tile of a row, so the tiles can not grow into the elements their neighbours leave behind.
+    constexpr int32_t NumTiles = 640;
+    constexpr int32_t TilesPerRow = MAXIMUM_MAP_SIZE_TECHNICAL / 2;
+    auto getHoleTile = [](int32_t i) { return TileCoordsXY{ (i % TilesPerRow) * 2, i / TilesPerRow }; };
+    auto getEndTile = [](int32_t i) { return TileCoordsXY{ (i % TilesPerRow) * 2, 16 + i / TilesPerRow }; };
+
+    // The tiles that become holes are followed by the ones that fill the storage up to its end.
+    constexpr int32_t HoleElements = 101;
+    constexpr int32_t EndElements = 100;
+    for (int32_t i = 0; i < NumTiles; i++)
+    {
+        for (int32_t j = 0; j < HoleElements; j++)
+        {
+            ASSERT_NE(InsertElement(getHoleTile(i), InsertZ), nullptr);
+        }
+    }
+    for (int32_t i = 0; i < NumTiles; i++)
+    {
+        for (int32_t j = 0; j < EndElements; j++)
+        {
+            ASSERT_NE(InsertElement(getEndTile(i), InsertZ), nullptr);
+        }
+    }
+    for (int32_t i = 0; i < NumTiles; i++)
+    {
+        RemoveInsertedElements(getHoleTile(i));
+    }
+
+    // The end is nearly at the limit while most of the room is in the holes.
+    constexpr int32_t NumElements = 1000;
+    auto stats = map_get_element_stats();
+    ASSERT_GT(stats.UsedElements + stats.FreeElements + NumElements, MAX_TILE_ELEMENTS);
+    ASSERT_GE(stats.LargestFreeRun, static_cast<uint32_t>(EndElements + 1));
+
+    ASSERT_TRUE(map_check_free_elements_and_reorganise(NumElements));
+    stats = map_get_element_stats();
+    EXPECT_LE(stats.UsedElements + stats.FreeElements + NumElements, MAX_TILE_ELEMENTS);
+    EXPECT_GT(stats.CompactionMoves, statsBefore.CompactionMoves);
+    EXPECT_EQ(stats.Reorganisations, statsBefore.Reorganisations);
+
+    for (int32_t i = 0; i < NumTiles; i++)
+    {
+        auto firstElement = map_get_first_element_at(getEndTile(i).ToCoordsXY());
+        ASSERT_EQ(CountElements(firstElement), static_cast<uint32_t>(EndElements + 1));
+        ASSERT_EQ(firstElement[0].GetType(), TILE_ELEMENT_TYPE_SURFACE);
+        ASSERT_EQ(firstElement[EndElements].GetBaseZ(), InsertZ);
+        ASSERT_EQ(CountElements(map_get_first_element_at(getHoleTile(i).ToCoordsXY())), 1u);
+    }
+}
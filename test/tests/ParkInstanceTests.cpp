@@ -0,0 +1,120 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/ParkImporter.h>
+#include <openrct2/ParkInstance.h>
+#include <openrct2/object/ObjectManager.h>
+#include <openrct2/platform/platform.h>
+#include <string>
+
+using namespace OpenRCT2;
+
+class ParkInstanceTest : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        core_init();
+        _context = CreateContext();
+        bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+    }
+
+    static void TearDownTestCase()
+    {
+        _context = nullptr;
+    }
+
+    static std::unique_ptr<ParkInstance> LoadPark(const std::string& fileName)
+    {
+        auto importer = ParkImporter::CreateS6(_context->GetObjectRepository());
+        auto loadResult = importer->LoadSavedGame(TestData::GetParkPath(fileName).c_str(), false);
+        _context->GetObjectManager().LoadObjects(loadResult.RequiredObjects.data(), loadResult.RequiredObjects.size());
+        importer->Import();
+        game_load_init();
+
+        auto park = std::make_unique<ParkInstance>(*_context);
+        park->Capture();
+        return park;
+    }
+
+    /**
+     * Makes a second park that starts from the same state.
+     */
+    static std::unique_ptr<ParkInstance> CopyPark(ParkInstance& park)
+    {
+        park.Restore();
+        auto copy = std::make_unique<ParkInstance>(*_context);
+        copy->Capture();
+        return copy;
+    }
+
+    static bool HaveSameParkData(const ParkInstance& a, const ParkInstance& b)
+    {
+        const auto& left = a.GetParkData();
+        const auto& right = b.GetParkData();
+        return left.GetLength() == right.GetLength()
+            && std::memcmp(left.GetData(), right.GetData(), static_cast<size_t>(left.GetLength())) == 0;
+    }
+
+    static constexpr uint32_t NumRounds = 3;
+    static constexpr uint32_t TicksPerRound = 200;
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> ParkInstanceTest::_context;
+
+TEST_F(ParkInstanceTest, InterleavedParksMatchParksRunAlone)
+{
+    auto parkA = LoadPark("bpb.sv6");
+    auto parkB = LoadPark("small_park_with_ferris_wheel.sv6");
+    auto parkAAlone = CopyPark(*parkA);
+    auto parkBAlone = CopyPark(*parkB);
+    ASSERT_TRUE(HaveSameParkData(*parkA, *parkAAlone));
+    ASSERT_TRUE(HaveSameParkData(*parkB, *parkBAlone));
+
+    parkA->Restore();
+    auto startTicks = gCurrentTicks;
+
+    for (uint32_t i = 0; i < NumRounds; i++)
+    {
+        parkAAlone->Update(TicksPerRound);
+    }
+    for (uint32_t i = 0; i < NumRounds; i++)
+    {
+        parkBAlone->Update(TicksPerRound);
+    }
+
+    // Each park takes a turn while the other one is kept in memory.
+    for (uint32_t i = 0; i < NumRounds; i++)
+    {
+        parkA->Update(TicksPerRound);
+        parkB->Update(TicksPerRound);
+    }
+
+    EXPECT_TRUE(HaveSameParkData(*parkA, *parkAAlone));
+    EXPECT_TRUE(HaveSameParkData(*parkB, *parkBAlone));
+
+    EXPECT_FALSE(HaveSameParkData(*parkA, *parkB));
+
+    parkA->Restore();
+    EXPECT_EQ(gCurrentTicks, startTicks + NumRounds * TicksPerRound);
+}
@@ -10,9 +10,14 @@
 #include <openrct2/Game.h>
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/ParkImporter.h>
+#include <openrct2/actions/FootpathPlaceAction.h>
+#include <openrct2/actions/FootpathRemoveAction.h>
+#include <openrct2/config/Config.h>
 #include <openrct2/platform/platform.h>
 #include <openrct2/world/Footpath.h>
+#include <openrct2/world/FootpathGraph.h>
 #include <openrct2/world/Map.h>
+#include <sstream>
 
 using namespace OpenRCT2;
 
@@ -37,6 +42,10 @@ public:
         std::string parkPath = TestData::GetParkPath("pathfinding-tests.sv6");
         load_from_sv6(parkPath.c_str());
         game_load_init();
+
+        // The peeps are stepped directly, build the footpath graph like peep_update_all does so the searches use it.
+        // It has to give the same results as the legacy search.
+        footpath_graph_update();
     }
 
     void SetUp() override
@@ -252,3 +261,283 @@ INSTANTIATE_TEST_CASE_P(
         SimplePathfindingScenario("PathWithFences", { 11, 6, 14 }, 10000),
         SimplePathfindingScenario("PathWithCliff", { 7, 17, 14 }, 10000)),
     SimplePathfindingScenario::ToName);
+
+class FootpathGraphTest : public PathfindingTestBase
+{
+protected:
+    static std::string DescribeGraph()
+    {
+        std::ostringstream os;
+        for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+        {
+            for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+            {
+                auto tile = footpath_graph_get_tile({ x, y });
+                if (tile == nullptr)
+                    continue;
+
+                for (Direction direction : ALL_DIRECTIONS)
+                {
+                    if (!(tile->Edges & (1 << direction)))
+                        continue;
+
+                    const auto& segment = footpath_graph_get_segment(*tile, direction);
+                    os << TileCoordsXYZ(x, y, tile->BaseZ) << " " << static_cast<int32_t>(direction) << ": "
+                       << segment.Length << " " << segment.End << " " << static_cast<int32_t>(segment.EndDirection) << " "
+                       << segment.Min.x << "," << segment.Min.y << " " << segment.Max.x << "," << segment.Max.y << "\n";
+                }
+            }
+        }
+        return os.str();
+    }
+
+    static std::vector<std::pair<CoordsXY, TileElement*>> GetPlainPaths()
+    {
+        std::vector<std::pair<CoordsXY, TileElement*>> paths;
+        for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+        {
+            for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+            {
+                auto tile = footpath_graph_get_tile({ x, y });
+                if (tile != nullptr)
+                {
+                    auto loc = TileCoordsXYZ(x, y, tile->BaseZ).ToCoordsXYZ();
+                    paths.emplace_back(loc, map_get_footpath_element(loc));
+                }
+            }
+        }
+        return paths;
+    }
+
+    // Ghost paths are not plain, flipping the flag splits and joins runs without changing the park.
+    static void SetGhost(const std::vector<std::pair<CoordsXY, TileElement*>>& paths, bool isGhost)
+    {
+        for (const auto& path : paths)
+        {
+            path.second->SetGhost(isGhost);
+        }
+        footpath_graph_update();
+        ASSERT_NE(footpath_graph_get_changed_tiles(), nullptr);
+    }
+
+    static void ExpectSameAsRebuild()
+    {
+        auto incremental = DescribeGraph();
+        footpath_graph_invalidate();
+        footpath_graph_update();
+        EXPECT_EQ(incremental, DescribeGraph());
+    }
+};
+
+TEST_F(FootpathGraphTest, IncrementalUpdateMatchesRebuild)
+{
+    footpath_graph_invalidate();
+    footpath_graph_update();
+    auto paths = GetPlainPaths();
+    ASSERT_GT(paths.size(), 10U);
+
+    // A single tile splitting a run, then every fifth tile at once.
+    std::vector<std::pair<CoordsXY, TileElement*>> single = { paths[paths.size() / 2] };
+    std::vector<std::pair<CoordsXY, TileElement*>> spread;
+    for (size_t i = 0; i < paths.size(); i += 5)
+    {
+        spread.push_back(paths[i]);
+    }
+
+    for (const auto& changed : { single, spread })
+    {
+        for (const auto& path : changed)
+        {
+            ASSERT_NE(path.second, nullptr);
+        }
+        SetGhost(changed, true);
+        ExpectSameAsRebuild();
+        SetGhost(changed, false);
+        ExpectSameAsRebuild();
+    }
+}
+
+// The footpath tool places its ghost path and removes it again every tick, that must only update the tiles around it.
+TEST_F(FootpathGraphTest, GhostPathCycleDoesNotRebuild)
+{
+    footpath_graph_invalidate();
+    footpath_graph_update();
+
+    auto paths = GetPlainPaths();
+    auto flatPath = std::find_if(paths.begin(), paths.end(), [](const auto& path) {
+        return path.second != nullptr && !path.second->AsPath()->IsSloped();
+    });
+    ASSERT_NE(flatPath, paths.end());
+    auto loc = CoordsXYZ{ flatPath->first, flatPath->second->GetBaseZ() };
+    auto type = flatPath->second->AsPath()->GetSurfaceEntryIndex();
+
+    auto rebuildCount = footpath_graph_get_rebuild_count();
+    auto removeAction = FootpathRemoveAction(loc);
+    ASSERT_EQ(GameActions::Execute(&removeAction)->Error, GameActions::Status::Ok);
+    footpath_graph_update();
+
+    for (int32_t i = 0; i < 3; i++)
+    {
+        auto placeAction = FootpathPlaceAction(loc, 0, type);
+        placeAction.SetFlags(GAME_COMMAND_FLAG_GHOST | GAME_COMMAND_FLAG_ALLOW_DURING_PAUSED);
+        ASSERT_EQ(GameActions::Execute(&placeAction)->Error, GameActions::Status::Ok);
+        footpath_graph_update();
+        ASSERT_NE(footpath_graph_get_changed_tiles(), nullptr);
+
+        footpath_remove(
+            loc,
+            GAME_COMMAND_FLAG_APPLY | GAME_COMMAND_FLAG_ALLOW_DURING_PAUSED | GAME_COMMAND_FLAG_NO_SPEND
+                | GAME_COMMAND_FLAG_GHOST);
+        footpath_graph_update();
+        ASSERT_NE(footpath_graph_get_changed_tiles(), nullptr);
+    }
+    EXPECT_EQ(footpath_graph_get_rebuild_count(), rebuildCount);
+    ExpectSameAsRebuild();
+
+    // The other tests use the park as it was loaded.
+    load_from_sv6(TestData::GetParkPath("pathfinding-tests.sv6").c_str());
+    game_load_init();
+    footpath_graph_update();
+}
+
+class GuestDistanceFieldTest : public PathfindingTestBase
+{
+protected:
+    static TileCoordsXYZ GetGoal(const Ride* ride)
+    {
+        auto entrancePos = ride_get_entrance_location(ride, 0);
+        return TileCoordsXYZ(
+            entrancePos.x - TileDirectionDelta[entrancePos.direction].x,
+            entrancePos.y - TileDirectionDelta[entrancePos.direction].y, entrancePos.z);
+    }
+
+    static Direction ChooseDirection(const TileCoordsXYZ& pos, const TileCoordsXYZ& goal, ride_id_t rideId, bool useFields)
+    {
+        Peep* peep = Peep::Generate(pos.ToCoordsXYZ().ToTileCentre());
+        peep->OutsideOfPark = false;
+        peep->GuestHeadingToRideId = rideId;
+
+        gConfigGeneral.guest_distance_fields = useFields;
+        gPeepPathFindGoalPosition = goal;
+        auto direction = peep_pathfind_choose_direction(pos, peep);
+        gConfigGeneral.guest_distance_fields = false;
+
+        peep_sprite_remove(peep);
+        return direction;
+    }
+
+    // Follows the distances down to the goal, each tile of the walk has to be one closer than the one before.
+    static std::vector<TileCoordsXYZ> WalkToGoal(const TileCoordsXYZ& start, const TileCoordsXYZ& goal)
+    {
+        std::vector<TileCoordsXYZ> walk{ start };
+        auto distance = peep_pathfind_get_distance_field_distance(goal, start);
+        while (distance > 0)
+        {
+            auto next = FindPathAtDistance(walk.back(), goal, distance - 1);
+            if (next == walk.back())
+            {
+                ADD_FAILURE() << "No path next to " << walk.back() << " is " << distance - 1 << " tiles from " << goal;
+                break;
+            }
+            walk.push_back(next);
+            distance--;
+        }
+        return walk;
+    }
+
+    static TileCoordsXYZ FindPathAtDistance(const TileCoordsXYZ& pos, const TileCoordsXYZ& goal, int32_t distance)
+    {
+        for (Direction direction : ALL_DIRECTIONS)
+        {
+            TileCoordsXY next = TileCoordsXY{ pos } + TileDirectionDelta[direction];
+            TileElement* tileElement = map_get_first_element_at(next.ToCoordsXY());
+            if (tileElement == nullptr)
+                continue;
+            do
+            {
+                if (tileElement->GetType() != TILE_ELEMENT_TYPE_PATH)
+                    continue;
+                auto nextPos = TileCoordsXYZ(next.x, next.y, tileElement->base_height);
+                if (peep_pathfind_get_distance_field_distance(goal, nextPos) == distance)
+                    return nextPos;
+            } while (!(tileElement++)->IsLastForTile());
+        }
+        return pos;
+    }
+};
+
+TEST_F(GuestDistanceFieldTest, DistancesLeadToGoal)
+{
+    static constexpr const char* rideNames[] = { "StraightFlat", "SBend", "UBend", "CBend", "SelfCrossingPath" };
+    static constexpr TileCoordsXYZ starts[] = { { 19, 15, 14 }, { 15, 12, 14 }, { 17, 9, 14 }, { 14, 5, 14 }, { 6, 5, 14 } };
+    for (size_t i = 0; i < std::size(rideNames); i++)
+    {
+        auto ride = FindRideByName(rideNames[i]);
+        ASSERT_NE(ride, nullptr);
+        auto goal = GetGoal(ride);
+
+        auto distance = peep_pathfind_get_distance_field_distance(goal, starts[i]);
+        ASSERT_GT(distance, 0) << rideNames[i];
+        auto walk = WalkToGoal(starts[i], goal);
+        EXPECT_EQ(walk.size(), static_cast<size_t>(distance) + 1) << rideNames[i];
+        EXPECT_EQ(walk.back(), goal) << rideNames[i];
+    }
+
+    // A straight path is walked without detours.
+    auto ride = FindRideByName("StraightFlat");
+    auto goal = GetGoal(ride);
+    EXPECT_EQ(
+        peep_pathfind_get_distance_field_distance(goal, { 19, 15, 14 }), std::abs(goal.x - 19) + std::abs(goal.y - 15));
+
+    // Paths that are cut off from the goal are not part of the field.
+    ride = FindRideByName("PathWithGap");
+    ASSERT_NE(ride, nullptr);
+    EXPECT_EQ(peep_pathfind_get_distance_field_distance(GetGoal(ride), { 1, 6, 14 }), -1);
+}
+
+TEST_F(GuestDistanceFieldTest, ChosenEdgeMatchesHeuristicSearch)
+{
+    static constexpr const char* rideNames[] = { "StraightFlat", "SBend", "TwoUnequalRoutes", "StraightUpBridge" };
+    static constexpr TileCoordsXYZ starts[] = { { 19, 15, 14 }, { 15, 12, 14 }, { 3, 13, 14 }, { 12, 15, 14 } };
+    for (size_t i = 0; i < std::size(rideNames); i++)
+    {
+        auto ride = FindRideByName(rideNames[i]);
+        ASSERT_NE(ride, nullptr);
+        auto goal = GetGoal(ride);
+
+        auto heuristicDirection = ChooseDirection(starts[i], goal, ride->id, false);
+        auto fieldDirection = ChooseDirection(starts[i], goal, ride->id, true);
+        ASSERT_NE(fieldDirection, INVALID_DIRECTION) << rideNames[i];
+        EXPECT_EQ(fieldDirection, heuristicDirection) << rideNames[i];
+
+        // The chosen edge is the first tile of the walk down the distances.
+        auto walk = WalkToGoal(starts[i], goal);
+        ASSERT_GE(walk.size(), 2u) << rideNames[i];
+        EXPECT_EQ(TileCoordsXY{ starts[i] } + TileDirectionDelta[fieldDirection], TileCoordsXY{ walk[1] }) << rideNames[i];
+    }
+}
+
+TEST_F(GuestDistanceFieldTest, PathEditInvalidatesField)
+{
+    auto ride = FindRideByName("StraightFlat");
+    ASSERT_NE(ride, nullptr);
+    auto goal = GetGoal(ride);
+    const TileCoordsXYZ start = { 19, 15, 14 };
+
+    auto walk = WalkToGoal(start, goal);
+    ASSERT_GE(walk.size(), 3u);
+    auto fieldsBuilt = gPeepPathfindStats.DistanceFieldsBuilt;
+    EXPECT_EQ(peep_pathfind_get_distance_field_distance(goal, start), static_cast<int32_t>(walk.size()) - 1);
+    EXPECT_EQ(gPeepPathfindStats.DistanceFieldsBuilt, fieldsBuilt);
+
+    // Cutting the straight path in the middle leaves the start without a way to the goal.
+    auto removeAction = FootpathRemoveAction(walk[walk.size() / 2].ToCoordsXYZ());
+    ASSERT_EQ(GameActions::Execute(&removeAction)->Error, GameActions::Status::Ok);
+    EXPECT_EQ(peep_pathfind_get_distance_field_distance(goal, start), -1);
+    EXPECT_EQ(gPeepPathfindStats.DistanceFieldsBuilt, fieldsBuilt + 1);
+
+    // The other tests use the park as it was loaded.
+    load_from_sv6(TestData::GetParkPath("pathfinding-tests.sv6").c_str());
+    game_load_init();
+    footpath_graph_update();
+}
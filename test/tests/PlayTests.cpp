@@ -23,6 +23,7 @@
 #include <openrct2/ride/Ride.h>
 #include <openrct2/world/MapAnimation.h>
 #include <openrct2/world/Park.h>
+#include <openrct2/world/ParkAggregates.h>
 #include <openrct2/world/Scenery.h>
 #include <openrct2/world/Sprite.h>
 #include <string>
@@ -193,3 +194,25 @@ TEST_F(PlayTests, CarRideWithOneCarOnlyAcceptsTwoGuests)
         gs->UpdateLogic();
     }
 }
+
+TEST_F(PlayTests, ParkAggregatesMatchRecountAfterPlaying)
+{
+    // This test verifies that the running park totals still match a full count after guests have walked around for a while
+    std::string initStateFile = TestData::GetParkPath("bpb.sv6");
+
+    auto context = localStartGame(initStateFile);
+    ASSERT_NE(context.get(), nullptr);
+
+    auto gs = context->GetGameState();
+    ASSERT_NE(gs, nullptr);
+
+    ASSERT_TRUE(park_aggregates_verify());
+
+    execute<ParkSetParameterAction>(ParkParameter::Open);
+    for (int i = 0; i < 3000; i++)
+    {
+        gs->UpdateLogic();
+    }
+
+    ASSERT_TRUE(park_aggregates_verify());
+}
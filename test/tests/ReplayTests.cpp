@@ -14,14 +14,20 @@
 #include <openrct2/Game.h>
 #include <openrct2/GameState.h>
 #include <openrct2/OpenRCT2.h>
+#include <openrct2/ParkImporter.h>
 #include <openrct2/ReplayManager.h>
+#include <openrct2/actions/SetCheatAction.h>
 #include <openrct2/audio/AudioContext.h>
+#include <openrct2/config/Config.h>
 #include <openrct2/core/File.h>
 #include <openrct2/core/FileScanner.h>
+#include <openrct2/core/FileSystem.hpp>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
 #include <openrct2/platform/platform.h>
+#include <openrct2/peep/Peep.h>
 #include <openrct2/ride/Ride.h>
+#include <openrct2/world/Sprite.h>
 #include <string>
 
 using namespace OpenRCT2;
@@ -69,7 +75,7 @@ class ReplayTests : public testing::TestWithParam<ReplayTestData>
 protected:
 };
 
-TEST_P(ReplayTests, RunReplay)
+static void RunReplay(const std::string& replayFile, bool parallelEntityUpdate, bool parallelRideMotion = false)
 {
 #ifdef PLATFORM_32BIT
     log_warning("Replay Tests have not been performed. OpenRCT2/OpenRCT2#11279.");
@@ -79,12 +85,11 @@ TEST_P(ReplayTests, RunReplay)
     gOpenRCT2NoGraphics = true;
     core_init();
 
-    auto testData = GetParam();
-    auto replayFile = testData.filePath;
-
     auto context = CreateContext();
     bool initialised = context->Initialise();
     ASSERT_TRUE(initialised);
+    gConfigGeneral.parallel_entity_update = parallelEntityUpdate;
+    gConfigGeneral.parallel_ride_motion = parallelRideMotion;
 
     auto gs = context->GetGameState();
     ASSERT_NE(gs, nullptr);
@@ -94,6 +99,7 @@ TEST_P(ReplayTests, RunReplay)
 
     bool startedReplay = replayManager->StartPlayback(replayFile);
     ASSERT_TRUE(startedReplay);
+    ASSERT_TRUE(replayManager->IsPlaybackStateMismatching() == false);
 
     while (replayManager->IsReplaying())
     {
@@ -103,6 +109,106 @@ TEST_P(ReplayTests, RunReplay)
 #endif
 }
 
+TEST_P(ReplayTests, RunReplay)
+{
+    RunReplay(GetParam().filePath, false);
+}
+
+// The recorded checksums must match with the guest searches run ahead on worker threads as well.
+TEST_P(ReplayTests, RunReplayParallelEntityUpdate)
+{
+    RunReplay(GetParam().filePath, true);
+}
+
+// Trains updated ahead on worker threads and committed in order must not change the recorded checksums either.
+TEST_P(ReplayTests, RunReplayParallelRideMotion)
+{
+    RunReplay(GetParam().filePath, false, true);
+}
+
+static size_t CountGuests()
+{
+    size_t count = 0;
+    for ([[maybe_unused]] auto guest : EntityList<Guest>(EntityListId::Peep))
+    {
+        count++;
+    }
+    return count;
+}
+
+// The replays in the test data predate keyframes, this records one that has them. Guests are generated before,
+// between and after the keyframes so playing from the wrong keyframe or replaying skipped commands changes the guests.
+TEST(ReplayKeyframeTests, RunReplaySegmentFromKeyframe)
+{
+#ifdef PLATFORM_32BIT
+    log_warning("Replay Tests have not been performed. OpenRCT2/OpenRCT2#11279.");
+    return;
+#else
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+    core_init();
+
+    auto context = CreateContext();
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+    gConfigGeneral.parallel_entity_update = false;
+    gConfigGeneral.parallel_ride_motion = false;
+
+    load_from_sv6(TestData::GetParkPath("bpb.sv6").c_str());
+    auto gs = context->GetGameState();
+    ASSERT_NE(gs, nullptr);
+    IReplayManager* replayManager = context->GetReplayManager();
+    ASSERT_NE(replayManager, nullptr);
+
+    auto replayPath = (fs::temp_directory_path() / "openrct2_replay_keyframes.sv6r").u8string();
+    uint32_t startTick = gCurrentTicks;
+    ASSERT_TRUE(replayManager->StartRecording(replayPath, 2500));
+    size_t guestsAtSecondKeyframe = 0;
+    while (replayManager->IsRecording())
+    {
+        auto tick = gCurrentTicks - startTick;
+        if (tick == 500 || tick == 1500 || tick == 2200)
+        {
+            SetCheatAction cheatAction(CheatType::GenerateGuests, 5);
+            GameActions::Execute(&cheatAction);
+        }
+        if (tick == 2000)
+        {
+            guestsAtSecondKeyframe = CountGuests();
+        }
+        gs->UpdateLogic();
+    }
+
+    std::vector<uint32_t> keyframeTicks;
+    ASSERT_TRUE(replayManager->GetKeyframeTicks(replayPath, keyframeTicks));
+    ASSERT_GE(keyframeTicks.size(), 2U);
+
+    // Starts from the first keyframe and skips the commands recorded before it.
+    ASSERT_TRUE(replayManager->StartPlayback(replayPath, keyframeTicks[0], keyframeTicks[1]));
+    ASSERT_EQ(gCurrentTicks, keyframeTicks[0]);
+    ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
+    while (gCurrentTicks < keyframeTicks[1])
+    {
+        ASSERT_TRUE(replayManager->IsReplaying());
+        gs->UpdateLogic();
+        ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
+    }
+    ASSERT_EQ(CountGuests(), guestsAtSecondKeyframe);
+    replayManager->StopPlayback();
+
+    // Seeking past a keyframe plays the rest of the way from it.
+    ASSERT_TRUE(replayManager->StartPlayback(replayPath, keyframeTicks[1] + 100));
+    ASSERT_EQ(gCurrentTicks, keyframeTicks[1] + 100);
+    while (replayManager->IsReplaying())
+    {
+        gs->UpdateLogic();
+        ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
+    }
+
+    fs::remove(fs::u8path(replayPath));
+#endif
+}
+
 static void PrintTo(const ReplayTestData& testData, std::ostream* os)
 {
     *os << testData.filePath;
@@ -112,8 +218,7 @@ struct PrintReplayParameter
 {
     template<class ParamType> std::string operator()(const testing::TestParamInfo<ParamType>& info) const
     {
-        auto data = static_cast<ReplayTestData>(info.param);
-        return data.name;
+        return info.param.name;
     }
 };
 
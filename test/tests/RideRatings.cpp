@@ -9,18 +9,26 @@
 
 #include "TestData.h"
 
+#include <algorithm>
+#include <cstdlib>
 #include <gtest/gtest.h>
 #include <openrct2/Context.h>
 #include <openrct2/Game.h>
 #include <openrct2/OpenRCT2.h>
+#include <openrct2/PlatformEnvironment.h>
 #include <openrct2/audio/AudioContext.h>
 #include <openrct2/core/File.h>
+#include <openrct2/core/FileScanner.h>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
+#include <openrct2/object/ObjectManager.h>
 #include <openrct2/platform/platform.h>
 #include <openrct2/ride/Ride.h>
 #include <openrct2/ride/RideData.h>
+#include <openrct2/ride/RideRatingService.h>
+#include <openrct2/ride/TrackDesign.h>
 #include <string>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -46,7 +54,11 @@ protected:
 
     std::string FormatRatings(const Ride& ride)
     {
-        RatingTuple ratings = ride.ratings;
+        return FormatRatings(ride, ride.ratings);
+    }
+
+    std::string FormatRatings(const Ride& ride, const RatingTuple& ratings)
+    {
         std::string line = String::StdFormat(
             "%s: (%d, %d, %d)", RideTypeDescriptors[ride.type].EnumName, static_cast<int>(ratings.Excitement),
             static_cast<int>(ratings.Intensity), static_cast<int>(ratings.Nausea));
@@ -88,3 +100,96 @@ TEST_F(RideRatings, all)
         expI++;
     }
 }
+
+TEST_F(RideRatings, service)
+{
+    std::string path = TestData::GetParkPath("bpb.sv6");
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    core_init();
+    auto context = CreateContext();
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+
+    load_from_sv6(path.c_str());
+    ASSERT_EQ(ride_get_count(), 134);
+
+    // Rate every ride on worker threads without changing the park, the results have to match the rating state machine.
+    std::vector<ride_id_t> rideIds;
+    for (const auto& ride : GetRideManager())
+    {
+        rideIds.push_back(ride.id);
+    }
+    auto requests = ride_rating_requests_create(rideIds);
+    ride_ratings_rate_batch(requests);
+
+    auto expectedDataPath = Path::Combine(TestData::GetBasePath(), "ratings", "bpb.sv6.txt");
+    auto expectedRatings = File::ReadAllLines(expectedDataPath);
+
+    // Closed rides are not rated, they keep the ratings of the saved park.
+    int expI = 0;
+    auto request = requests.begin();
+    for (const auto& ride : GetRideManager())
+    {
+        auto ratings = ride.ratings;
+        if (request != requests.end() && request->RideSnapshot->id == ride.id)
+        {
+            ASSERT_TRUE(request->Rated);
+            ratings = request->Ratings;
+            request++;
+        }
+        auto actual = FormatRatings(ride, ratings);
+        auto expected = expectedRatings[expI];
+        ASSERT_STREQ(actual.c_str(), expected.c_str());
+
+        expI++;
+    }
+    ASSERT_EQ(request, requests.end());
+}
+
+TEST_F(RideRatings, design)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    core_init();
+    auto context = CreateContext();
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+
+    // Rate the first of the track designs that come with RCT2
+    auto tracksPath = context->GetPlatformEnvironment()->GetDirectoryPath(DIRBASE::RCT2, DIRID::TRACK);
+    std::vector<std::string> paths;
+    auto scanner = std::unique_ptr<IFileScanner>(Path::ScanDirectory(Path::Combine(tracksPath, "*.td6"), true));
+    while (scanner->Next())
+    {
+        paths.emplace_back(scanner->GetPath());
+    }
+    ASSERT_FALSE(paths.empty());
+    std::sort(paths.begin(), paths.end());
+
+    auto td = track_design_open(paths[0].c_str());
+    ASSERT_NE(td, nullptr);
+    object_manager_load_object(&td->vehicle_object);
+
+    std::vector<RideRatingRequest> requests;
+    requests.push_back(ride_rating_request_create(*td));
+    ride_ratings_rate_batch(requests);
+
+    const auto& request = requests[0];
+    ASSERT_TRUE(request.Rated);
+    ASSERT_NE(request.Ratings.Excitement, RIDE_RATING_UNDEFINED);
+    ASSERT_NE(request.Ratings.Intensity, RIDE_RATING_UNDEFINED);
+    ASSERT_NE(request.Ratings.Nausea, RIDE_RATING_UNDEFINED);
+
+    // The design stores its ratings in tenths. It is rated on flat land without the scenery of the park it was made in,
+    // so only the close proximity and scenery bonuses can differ.
+    constexpr int32_t tolerance = RIDE_RATING(1, 00);
+    EXPECT_LE(std::abs(request.Ratings.Excitement - td->excitement * 10), tolerance);
+    EXPECT_LE(std::abs(request.Ratings.Intensity - td->intensity * 10), tolerance);
+    EXPECT_LE(std::abs(request.Ratings.Nausea - td->nausea * 10), tolerance);
+
+    object_manager_unload_all_objects();
+}
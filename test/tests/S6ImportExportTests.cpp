@@ -28,8 +28,10 @@
 #include <openrct2/platform/platform.h>
 #include <openrct2/rct2/S6Exporter.h>
 #include <openrct2/ride/Ride.h>
+#include <openrct2/world/Map.h>
 #include <openrct2/world/Park.h>
 #include <openrct2/world/Sprite.h>
+#include <openrct2/world/Surface.h>
 #include <stdio.h>
 #include <string>
 
@@ -570,6 +572,78 @@ TEST(S6ImportExportAdvanceTicks, all)
     SUCCEED();
 }
 
+TEST(S6ImportExportExtendedMap, all)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    core_init();
+
+    // Larger than the park file chunks can hold and not a multiple of the chunk size.
+    constexpr int32_t MapSize = 300;
+    constexpr int32_t MapSizeTechnical = 320;
+    constexpr uint32_t GrassSceneryTileLoopPosition = 70000;
+    const auto farTile = TileCoordsXY{ 290, 280 };
+
+    MemoryStream exportBuffer;
+
+    // Create a park on the larger map.
+    {
+        std::unique_ptr<IContext> context = CreateContext();
+        EXPECT_NE(context, nullptr);
+
+        bool initialised = context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        context->GetGameState()->InitAll(MapSize);
+        ASSERT_EQ(gMapSizeTechnical, MapSizeTechnical);
+        ASSERT_TRUE(map_is_location_valid(farTile.ToCoordsXY()));
+
+        auto surfaceElement = map_get_surface_element_at(farTile.ToCoordsXY());
+        ASSERT_NE(surfaceElement, nullptr);
+        surfaceElement->base_height = 20;
+        surfaceElement->clearance_height = 20;
+        surfaceElement->SetOwnership(OWNERSHIP_OWNED);
+        gGrassSceneryTileLoopPosition = GrassSceneryTileLoopPosition;
+
+        ASSERT_TRUE(ExportSave(exportBuffer, context));
+    }
+
+    // Import it into a new context.
+    {
+        std::unique_ptr<IContext> context = CreateContext();
+        EXPECT_NE(context, nullptr);
+
+        bool initialised = context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        ASSERT_TRUE(ImportSave(exportBuffer, context, false));
+
+        EXPECT_EQ(gMapSize, MapSize);
+        EXPECT_EQ(gMapSizeTechnical, MapSizeTechnical);
+        EXPECT_EQ(gMapSizeMaxXY, MapSize * COORDS_XY_STEP - 33);
+        EXPECT_EQ(gGrassSceneryTileLoopPosition, GrassSceneryTileLoopPosition);
+
+        auto surfaceElement = map_get_surface_element_at(farTile.ToCoordsXY());
+        ASSERT_NE(surfaceElement, nullptr);
+        EXPECT_EQ(surfaceElement->base_height, 20);
+        EXPECT_EQ(surfaceElement->GetOwnership(), OWNERSHIP_OWNED);
+
+        // Every tile of the larger map is back with its surface.
+        int32_t numSurfaces = 0;
+        tile_element_iterator it;
+        tile_element_iterator_begin(&it);
+        while (tile_element_iterator_next(&it))
+        {
+            if (it.element->GetType() == TILE_ELEMENT_TYPE_SURFACE)
+                numSurfaces++;
+        }
+        EXPECT_EQ(numSurfaces, MapSizeTechnical * MapSizeTechnical);
+    }
+
+    SUCCEED();
+}
+
 TEST(SeaDecrypt, DecryptSea)
 {
     auto path = TestData::GetParkPath("volcania.sea");
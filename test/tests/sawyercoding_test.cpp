@@ -7,10 +7,14 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <openrct2/core/MemoryStream.h>
 #include <openrct2/rct12/SawyerChunkReader.h>
 #include <openrct2/util/SawyerCoding.h>
+#include <openrct2/util/Util.h>
+#include <random>
+#include <vector>
 
 constexpr size_t BUFFER_SIZE = 0x600000;
 
@@ -59,6 +63,62 @@ protected:
         auto result = memcmp(chunk->GetData(), randomdata, sizeof(randomdata));
         ASSERT_EQ(result, 0);
     }
+
+    // The codec functions for every instruction set this CPU supports.
+    static std::vector<const SawyerCodingFunctions*> get_supported_functions()
+    {
+        std::vector<const SawyerCodingFunctions*> result = { &SawyerCodingScalar };
+        if (sse41_available())
+            result.push_back(&SawyerCodingSSE41);
+        if (avx2_available())
+            result.push_back(&SawyerCodingAVX2);
+        return result;
+    }
+
+    // Random data made of runs, repeated sequences and noise so every branch of the encoders is hit.
+    static std::vector<uint8_t> generate_fuzz_data(std::mt19937& random, size_t length)
+    {
+        std::vector<uint8_t> data;
+        while (data.size() < length)
+        {
+            size_t span = std::uniform_int_distribution<size_t>(1, 300)(random);
+            switch (random() % 4)
+            {
+                case 0:
+                    data.insert(data.end(), span, static_cast<uint8_t>(random()));
+                    break;
+                case 1:
+                    for (size_t i = 0; i < span; i++)
+                        data.push_back(static_cast<uint8_t>(random()));
+                    break;
+                case 2:
+                    // Few distinct values give lots of short runs and equal neighbours.
+                    for (size_t i = 0; i < span; i++)
+                        data.push_back(static_cast<uint8_t>(random() % 3));
+                    break;
+                default:
+                    if (!data.empty())
+                    {
+                        size_t distance = std::uniform_int_distribution<size_t>(1, std::min<size_t>(40, data.size()))(random);
+                        for (size_t i = 0; i < span; i++)
+                            data.push_back(data[data.size() - distance]);
+                    }
+                    break;
+            }
+        }
+        data.resize(length);
+        return data;
+    }
+
+    static std::vector<uint8_t> encode_chunk(const std::vector<uint8_t>& data, uint8_t encoding)
+    {
+        sawyercoding_chunk_header chdr_in;
+        chdr_in.encoding = encoding;
+        chdr_in.length = static_cast<uint32_t>(data.size());
+        std::vector<uint8_t> encodedData(data.size() * 3 + 64);
+        encodedData.resize(sawyercoding_write_chunk_buffer(encodedData.data(), data.data(), chdr_in));
+        return encodedData;
+    }
 };
 
 TEST_F(SawyerCodingTest, write_read_chunk_none)
@@ -81,6 +141,131 @@ TEST_F(SawyerCodingTest, write_read_chunk_rotate)
     test_encode_decode(CHUNK_ENCODING_ROTATE);
 }
 
+TEST_F(SawyerCodingTest, read_chunk_into_buffer)
+{
+    for (uint8_t encoding : { CHUNK_ENCODING_NONE, CHUNK_ENCODING_RLE, CHUNK_ENCODING_RLECOMPRESSED, CHUNK_ENCODING_ROTATE })
+    {
+        sawyercoding_chunk_header chdr_in;
+        chdr_in.encoding = encoding;
+        chdr_in.length = sizeof(randomdata);
+        std::vector<uint8_t> encodedData(BUFFER_SIZE);
+        size_t encodedDataSize = sawyercoding_write_chunk_buffer(encodedData.data(), randomdata, chdr_in);
+
+        // Chunks larger than the buffer are cut off, smaller ones are padded with zero.
+        for (size_t length : { sizeof(randomdata), sizeof(randomdata) / 2, sizeof(randomdata) + 16 })
+        {
+            OpenRCT2::MemoryStream ms(encodedData.data(), encodedDataSize);
+            SawyerChunkReader reader(&ms);
+            std::vector<uint8_t> buffer(length, 0xCC);
+            reader.ReadChunk(buffer.data(), buffer.size());
+            ASSERT_EQ(ms.GetPosition(), encodedDataSize);
+
+            auto copied = std::min(length, sizeof(randomdata));
+            ASSERT_EQ(memcmp(buffer.data(), randomdata, copied), 0);
+            for (size_t i = copied; i < length; i++)
+            {
+                ASSERT_EQ(buffer[i], 0);
+            }
+        }
+    }
+}
+
+TEST_F(SawyerCodingTest, read_chunks_into_buffers)
+{
+    std::vector<uint8_t> encodedData(BUFFER_SIZE);
+    size_t encodedDataSize = 0;
+    uint8_t encodings[] = { CHUNK_ENCODING_RLECOMPRESSED, CHUNK_ENCODING_NONE, CHUNK_ENCODING_ROTATE, CHUNK_ENCODING_RLE };
+    for (auto encoding : encodings)
+    {
+        sawyercoding_chunk_header chdr_in;
+        chdr_in.encoding = encoding;
+        chdr_in.length = sizeof(randomdata);
+        encodedDataSize += sawyercoding_write_chunk_buffer(encodedData.data() + encodedDataSize, randomdata, chdr_in);
+    }
+
+    uint8_t buffers[std::size(encodings)][sizeof(randomdata)];
+    std::vector<SawyerChunkReader::Destination> destinations;
+    for (auto& buffer : buffers)
+    {
+        destinations.push_back({ buffer, sizeof(buffer) });
+    }
+
+    OpenRCT2::MemoryStream ms(encodedData.data(), encodedDataSize);
+    SawyerChunkReader reader(&ms);
+    reader.ReadChunks(destinations);
+    ASSERT_EQ(ms.GetPosition(), encodedDataSize);
+    for (const auto& buffer : buffers)
+    {
+        ASSERT_EQ(memcmp(buffer, randomdata, sizeof(randomdata)), 0);
+    }
+}
+
+TEST_F(SawyerCodingTest, encoders_match_scalar)
+{
+    std::mt19937 random(1234);
+    std::vector<std::vector<uint8_t>> inputs;
+    for (size_t length : { 1, 2, 3, 15, 16, 17, 31, 32, 33, 40, 127, 128, 129, 1000, 65536, 200003 })
+    {
+        inputs.push_back(generate_fuzz_data(random, length));
+    }
+    inputs.emplace_back(randomdata, randomdata + sizeof(randomdata));
+    inputs.emplace_back(70000, 0);
+
+    auto functions = get_supported_functions();
+    for (const auto& input : inputs)
+    {
+        gSawyerCoding = &SawyerCodingScalar;
+        std::vector<std::vector<uint8_t>> expected;
+        for (uint8_t encoding : { CHUNK_ENCODING_RLE, CHUNK_ENCODING_RLECOMPRESSED, CHUNK_ENCODING_ROTATE })
+        {
+            expected.push_back(encode_chunk(input, encoding));
+        }
+        auto expectedChecksum = sawyercoding_calculate_checksum(input.data(), input.size());
+
+        for (auto fns : functions)
+        {
+            gSawyerCoding = fns;
+            size_t i = 0;
+            for (uint8_t encoding : { CHUNK_ENCODING_RLE, CHUNK_ENCODING_RLECOMPRESSED, CHUNK_ENCODING_ROTATE })
+            {
+                auto encodedData = encode_chunk(input, encoding);
+                ASSERT_EQ(encodedData, expected[i++]) << "length " << input.size() << " encoding " << int(encoding);
+
+                // Read back through the chunk reader, both into a new chunk and into a buffer of the exact size.
+                OpenRCT2::MemoryStream ms(encodedData.data(), encodedData.size());
+                SawyerChunkReader reader(&ms);
+                auto chunk = reader.ReadChunk();
+                ASSERT_EQ(chunk->GetLength(), input.size());
+                ASSERT_EQ(memcmp(chunk->GetData(), input.data(), input.size()), 0);
+
+                std::vector<uint8_t> buffer(input.size());
+                ms.SetPosition(0);
+                reader.ReadChunk(buffer.data(), buffer.size());
+                ASSERT_EQ(buffer, input);
+            }
+            ASSERT_EQ(sawyercoding_calculate_checksum(input.data(), input.size()), expectedChecksum);
+        }
+    }
+    gSawyerCoding = &SawyerCodingScalar;
+}
+
+TEST_F(SawyerCodingTest, encoders_match_reference_data)
+{
+    // The reference chunks below were written by the original encoders.
+    for (auto fns : get_supported_functions())
+    {
+        gSawyerCoding = fns;
+        std::vector<uint8_t> input(randomdata, randomdata + sizeof(randomdata));
+        ASSERT_EQ(encode_chunk(input, CHUNK_ENCODING_RLE), std::vector<uint8_t>(rledata, rledata + sizeof(rledata)));
+        ASSERT_EQ(
+            encode_chunk(input, CHUNK_ENCODING_RLECOMPRESSED),
+            std::vector<uint8_t>(rlecompresseddata, rlecompresseddata + sizeof(rlecompresseddata)));
+        ASSERT_EQ(
+            encode_chunk(input, CHUNK_ENCODING_ROTATE), std::vector<uint8_t>(rotatedata, rotatedata + sizeof(rotatedata)));
+    }
+    gSawyerCoding = &SawyerCodingScalar;
+}
+
 // Note we only check if provided data decompresses to the same data, not if it compresses the same.
 // The reason for that is we may improve encoding at some point, but the test won't be affected,
 // as we already do a decode test and rountrip (encode + decode), which validates all uses.